@@ -259,3 +259,49 @@ TASK_IMPL_1(BDD, sylvan_minsol, BDD, f)
     return result;
 }
 
+
+TASK_IMPL_3(BDD, sylvan_or_and, BDD, a, BDD, b, BDD, c)
+{
+    /* Terminal cases */
+    if (a == sylvan_true || b == sylvan_false || c == sylvan_false) return a;
+    if (a == sylvan_false) return sylvan_and(b, c);
+    if (b == sylvan_true) return sylvan_or(a, c);
+    if (c == sylvan_true || b == c) return sylvan_or(a, b);
+    if (a == b || a == c) return a;
+
+    /* Maybe perform garbage collection */
+    sylvan_gc_test();
+
+    BDD result;
+    if (cache_get3(CACHE_BDD_OR_AND, a, b, c, &result)) {
+        return result;
+    }
+
+    bddnode_t na = MTBDD_GETNODE(a);
+    bddnode_t nb = MTBDD_GETNODE(b);
+    bddnode_t nc = MTBDD_GETNODE(c);
+
+    BDDVAR va = bddnode_getvariable(na);
+    BDDVAR vb = bddnode_getvariable(nb);
+    BDDVAR vc = bddnode_getvariable(nc);
+    BDDVAR var = va < vb ? va : vb;
+    if (vc < var) var = vc;
+
+    BDD alow = va == var ? node_low(a, na) : a;
+    BDD ahigh = va == var ? node_high(a, na) : a;
+    BDD blow = vb == var ? node_low(b, nb) : b;
+    BDD bhigh = vb == var ? node_high(b, nb) : b;
+    BDD clow = vc == var ? node_low(c, nc) : c;
+    BDD chigh = vc == var ? node_high(c, nc) : c;
+
+    bdd_refs_spawn(SPAWN(sylvan_or_and, ahigh, bhigh, chigh));
+    BDD low = bdd_refs_push(CALL(sylvan_or_and, alow, blow, clow));
+    BDD high = bdd_refs_sync(SYNC(sylvan_or_and));
+    bdd_refs_pop(1);
+
+    result = sylvan_makenode(var, low, high);
+
+    cache_put3(CACHE_BDD_OR_AND, a, b, c, result);
+
+    return result;
+}
@@ -41,6 +41,14 @@ TASK_DECL_2(BDD, sylvan_without, BDD, BDD);
 TASK_DECL_1(BDD, sylvan_minsol, BDD);
 #define sylvan_minsol(f) (RUN(sylvan_minsol, f))
 
+/*
+ * Computes a \/ (b /\ c) in a single pass without constructing b /\ c.
+ * This is the update of backward reachability fixpoints in which a are the states found so far, b the states
+ * that may be added and c the predecessors of a.
+ */
+TASK_DECL_3(BDD, sylvan_or_and, BDD, BDD, BDD);
+#define sylvan_or_and(a, b, c) (RUN(sylvan_or_and, a, b, c))
+
 #ifdef __cplusplus
 }
 #endif
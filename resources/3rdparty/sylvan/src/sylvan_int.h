@@ -116,6 +116,8 @@ static const uint64_t CACHE_MTBDD_EQUAL_NORM_REL_RF = (67LL<<40);
 static const uint64_t CACHE_MTBDD_ABSTRACT_REPRESENTATIVE = (68LL<<40);
 static const uint64_t CACHE_BDD_WITHOUT = (69LL<<40);
 static const uint64_t CACHE_BDD_MINSOL = (70LL<<40);
+static const uint64_t CACHE_MTBDD_AND_ABSTRACT_PLUS_MIN_MAX = (71LL<<40);
+static const uint64_t CACHE_BDD_OR_AND = (72LL<<40);
 
 // ZDD operations
 static const uint64_t CACHE_ZDD_FROM_MTBDD          = (80LL<<40);
@@ -1106,3 +1106,77 @@ TASK_IMPL_3(MTBDD, mtbdd_uapply_nocache, MTBDD, dd, mtbdd_uapply_op, op, size_t,
     // Caching would be done here, but is omitted (as this is the purpose of this function).
     return result;
 }
+
+TASK_IMPL_6(MTBDD, mtbdd_and_abstract_plus_min_max, MTBDD, a, MTBDD, b, MTBDD, c, MTBDD, sum_vars, MTBDD, opt_vars, int, minimize)
+{
+    /* Check terminal case, which is also taken if the next variable to sum over precedes the next variable to optimize over */
+    if (opt_vars == mtbdd_true || (sum_vars != mtbdd_true && mtbdd_getvar(sum_vars) < mtbdd_getvar(opt_vars))) {
+        MTBDD product = mtbdd_refs_push(CALL(mtbdd_and_abstract_plus, a, b, sum_vars));
+        MTBDD result = mtbdd_refs_push(CALL(mtbdd_apply, product, c, TASK(mtbdd_op_plus)));
+        if (opt_vars != mtbdd_true) {
+            result = CALL(mtbdd_abstract, result, opt_vars, minimize ? TASK(mtbdd_abstract_op_min) : TASK(mtbdd_abstract_op_max));
+        }
+        mtbdd_refs_pop(2);
+        return result;
+    }
+
+    /* Maybe perform garbage collection */
+    sylvan_gc_test();
+
+    /* Check cache */
+    MTBDD result;
+    if (cache_get6(CACHE_MTBDD_AND_ABSTRACT_PLUS_MIN_MAX | minimize, a, b, c, sum_vars, opt_vars, &result, NULL)) {
+        return result;
+    }
+
+    /* Get top variable */
+    int la = mtbdd_isleaf(a);
+    int lb = mtbdd_isleaf(b);
+    int lc = mtbdd_isleaf(c);
+    mtbddnode_t na = la ? 0 : MTBDD_GETNODE(a);
+    mtbddnode_t nb = lb ? 0 : MTBDD_GETNODE(b);
+    mtbddnode_t nc = lc ? 0 : MTBDD_GETNODE(c);
+    uint32_t va = la ? 0xffffffff : mtbddnode_getvariable(na);
+    uint32_t vb = lb ? 0xffffffff : mtbddnode_getvariable(nb);
+    uint32_t vc = lc ? 0xffffffff : mtbddnode_getvariable(nc);
+    uint32_t var = va < vb ? va : vb;
+    if (vc < var) var = vc;
+
+    mtbddnode_t nv = MTBDD_GETNODE(opt_vars);
+    uint32_t vv = mtbddnode_getvariable(nv);
+
+    if (vv < var) {
+        /* The result does not depend on the variable, so abstracting it by minimum or maximum has no effect */
+        result = CALL(mtbdd_and_abstract_plus_min_max, a, b, c, sum_vars, node_gethigh(opt_vars, nv), minimize);
+    } else {
+        /* Get cofactors */
+        MTBDD alow = (!la && va == var) ? node_getlow(a, na) : a;
+        MTBDD ahigh = (!la && va == var) ? node_gethigh(a, na) : a;
+        MTBDD blow = (!lb && vb == var) ? node_getlow(b, nb) : b;
+        MTBDD bhigh = (!lb && vb == var) ? node_gethigh(b, nb) : b;
+        MTBDD clow = (!lc && vc == var) ? node_getlow(c, nc) : c;
+        MTBDD chigh = (!lc && vc == var) ? node_gethigh(c, nc) : c;
+
+        if (vv == var) {
+            /* Recursive, then abstract result */
+            MTBDD next = node_gethigh(opt_vars, nv);
+            mtbdd_refs_spawn(SPAWN(mtbdd_and_abstract_plus_min_max, ahigh, bhigh, chigh, sum_vars, next, minimize));
+            MTBDD low = mtbdd_refs_push(CALL(mtbdd_and_abstract_plus_min_max, alow, blow, clow, sum_vars, next, minimize));
+            MTBDD high = mtbdd_refs_push(mtbdd_refs_sync(SYNC(mtbdd_and_abstract_plus_min_max)));
+            result = CALL(mtbdd_apply, low, high, minimize ? TASK(mtbdd_op_min) : TASK(mtbdd_op_max));
+            mtbdd_refs_pop(2);
+        } else /* vv > var */ {
+            /* Recursive, then create node */
+            mtbdd_refs_spawn(SPAWN(mtbdd_and_abstract_plus_min_max, ahigh, bhigh, chigh, sum_vars, opt_vars, minimize));
+            MTBDD low = mtbdd_refs_push(CALL(mtbdd_and_abstract_plus_min_max, alow, blow, clow, sum_vars, opt_vars, minimize));
+            MTBDD high = mtbdd_refs_sync(SYNC(mtbdd_and_abstract_plus_min_max));
+            mtbdd_refs_pop(1);
+            result = mtbdd_makenode(var, low, high);
+        }
+    }
+
+    /* Store in cache */
+    cache_put6(CACHE_MTBDD_AND_ABSTRACT_PLUS_MIN_MAX | minimize, a, b, c, sum_vars, opt_vars, result, 0);
+
+    return result;
+}
@@ -177,6 +177,14 @@ TASK_DECL_3(BDD, mtbdd_min_abstract_representative, MTBDD, MTBDD, uint32_t);
 TASK_DECL_3(BDD, mtbdd_max_abstract_representative, MTBDD, MTBDD, uint32_t);
 #define mtbdd_max_abstract_representative(a, vars) (RUN(mtbdd_max_abstract_representative, a, vars, 0))
 
+/**
+ * Multiply <a> and <b>, abstract the variables <sum_vars> using summation, add <c> and abstract the variables <opt_vars>
+ * by taking the minimum (if <minimize> is set) or the maximum. This fuses the steps of one iteration of value iteration
+ * for nondeterministic models. The fusion is most effective if the variables in <opt_vars> precede those in <sum_vars>.
+ */
+TASK_DECL_6(MTBDD, mtbdd_and_abstract_plus_min_max, MTBDD, MTBDD, MTBDD, MTBDD, MTBDD, int);
+#define mtbdd_and_abstract_plus_min_max(a, b, c, sum_vars, opt_vars, minimize) (RUN(mtbdd_and_abstract_plus_min_max, a, b, c, sum_vars, opt_vars, minimize))
+
 // A version of unary apply that performs no caching. This is needed of the argument is actually used by the unary operation,
 // but may not be used to identify cache entries, for example if the argument is a pointer.
 TASK_DECL_3(MTBDD, mtbdd_uapply_nocache, MTBDD, mtbdd_uapply_op, size_t);
@@ -364,6 +364,9 @@ public:
     Bdd Without(Bdd const& other) const;
     Bdd Minsol() const;
 
+    // Computes this \/ (constraint /\ other) without constructing the conjunction.
+    Bdd OrAnd(Bdd const& constraint, Bdd const& other) const;
+
     /////////////////////
 
 private:
@@ -838,6 +841,9 @@ public:
     Bdd AbstractMinRepresentative(const BddSet &variables) const;
     Bdd AbstractMaxRepresentative(const BddSet &variables) const;
 
+    // Computes min/max_{optVariables} (sum_{sumVariables} (this * other) + offset) in a single pass.
+    Mtbdd AndExistsPlusAbstractMinMax(const Mtbdd &other, const BddSet &sumVariables, const Mtbdd &offset, const BddSet &optVariables, bool minimize) const;
+
     Mtbdd Pow(const Mtbdd& other) const;
     Mtbdd Mod(const Mtbdd& other) const;
     Mtbdd Logxy(const Mtbdd& other) const;
@@ -73,6 +73,11 @@ Bdd::Minsol() const {
     return sylvan_minsol(bdd);
 }
 
+Bdd
+Bdd::OrAnd(Bdd const& constraint, Bdd const& other) const {
+    return sylvan_or_and(bdd, constraint.bdd, other.bdd);
+}
+
 /*********************************************
  Functions added to sylvan's Mtbdd class.
  *********************************************/
@@ -155,6 +160,12 @@ Mtbdd::AbstractMaxRepresentative(const BddSet &variables) const
     return mtbdd_max_abstract_representative(mtbdd, variables.set.bdd);
 }
 
+Mtbdd
+Mtbdd::AndExistsPlusAbstractMinMax(const Mtbdd &other, const BddSet &sumVariables, const Mtbdd &offset, const BddSet &optVariables, bool minimize) const
+{
+    return mtbdd_and_abstract_plus_min_max(mtbdd, other.mtbdd, offset.mtbdd, sumVariables.set.bdd, optVariables.set.bdd, minimize ? 1 : 0);
+}
+
 Mtbdd
 Mtbdd::Pow(const Mtbdd& other) const {
     return mtbdd_pow(mtbdd, other.mtbdd);
@@ -0,0 +1,88 @@
+#include "storm-benchmarks/BenchmarkRunner.h"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <thread>
+
+#include "storm-config.h"
+#include "storm-version-info/storm-version.h"
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace benchmarks {
+
+BenchmarkRunner::BenchmarkRunner(Options const& options) : options(options) {
+    // Intentionally left empty.
+}
+
+bool BenchmarkRunner::isSelected(std::string const& name) const {
+    return options.filter.empty() || name.find(options.filter) != std::string::npos;
+}
+
+void BenchmarkRunner::run(std::string const& name, std::function<void()> const& body, storm::json<double> const& info) {
+    if (!isSelected(name)) {
+        return;
+    }
+    using Clock = std::chrono::steady_clock;
+    auto measureBatch = [&body](uint64_t batchSize) {
+        auto start = Clock::now();
+        for (uint64_t i = 0; i < batchSize; ++i) {
+            body();
+        }
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    };
+
+    // Warm up (caches, allocator) and find a batch size such that a batch takes at least the minimal batch time.
+    uint64_t batchSize = 1;
+    double const minBatchTime = std::chrono::duration<double, std::nano>(options.minBatchTime).count();
+    double batchTime = measureBatch(batchSize);
+    while (batchTime < minBatchTime) {
+        batchSize = std::max<uint64_t>(batchSize * 2, static_cast<uint64_t>(batchSize * minBatchTime / std::max(batchTime, 1.0)));
+        batchTime = measureBatch(batchSize);
+    }
+
+    std::vector<double> times;
+    times.reserve(options.repetitions);
+    for (uint64_t repetition = 0; repetition < options.repetitions; ++repetition) {
+        times.push_back(measureBatch(batchSize) / batchSize);
+    }
+    std::sort(times.begin(), times.end());
+
+    storm::json<double> result;
+    result["name"] = name;
+    result["batch-size"] = batchSize;
+    result["repetitions"] = options.repetitions;
+    result["min-ns"] = times.front();
+    result["median-ns"] = times[times.size() / 2];
+    result["mean-ns"] = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+    result["max-ns"] = times.back();
+    if (!info.is_null()) {
+        result["info"] = info;
+    }
+    // Progress goes to stderr since the results might be written to stdout.
+    std::cerr << name << ": " << times.front() << "ns (min), " << times[times.size() / 2] << "ns (median)\n";
+    results.push_back(std::move(result));
+}
+
+storm::json<double> BenchmarkRunner::toJson() const {
+    storm::json<double> context;
+    context["storm-version"] = storm::StormVersion::shortVersionString();
+    context["revision"] = storm::StormVersion::gitRevisionHash;
+    context["compiler"] = storm::StormVersion::cxxCompiler;
+    context["flags"] = storm::StormVersion::cxxFlags;
+    context["hardware-threads"] = std::thread::hardware_concurrency();
+#ifdef STORM_HAVE_INTELTBB
+    context["intel-tbb"] = true;
+#else
+    context["intel-tbb"] = false;
+#endif
+
+    storm::json<double> result;
+    result["context"] = std::move(context);
+    result["benchmarks"] = results;
+    return result;
+}
+
+}  // namespace benchmarks
+}  // namespace storm
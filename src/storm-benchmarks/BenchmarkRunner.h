@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "storm/adapters/JsonForward.h"
+
+namespace storm {
+namespace benchmarks {
+
+/*!
+ * A minimal harness that runs registered benchmarks and collects their timings.
+ * Each benchmark is first calibrated such that a batch of invocations runs for a noticeable amount of time. Then, a fixed number of batches is measured
+ * and the minimum, median and mean time per invocation are reported. The minimum is the most stable value when comparing different builds.
+ */
+class BenchmarkRunner {
+   public:
+    struct Options {
+        // Only benchmarks whose name contains this string are executed.
+        std::string filter;
+        // The number of measured batches of each benchmark.
+        uint64_t repetitions{10};
+        // The minimal duration of a single batch.
+        std::chrono::milliseconds minBatchTime{50};
+    };
+
+    BenchmarkRunner(Options const& options);
+
+    /*!
+     * Runs the given benchmark (unless it is filtered out).
+     *
+     * @param name The name of the benchmark. Should be unique and stable across versions as it is used to compare results.
+     * @param body The measured operation. It is invoked repeatedly, so it must not change its input in a way that affects subsequent invocations.
+     * @param info Additional information about the input (e.g. its size) that is stored with the result.
+     */
+    void run(std::string const& name, std::function<void()> const& body, storm::json<double> const& info);
+
+    /*!
+     * Retrieves whether the benchmark with the given name would be executed. Can be used to skip building the input of filtered benchmarks.
+     */
+    bool isSelected(std::string const& name) const;
+
+    /*!
+     * Retrieves all results collected so far, together with information about the build and the machine.
+     */
+    storm::json<double> toJson() const;
+
+   private:
+    Options options;
+    std::vector<storm::json<double>> results;
+};
+
+}  // namespace benchmarks
+}  // namespace storm
@@ -0,0 +1,281 @@
+#include "storm-config.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+#include "storm-benchmarks/BenchmarkRunner.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/api/builder.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/io/file.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/Qvbs.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/initialize.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace benchmarks {
+
+/*!
+ * Prevents the compiler from optimizing away the computation of the given value.
+ */
+template<typename T>
+inline void doNotOptimize(T const& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/*!
+ * A backend for the value iteration operator that maximizes over the choices and never converges (so that each application processes all states).
+ */
+class MaximizingBackend {
+   public:
+    void startNewIteration() {
+        // Intentionally left empty.
+    }
+
+    void firstRow(double&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best = value;
+    }
+
+    void nextRow(double&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best = std::max(best, value);
+    }
+
+    void applyUpdate(double& currValue, [[maybe_unused]] uint64_t rowGroup) {
+        currValue = best;
+    }
+
+    void endOfIteration() const {
+        // Intentionally left empty.
+    }
+
+    bool converged() const {
+        return false;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    double best{0.0};
+};
+
+struct ModelInput {
+    std::string name;
+    storm::storage::SymbolicModelDescription description;
+};
+
+std::vector<ModelInput> getModelInputs(bool useQvbs) {
+    std::vector<ModelInput> result;
+    for (std::string const& file : {"dtmc/crowds-5-5.pm", "dtmc/brp-16-2.pm", "mdp/csma2-2.nm", "mdp/wlan0-2-4.nm"}) {
+        result.push_back({file, storm::storage::SymbolicModelDescription(storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/" + file, false, true))});
+    }
+    if (useQvbs) {
+        // The first (i.e. smallest) instance of some established benchmarks.
+        for (std::string const& modelName : {"brp", "consensus", "crowds", "csma", "zeroconf"}) {
+            storm::storage::QvbsBenchmark benchmark(modelName);
+            auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(), boost::none);
+            storm::storage::SymbolicModelDescription description(janiInput.first);
+            result.push_back({"qvbs/" + modelName, description.preprocess(benchmark.getConstantDefinition())});
+        }
+    }
+    return result;
+}
+
+storm::json<double> getModelInfo(storm::models::sparse::Model<double> const& model) {
+    storm::json<double> info;
+    info["states"] = model.getNumberOfStates();
+    info["choices"] = model.getNumberOfChoices();
+    info["transitions"] = model.getNumberOfTransitions();
+    return info;
+}
+
+void runBitVectorBenchmarks(BenchmarkRunner& runner) {
+    uint64_t const size = 1000000;
+    std::mt19937 engine(42);
+    std::bernoulli_distribution distribution(0.5);
+    storm::storage::BitVector first(size), second(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        first.set(i, distribution(engine));
+        second.set(i, distribution(engine));
+    }
+    storm::json<double> info;
+    info["bits"] = size;
+
+    runner.run("BitVector::operator&", [&]() { doNotOptimize(first & second); }, info);
+    runner.run("BitVector::operator|", [&]() { doNotOptimize(first | second); }, info);
+    runner.run("BitVector::operator~", [&]() { doNotOptimize(~first); }, info);
+    runner.run("BitVector::getNumberOfSetBits", [&]() { doNotOptimize(first.getNumberOfSetBits()); }, info);
+    runner.run(
+        "BitVector::iterate",
+        [&]() {
+            uint64_t sum = 0;
+            for (auto index : first) {
+                sum += index;
+            }
+            doNotOptimize(sum);
+        },
+        info);
+
+    // Keys resembling the (compressed) states of the explicit model builder.
+    uint64_t const numberOfKeys = 100000;
+    uint64_t const bitsPerKey = 64;
+    std::vector<storm::storage::BitVector> keys;
+    keys.reserve(numberOfKeys);
+    std::uniform_int_distribution<uint64_t> keyDistribution;
+    for (uint64_t i = 0; i < numberOfKeys; ++i) {
+        storm::storage::BitVector key(bitsPerKey);
+        key.setFromInt(0, bitsPerKey, keyDistribution(engine));
+        keys.push_back(std::move(key));
+    }
+    storm::json<double> hashMapInfo;
+    hashMapInfo["keys"] = numberOfKeys;
+    hashMapInfo["bits-per-key"] = bitsPerKey;
+    runner.run(
+        "BitVectorHashMap::findOrAdd",
+        [&]() {
+            storm::storage::BitVectorHashMap<uint32_t> map(bitsPerKey);
+            for (uint64_t i = 0; i < numberOfKeys; ++i) {
+                doNotOptimize(map.findOrAdd(keys[i], i));
+            }
+            // Subsequent lookups of existing keys.
+            for (uint64_t i = 0; i < numberOfKeys; ++i) {
+                doNotOptimize(map.findOrAdd(keys[i], 0));
+            }
+        },
+        hashMapInfo);
+}
+
+void runModelBenchmarks(BenchmarkRunner& runner, ModelInput const& input) {
+    storm::builder::BuilderOptions options(true, true);
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+    runner.run("ExplicitModelBuilder::build/" + input.name, [&]() { model = storm::api::buildSparseModel<double>(input.description, options); },
+               storm::json<double>());
+    if (!model) {
+        model = storm::api::buildSparseModel<double>(input.description, options);
+    }
+    storm::json<double> info = getModelInfo(*model);
+    auto const& matrix = model->getTransitionMatrix();
+
+    std::vector<double> x(matrix.getColumnCount(), 0.5);
+    std::vector<double> b(matrix.getRowCount(), 0.1);
+    std::vector<double> rowResult(matrix.getRowCount());
+    runner.run(
+        "SparseMatrix::multiplyWithVector/" + input.name,
+        [&]() {
+            matrix.multiplyWithVector(x, rowResult, &b);
+            doNotOptimize(rowResult.data());
+        },
+        info);
+
+    std::vector<double> groupResult(matrix.getRowGroupCount());
+    if (model->isNondeterministicModel()) {
+        runner.run(
+            "SparseMatrix::multiplyAndReduce/" + input.name,
+            [&]() {
+                matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, &b, groupResult, nullptr);
+                doNotOptimize(groupResult.data());
+            },
+            info);
+    }
+
+    if (runner.isSelected("ValueIterationOperator::apply/" + input.name)) {
+        storm::solver::helper::ValueIterationOperator<double, false> viOperator;
+        viOperator.setMatrixBackwards(matrix);
+        MaximizingBackend backend;
+        runner.run(
+            "ValueIterationOperator::apply/" + input.name,
+            [&]() {
+                viOperator.apply(x, groupResult, b, backend);
+                doNotOptimize(groupResult.data());
+            },
+            info);
+    }
+
+    runner.run("StronglyConnectedComponentDecomposition/" + input.name,
+               [&]() { doNotOptimize(storm::storage::StronglyConnectedComponentDecomposition<double>(matrix).size()); }, info);
+    if (model->isNondeterministicModel() && runner.isSelected("MaximalEndComponentDecomposition/" + input.name)) {
+        auto backwardTransitions = matrix.transpose(true);
+        runner.run("MaximalEndComponentDecomposition/" + input.name,
+                   [&]() { doNotOptimize(storm::storage::MaximalEndComponentDecomposition<double>(matrix, backwardTransitions).size()); }, info);
+    }
+}
+
+}  // namespace benchmarks
+}  // namespace storm
+
+void printUsage() {
+    STORM_PRINT("Usage: storm-benchmarks [--filter <substring>] [--repetitions <n>] [--output <file>] [--qvbs]\n");
+}
+
+/*!
+ * Main entry point of the executable storm-benchmarks.
+ */
+int main(const int argc, const char** argv) {
+    try {
+        storm::utility::setUp();
+        storm::settings::initializeAll("Storm-benchmarks", "storm-benchmarks");
+
+        storm::benchmarks::BenchmarkRunner::Options options;
+        std::string outputFilename;
+        bool useQvbs = false;
+        for (int i = 1; i < argc; ++i) {
+            std::string argument(argv[i]);
+            if (argument == "--filter" && i + 1 < argc) {
+                options.filter = argv[++i];
+            } else if (argument == "--repetitions" && i + 1 < argc) {
+                options.repetitions = std::max<uint64_t>(1, std::stoull(argv[++i]));
+            } else if (argument == "--output" && i + 1 < argc) {
+                outputFilename = argv[++i];
+            } else if (argument == "--qvbs") {
+#ifdef STORM_HAVE_QVBS
+                useQvbs = true;
+#else
+                STORM_LOG_ERROR("Storm was built without QVBS. Configure with -DSTORM_LOAD_QVBS=ON or -DSTORM_QVBS_ROOT=<dir>.");
+                return 1;
+#endif
+            } else {
+                printUsage();
+                return argument == "--help" ? 0 : 1;
+            }
+        }
+
+        storm::benchmarks::BenchmarkRunner runner(options);
+        storm::benchmarks::runBitVectorBenchmarks(runner);
+        for (auto const& input : storm::benchmarks::getModelInputs(useQvbs)) {
+            storm::benchmarks::runModelBenchmarks(runner, input);
+        }
+
+        std::string result = storm::dumpJson(runner.toJson());
+        if (outputFilename.empty()) {
+            std::cout << result << '\n';
+        } else {
+            std::ofstream stream;
+            storm::utility::openFile(outputFilename, stream);
+            stream << result << '\n';
+            storm::utility::closeFile(stream);
+        }
+
+        storm::utility::cleanUp();
+        return 0;
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused Storm-benchmarks to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-benchmarks to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
@@ -0,0 +1,44 @@
+#include <cstdlib>
+#include <new>
+
+#include "storm/utility/MemoryAccounting.h"
+
+// Replaces the global allocation functions such that the memory statistics of the executables can report the number of allocations per stage.
+// The allocations are still served by malloc/free; counting only happens if the memory accounting is enabled.
+
+void* operator new(std::size_t size) {
+    storm::utility::memory::countAllocation();
+    if (void* result = std::malloc(size == 0 ? 1 : size)) {
+        return result;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept {
+    storm::utility::memory::countAllocation();
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, std::nothrow_t const& tag) noexcept {
+    return ::operator new(size, tag);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
@@ -8,6 +8,8 @@
 #include "storm/settings/modules/DebugSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/utility/MemoryAccounting.h"
+#include "storm/utility/Profiling.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
@@ -53,6 +55,16 @@ void setResourceLimits() {
 
     // register signal handler to handle aborts
     storm::utility::resources::installSignalHandler(storm::settings::getModule<storm::settings::modules::ResourceSettings>().getSignalWaitingTimeInSeconds());
+
+    if (resources.isProfileSet()) {
+        storm::utility::profiling::enable(resources.isProfileChromeTraceSet());
+    }
+    if (resources.isPrintMemoryStatisticsSet()) {
+        storm::utility::memory::enable();
+    }
+    if (resources.isSoftMemoryLimitSet()) {
+        storm::utility::memory::setSoftLimit(resources.getSoftMemoryLimitInMegabytes() * 1024 * 1024);
+    }
 }
 
 void setFileLogging() {
@@ -105,6 +117,13 @@ int process(std::string const& name, std::string const& executableName, std::fun
     if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
         storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
     }
+    auto const& resources = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    if (resources.isPrintMemoryStatisticsSet()) {
+        storm::utility::memory::printReport(std::cout);
+    }
+    if (resources.isProfileSet()) {
+        storm::utility::profiling::exportToFile(resources.getProfileFilename(), resources.isProfileChromeTraceSet());
+    }
 
     // All operations have been performed, so we clean up everything and terminate.
     storm::utility::cleanUp();
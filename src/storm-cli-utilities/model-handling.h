@@ -7,6 +7,7 @@
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm-parsers/parser/ExpressionParser.h"
 
+#include "storm/io/SparseModelCache.h"
 #include "storm/io/file.h"
 #include "storm/utility/AutomaticSettings.h"
 #include "storm/utility/Engine.h"
@@ -17,6 +18,8 @@
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 
+#include <functional>
+#include <optional>
 #include <type_traits>
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -51,6 +54,7 @@
 #include "storm/storage/jani/localeliminator/AutomaticAction.h"
 #include "storm/storage/jani/localeliminator/JaniLocalEliminator.h"
 
+#include "storm/utility/MemoryAccounting.h"
 #include "storm/utility/Stopwatch.h"
 
 namespace storm {
@@ -68,6 +72,7 @@ struct SymbolicInput {
 };
 
 inline void parseSymbolicModelDescription(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input) {
+    storm::utility::memory::MemoryStage memoryStage("parsing");
     auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
     if (ioSettings.isPrismOrJaniInputSet()) {
         storm::utility::Stopwatch modelParsingWatch(true);
@@ -112,6 +117,7 @@ inline void parseProperties(storm::settings::modules::IOSettings const& ioSettin
 
 inline SymbolicInput parseSymbolicInputQvbs(storm::settings::modules::IOSettings const& ioSettings) {
     // Parse the model input
+    storm::utility::memory::MemoryStage memoryStage("parsing");
     SymbolicInput input;
     storm::storage::QvbsBenchmark benchmark(ioSettings.getQvbsModelName());
     STORM_PRINT_AND_LOG(benchmark.getInfo(ioSettings.getQvbsInstanceIndex(), ioSettings.getQvbsPropertyFilter()));
@@ -471,6 +477,8 @@ inline storm::builder::BuilderOptions createBuildOptionsSparseFromSettings(Symbo
     options.setReservedBitsForUnboundedVariables(buildSettings.getBitsForUnboundedVariables());
 
     options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
+    options.setSymmetryReduction(buildSettings.isSymmetryReductionSet());
+    options.setPartialOrderReduction(buildSettings.isPartialOrderReductionSet());
     if (buildSettings.isBuildFullModelSet()) {
         options.clearTerminalStates();
         options.setApplyMaximalProgressAssumption(false);
@@ -491,6 +499,22 @@ inline storm::builder::BuilderOptions createBuildOptionsSparseFromSettings(Symbo
 
 template<typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::builder::BuilderOptions const& options) {
+    if constexpr (std::is_same<ValueType, double>::value || std::is_same<ValueType, storm::RationalNumber>::value) {
+        auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+        if (buildSettings.isModelCacheSet() && storm::exporter::isSparseModelCacheSupported(options)) {
+            auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+            storm::exporter::SparseModelCacheKey key = storm::exporter::computeSparseModelCacheKey(
+                input.model.get(), ioSettings.isConstantsSet() ? ioSettings.getConstantDefinitionString() : "", options);
+            auto model = storm::exporter::loadSparseModelFromCache<ValueType>(buildSettings.getModelCacheDirectory(), key, input.model->getManager());
+            if (model) {
+                STORM_PRINT_AND_LOG("Loaded model from cache (key " << key.name << ").\n");
+                return model;
+            }
+            model = storm::api::buildSparseModel<ValueType>(input.model.get(), options);
+            storm::exporter::storeSparseModelInCache(buildSettings.getModelCacheDirectory(), key, *model);
+            return model;
+        }
+    }
     return storm::api::buildSparseModel<ValueType>(input.model.get(), options);
 }
 
@@ -515,9 +539,32 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
     return result;
 }
 
+/*!
+ * Records the sizes of the main data structures of the given model for the memory statistics.
+ */
+template<typename ValueType>
+void recordModelSizes(storm::models::ModelBase const& model) {
+    if (!storm::utility::memory::isEnabled() || !model.isSparseModel()) {
+        return;
+    }
+    auto sparseModel = model.as<storm::models::sparse::Model<ValueType>>();
+    if (!sparseModel) {
+        return;
+    }
+    storm::utility::memory::recordStructureSize("transition matrix", sparseModel->getTransitionMatrix().getSizeInBytes());
+    storm::utility::memory::recordStructureSize("state labeling", sparseModel->getStateLabeling().getSizeInBytes());
+    if (sparseModel->hasChoiceLabeling()) {
+        storm::utility::memory::recordStructureSize("choice labeling", sparseModel->getChoiceLabeling().getSizeInBytes());
+    }
+    if (sparseModel->hasStateValuations()) {
+        storm::utility::memory::recordStructureSize("state valuations", sparseModel->getStateValuations().getSizeInBytes());
+    }
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings,
                                                      ModelProcessingInformation const& mpi) {
+    storm::utility::memory::MemoryStage memoryStage("building");
     storm::utility::Stopwatch modelBuildingWatch(true);
 
     std::shared_ptr<storm::models::ModelBase> result;
@@ -538,6 +585,7 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
     modelBuildingWatch.stop();
     if (result) {
         STORM_PRINT("Time for model construction: " << modelBuildingWatch << ".\n\n");
+        recordModelSizes<ValueType>(*result);
     }
 
     return result;
@@ -579,7 +627,8 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> preprocessSparseModelBi
     }
 
     STORM_LOG_INFO("Performing bisimulation minimization...");
-    return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType);
+    return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType,
+                                                                  bisimulationSettings.getSparseRefinementMethod());
 }
 
 template<typename ValueType>
@@ -788,6 +837,7 @@ std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessDdModel(std
 template<storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
 std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input,
                                                                            ModelProcessingInformation const& mpi) {
+    storm::utility::memory::MemoryStage memoryStage("preprocessing");
     storm::utility::Stopwatch preprocessingWatch(true);
 
     std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -803,6 +853,7 @@ std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::
 
     if (result.second) {
         STORM_PRINT("\nTime for model preprocessing: " << preprocessingWatch << ".\n\n");
+        recordModelSizes<BuildValueType>(*result.first);
     }
     return result;
 }
@@ -1027,7 +1078,11 @@ void verifyProperties(SymbolicInput const& input, VerificationCallbackType const
     for (auto const& property : properties) {
         printModelCheckingProperty(property);
         storm::utility::Stopwatch watch(true);
-        auto result = verifyProperty<ValueType>(property.getRawFormula(), property.getFilter().getStatesFormula(), verificationCallback);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        {
+            storm::utility::memory::MemoryStage memoryStage("model checking");
+            result = verifyProperty<ValueType>(property.getRawFormula(), property.getFilter().getStatesFormula(), verificationCallback);
+        }
         watch.stop();
         if (result) {
             postprocessingCallback(result);
@@ -1200,24 +1255,89 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+/*!
+ * Enables a cache of a model (e.g. its backward transitions) and disables it again when going out of scope, which releases the cached objects even if
+ * the verification is aborted by an exception.
+ */
+class ScopedModelCaching {
+   public:
+    explicit ScopedModelCaching(std::function<void(bool)> const& setCaching) : setCaching(setCaching) {
+        this->setCaching(true);
+    }
+
+    ~ScopedModelCaching() {
+        setCaching(false);
+    }
+
+    ScopedModelCaching(ScopedModelCaching const&) = delete;
+    ScopedModelCaching& operator=(ScopedModelCaching const&) = delete;
+
+   private:
+    std::function<void(bool)> setCaching;
+};
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
+
+    // If several properties are checked, they share the backward transitions of the model. Moreover, the results of
+    // formulas that occur multiple times (as properties or as filters) are only computed once and kept until their last use.
+    // Results of related formulas (e.g. with different bounds) are used to warm-start the solvers.
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    using ResultKey = std::pair<std::string, bool>;
+    std::map<ResultKey, uint64_t> remainingUses;
+    for (auto const& property : properties) {
+        auto const& states = property.getFilter().getStatesFormula();
+        ++remainingUses[std::make_pair(property.getRawFormula()->toString(), states->isInitialFormula())];
+        if (!states->isInitialFormula() && !states->isTrueFormula()) {
+            ++remainingUses[std::make_pair(states->toString(), false)];
+        }
+    }
+    std::optional<ScopedModelCaching> backwardTransitionsCaching;
+    std::shared_ptr<storm::modelchecker::ModelCheckerResultCache<ValueType>> warmStartCache;
+    if (properties.size() > 1) {
+        backwardTransitionsCaching.emplace([&sparseModel](bool value) { sparseModel->setBackwardTransitionsCaching(value); });
+        warmStartCache = std::make_shared<storm::modelchecker::ModelCheckerResultCache<ValueType>>(sparseModel->getNumberOfStates());
+    }
+    std::map<ResultKey, std::unique_ptr<storm::modelchecker::CheckResult>> resultCache;
+    auto verifyShared = [&mpi, &sparseModel, &remainingUses, &resultCache,
+                         &warmStartCache](storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        auto key = std::make_pair(task.getFormula().toString(), task.isOnlyInitialStatesRelevantSet());
+        auto usesIt = remainingUses.find(key);
+        if (usesIt == remainingUses.end() || (usesIt->second <= 1 && resultCache.count(key) == 0)) {
+            return storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task, warmStartCache);
+        }
+        auto cacheIt = resultCache.find(key);
+        if (cacheIt == resultCache.end()) {
+            cacheIt = resultCache.emplace(key, storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task, warmStartCache)).first;
+        } else {
+            STORM_LOG_INFO("Reusing result for formula " << key.first << ".");
+        }
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        if (--usesIt->second == 0) {
+            result = std::move(cacheIt->second);
+            resultCache.erase(cacheIt);
+        } else if (cacheIt->second) {
+            result = cacheIt->second->clone();
+        }
+        return result;
+    };
+
+    auto verificationCallback = [&sparseModel, &ioSettings, &verifyShared](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                            std::shared_ptr<storm::logic::Formula const> const& states) {
         bool filterForInitialStates = states->isInitialFormula();
         auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
         if (ioSettings.isExportSchedulerSet()) {
             task.setProduceSchedulers(true);
         }
-        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = verifyShared(task);
 
         std::unique_ptr<storm::modelchecker::CheckResult> filter;
         if (filterForInitialStates) {
             filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
         } else if (!states->isTrueFormula()) {  // No need to apply filter if it is the formula 'true'
-            filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+            filter = verifyShared(storm::api::createTask<ValueType>(states, false));
         }
         if (result && filter) {
             result->filter(filter->asQualitativeCheckResult());
@@ -1283,12 +1403,18 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
 
 template<storm::dd::DdType DdType, typename ValueType>
 void verifyWithHybridEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    // If several properties are checked, they share the ODDs and explicit submatrices of the model.
+    auto symbolicModel = model->as<storm::models::symbolic::Model<DdType, ValueType>>();
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    std::optional<ScopedModelCaching> explicitSubmatrixCaching;
+    if (properties.size() > 1) {
+        explicitSubmatrixCaching.emplace([&symbolicModel](bool value) { symbolicModel->setExplicitSubmatrixCaching(value); });
+    }
     verifyProperties<ValueType>(
-        input, [&model, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+        input, [&symbolicModel, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
             bool filterForInitialStates = states->isInitialFormula();
             auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
 
-            auto symbolicModel = model->as<storm::models::symbolic::Model<DdType, ValueType>>();
             std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithHybridEngine<DdType, ValueType>(mpi.env, symbolicModel, task);
 
             std::unique_ptr<storm::modelchecker::CheckResult> filter;
@@ -696,6 +696,7 @@ class MILPMinimalLabelSetGenerator {
                                              storm::storage::BitVector const& psiStates, StateInformation const& stateInformation,
                                              ChoiceInformation const& choiceInformation, VariableInformation const& variableInformation) {
         storm::storage::SparseMatrix<T> backwardTransitions = mdp.getBackwardTransitions();
+        storm::storage::BitVector const& initialStates = mdp.getStates("init");
         uint_fast64_t numberOfConstraintsCreated = 0;
 
         for (auto state : stateInformation.relevantStates) {
@@ -776,7 +777,7 @@ class MILPMinimalLabelSetGenerator {
 
             // If the current state is an initial state and is selected as a successor state by the virtual
             // initial state, then this also justifies making a choice in the current state.
-            if (mdp.getStates("init").get(state)) {
+            if (initialStates.get(state)) {
                 constraint = constraint - variableInformation.initialStateToChoiceVariableMap.at(state);
             }
             constraint = constraint <= solver.getConstant(0);
@@ -904,8 +904,9 @@ class SMTMinimalLabelSetGenerator {
         // (1) if an incoming transition is chosen, an outgoing one is chosen as well (for non-initial states)
         // (2) an outgoing transition out of the initial states is taken.
         storm::expressions::Expression initialStateExpression = variableInformation.manager->boolean(false);
+        storm::storage::BitVector const& initialStates = model.getInitialStates();
         for (auto relevantState : relevancyInformation.relevantStates) {
-            if (!model.getInitialStates().get(relevantState)) {
+            if (!initialStates.get(relevantState)) {
                 // Assert the constraints (1).
                 storm::storage::FlatSet<uint_fast64_t> relevantPredecessors;
                 for (auto const& predecessorEntry : backwardTransitions.getRow(relevantState)) {
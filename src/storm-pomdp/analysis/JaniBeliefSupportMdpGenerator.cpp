@@ -83,9 +83,10 @@ void JaniBeliefSupportMdpGenerator<ValueType>::generate(storm::storage::BitVecto
         &model.addVariable(*storm::jani::Variable::makeBoundedIntegerVariable("prevact", exprManager.declareIntegerVariable("prevact"), exprManager.integer(0),
                                                                               false, exprManager.integer(0), exprManager.integer(obsactpairs.size())));
 
+    storm::storage::BitVector const& initialStates = pomdp.getInitialStates();
     for (uint64_t i = 0; i < pomdp.getNumberOfStates(); ++i) {
         std::string name = "s" + std::to_string(i);
-        bool isInitial = pomdp.getInitialStates().get(i);
+        bool isInitial = initialStates.get(i);
         stateVariables.emplace(i, &model.addVariable(*storm::jani::Variable::makeBooleanVariable(name, exprManager.declareBooleanVariable(name),
                                                                                                  exprManager.boolean(isInitial), false)));
     }
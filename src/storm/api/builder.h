@@ -23,6 +23,8 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -44,6 +46,7 @@ std::shared_ptr<storm::models::symbolic::Model<LibraryType, ValueType>> buildSym
             options.buildAllRewardModels = true;
             options.terminalStates.clear();
         }
+        options.staticVariableOrder = storm::settings::getModule<storm::settings::modules::BuildSettings>().isStaticDdVariableOrderSet();
 
         storm::builder::DdPrismModelBuilder<LibraryType, ValueType> builder;
         return builder.build(model.asPrismProgram(), options);
@@ -59,6 +62,7 @@ std::shared_ptr<storm::models::symbolic::Model<LibraryType, ValueType>> buildSym
         } else {
             options.applyMaximumProgressAssumption = (model.getModelType() == storm::storage::SymbolicModelDescription::ModelType::MA && applyMaximumProgress);
         }
+        options.staticVariableOrder = storm::settings::getModule<storm::settings::modules::BuildSettings>().isStaticDdVariableOrderSet();
 
         storm::builder::DdJaniModelBuilder<LibraryType, ValueType> builder;
         return builder.build(model.asJaniModel(), options);
@@ -9,6 +9,7 @@
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
+#include "storm/modelchecker/hints/ModelCheckerResultCache.h"
 #include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
@@ -94,7 +95,8 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env,
                                                                          std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc,
-                                                                         storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+                                                                         storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+                                                                         std::shared_ptr<storm::modelchecker::ModelCheckerResultCache<ValueType>> const& resultCache = nullptr) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver() == storm::solver::EquationSolverType::Elimination &&
         storm::settings::getModule<storm::settings::modules::EliminationSettings>().isUseDedicatedModelCheckerSet()) {
@@ -104,6 +106,9 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::
         }
     } else {
         storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc);
+        if (resultCache && resultCache->getNumberOfStates() == dtmc->getNumberOfStates()) {
+            modelchecker.setResultCache(resultCache);
+        }
         if (modelchecker.canHandle(task)) {
             result = modelchecker.check(env, task);
         }
@@ -121,9 +126,13 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::sh
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env,
                                                                          std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc,
-                                                                         storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+                                                                         storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+                                                                         std::shared_ptr<storm::modelchecker::ModelCheckerResultCache<ValueType>> const& resultCache = nullptr) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
     storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+    if (resultCache && resultCache->getNumberOfStates() == ctmc->getNumberOfStates()) {
+        modelchecker.setResultCache(resultCache);
+    }
     if (modelchecker.canHandle(task)) {
         result = modelchecker.check(env, task);
     }
@@ -140,9 +149,13 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::sh
 template<typename ValueType>
 typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type
 verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp,
-                       storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+                       storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+                       std::shared_ptr<storm::modelchecker::ModelCheckerResultCache<ValueType>> const& resultCache = nullptr) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
     storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
+    if (resultCache && resultCache->getNumberOfStates() == mdp->getNumberOfStates()) {
+        modelchecker.setResultCache(resultCache);
+    }
     if (modelchecker.canHandle(task)) {
         result = modelchecker.check(env, task);
     }
@@ -152,7 +165,8 @@ verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::mod
 template<typename ValueType>
 typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type
 verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp,
-                       storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+                       storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+                       std::shared_ptr<storm::modelchecker::ModelCheckerResultCache<ValueType>> const& = nullptr) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
     storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
     if (modelchecker.canHandle(task)) {
@@ -230,14 +244,15 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::sh
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env,
                                                                          std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
-                                                                         storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+                                                                         storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task,
+                                                                         std::shared_ptr<storm::modelchecker::ModelCheckerResultCache<ValueType>> const& resultCache = nullptr) {
     std::unique_ptr<storm::modelchecker::CheckResult> result;
     if (model->getType() == storm::models::ModelType::Dtmc) {
-        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Dtmc<ValueType>>(), task);
+        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Dtmc<ValueType>>(), task, resultCache);
     } else if (model->getType() == storm::models::ModelType::Mdp) {
-        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), task);
+        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), task, resultCache);
     } else if (model->getType() == storm::models::ModelType::Ctmc) {
-        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), task);
+        result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), task, resultCache);
     } else if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
         result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>(), task);
     } else if (model->getType() == storm::models::ModelType::Smg) {
@@ -51,6 +51,8 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       inferObservationsFromActions(false),
       addOverlappingGuardsLabel(false),
       addOutOfBoundsState(false),
+      symmetryReduction(false),
+      partialOrderReduction(false),
       reservedBitsForUnboundedVariables(32),
       showProgress(false),
       showProgressDelay(0) {
@@ -182,6 +184,14 @@ bool BuilderOptions::isAddOutOfBoundsStateSet() const {
     return addOutOfBoundsState;
 }
 
+bool BuilderOptions::isSymmetryReductionSet() const {
+    return symmetryReduction;
+}
+
+bool BuilderOptions::isPartialOrderReductionSet() const {
+    return partialOrderReduction;
+}
+
 uint64_t BuilderOptions::getReservedBitsForUnboundedVariables() const {
     return reservedBitsForUnboundedVariables;
 }
@@ -281,6 +291,16 @@ BuilderOptions& BuilderOptions::setAddOutOfBoundsState(bool newValue) {
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setSymmetryReduction(bool newValue) {
+    symmetryReduction = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setPartialOrderReduction(bool newValue) {
+    partialOrderReduction = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::setReservedBitsForUnboundedVariables(uint64_t newValue) {
     reservedBitsForUnboundedVariables = newValue;
     return *this;
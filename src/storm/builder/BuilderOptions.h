@@ -118,6 +118,8 @@ class BuilderOptions {
     bool isShowProgressSet() const;
     bool isScaleAndLiftTransitionRewardsSet() const;
     bool isAddOutOfBoundsStateSet() const;
+    bool isSymmetryReductionSet() const;
+    bool isPartialOrderReductionSet() const;
     uint64_t getReservedBitsForUnboundedVariables() const;
     bool isAddOverlappingGuardLabelSet() const;
     uint64_t getShowProgressDelay() const;
@@ -200,6 +202,20 @@ class BuilderOptions {
      */
     BuilderOptions& setAddOutOfBoundsState(bool newValue = true);
 
+    /**
+     * Should states be explored only up to permutations of symmetric modules (PRISM only)
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setSymmetryReduction(bool newValue = true);
+
+    /**
+     * Should MDP states be expanded only by an ample set of independent commands where possible (PRISM only)
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setPartialOrderReduction(bool newValue = true);
+
     /**
      * Should a state be labelled for overlapping guards
      * @param newValue the new value (default true)
@@ -268,6 +284,12 @@ class BuilderOptions {
     /// A flag indicating that the an additional state for out of bounds should be created.
     bool addOutOfBoundsState;
 
+    /// A flag indicating whether states are explored only up to permutations of symmetric modules.
+    bool symmetryReduction;
+
+    /// A flag indicating whether states are expanded with a partial-order reduction.
+    bool partialOrderReduction;
+
     /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
     uint64_t reservedBitsForUnboundedVariables;
 
@@ -23,6 +23,7 @@
 #include "storm/storage/jani/visitor/CompositionInformationVisitor.h"
 
 #include "storm/adapters/AddExpressionAdapter.h"
+#include "storm/builder/DdVariableOrder.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 
@@ -108,20 +109,21 @@ DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool
       buildAllRewardModels(buildAllRewardModels),
       applyMaximumProgressAssumption(applyMaximumProgressAssumption),
       rewardModelsToBuild(),
-      constantDefinitions() {
+      constantDefinitions(),
+      staticVariableOrder(false) {
     // Intentionally left empty.
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula)
-    : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+    : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), staticVariableOrder(false) {
     this->preserveFormula(formula);
     this->setTerminalStatesFromFormula(formula);
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas)
-    : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions() {
+    : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), staticVariableOrder(false) {
     if (!formulas.empty()) {
         for (auto const& formula : formulas) {
             this->preserveFormula(*formula);
@@ -301,8 +303,8 @@ struct CompositionVariables {
 template<storm::dd::DdType Type, typename ValueType>
 class CompositionVariableCreator : public storm::jani::CompositionVisitor {
    public:
-    CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation)
-        : model(model), automata(), actionInformation(actionInformation) {
+    CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation, bool staticVariableOrder)
+        : model(model), automata(), actionInformation(actionInformation), staticVariableOrder(staticVariableOrder) {
         // Intentionally left empty.
     }
 
@@ -379,13 +381,38 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
         }
 
+        // Create the meta variables for the locations and the non-transient variables in the chosen order.
+        std::map<storm::expressions::Variable, storm::jani::Automaton const*> locationVariableToAutomatonMap;
         for (auto const& automatonName : this->automata) {
             storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+            locationVariableToAutomatonMap.emplace(automaton.getLocationExpressionVariable(), &automaton);
+        }
+        std::map<storm::expressions::Variable, storm::jani::Variable const*> expressionVariableToVariableMap;
+        for (auto const& variable : this->model.getGlobalVariables()) {
+            expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), &variable);
+        }
+        for (auto const& automaton : this->model.getAutomata()) {
+            for (auto const& variable : automaton.getVariables()) {
+                expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), &variable);
+            }
+        }
+        metaVariablePairs.clear();
+        for (auto const& variable : getDdVariableOrder(this->model, this->automata, staticVariableOrder)) {
+            auto automatonIt = locationVariableToAutomatonMap.find(variable);
+            if (automatonIt != locationVariableToAutomatonMap.end()) {
+                storm::jani::Automaton const& automaton = *automatonIt->second;
+                metaVariablePairs.emplace(variable, result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1));
+            } else {
+                metaVariablePairs.emplace(variable, addMetaVariable(*expressionVariableToVariableMap.at(variable), result));
+            }
+        }
 
-            // Start by creating a meta variable for the location of the automaton.
+        for (auto const& automatonName : this->automata) {
+            storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+
+            // Start by creating the DDs for the location of the automaton.
             storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = metaVariablePairs.at(locationExpressionVariable);
             result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
             result.rowColumnMetaVariablePairs.push_back(variablePair);
 
@@ -451,6 +478,24 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         return result;
     }
 
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> addMetaVariable(storm::jani::Variable const& variable,
+                                                                                          CompositionVariables<Type, ValueType>& result) {
+        auto const& type = variable.getType();
+        if (type.isBasicType() && type.asBasicType().isBooleanType()) {
+            return result.manager->addMetaVariable(variable.getExpressionVariable().getName());
+        } else if (type.isBoundedType() && type.asBoundedType().isIntegerType()) {
+            auto const& boundedType = type.asBoundedType();
+            STORM_LOG_THROW(boundedType.hasLowerBound(), storm::exceptions::NotSupportedException,
+                            "DdJaniModelBuilder only supports bounded variables. Variable " << variable.getName() << " has no lower bound.");
+            STORM_LOG_THROW(boundedType.hasUpperBound(), storm::exceptions::NotSupportedException,
+                            "DdJaniModelBuilder only supports bounded variables. Variable " << variable.getName() << " has no upper bound.");
+            int_fast64_t low = boundedType.getLowerBound().evaluateAsInt();
+            int_fast64_t high = boundedType.getUpperBound().evaluateAsInt();
+            return result.manager->addMetaVariable(variable.getExpressionVariable().getName(), low, high);
+        }
+        STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Invalid type of variable in JANI model.");
+    }
+
     void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
         auto const& type = variable.getType();
         if (type.isBasicType() && type.asBasicType().isBooleanType()) {
@@ -463,16 +508,7 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
     }
 
     void createBoundedIntegerVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
-        auto const& type = variable.getType().asBoundedType();
-        STORM_LOG_THROW(type.hasLowerBound(), storm::exceptions::NotSupportedException,
-                        "DdJaniModelBuilder only supports bounded variables. Variable " << variable.getName() << " has no lower bound.");
-        STORM_LOG_THROW(type.hasUpperBound(), storm::exceptions::NotSupportedException,
-                        "DdJaniModelBuilder only supports bounded variables. Variable " << variable.getName() << " has no upper bound.");
-        int_fast64_t low = type.getLowerBound().evaluateAsInt();
-        int_fast64_t high = type.getUpperBound().evaluateAsInt();
-
-        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-            result.manager->addMetaVariable(variable.getExpressionVariable().getName(), low, high);
+        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = metaVariablePairs.at(variable.getExpressionVariable());
 
         STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << " and " << variablePair.second.getName()
                                                                                << ".");
@@ -493,8 +529,7 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
     }
 
     void createBooleanVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
-        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-            result.manager->addMetaVariable(variable.getExpressionVariable().getName());
+        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = metaVariablePairs.at(variable.getExpressionVariable());
 
         STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << " and " << variablePair.second.getName()
                                                                                << ".");
@@ -518,6 +553,8 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
     storm::jani::Model const& model;
     std::set<std::string> automata;
     storm::jani::CompositionInformation actionInformation;
+    bool staticVariableOrder;
+    std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> metaVariablePairs;
 };
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -2344,7 +2381,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
     storm::jani::CompositionInformation actionInformation = visitor.getInformation();
 
     // Create all necessary variables.
-    CompositionVariableCreator<Type, ValueType> variableCreator(model, actionInformation);
+    CompositionVariableCreator<Type, ValueType> variableCreator(model, actionInformation, options.staticVariableOrder);
     CompositionVariables<Type, ValueType> variables = variableCreator.create(manager);
 
     // Determine which transient assignments need to be considered in the building process.
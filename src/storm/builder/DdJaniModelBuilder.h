@@ -117,6 +117,10 @@ class DdJaniModelBuilder {
         // An optional set of expression or labels that characterizes (a subset of) the terminal states of the model.
         // If this is set, the outgoing transitions of these states are replaced with a self-loop.
         storm::builder::TerminalStates terminalStates;
+
+        // A flag indicating whether the meta variables of the model variables are created in a static order computed by the FORCE heuristic rather than
+        // in declaration order.
+        bool staticVariableOrder;
     };
 
     /*!
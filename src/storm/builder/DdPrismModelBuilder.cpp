@@ -2,6 +2,8 @@
 
 #include <boost/algorithm/string/join.hpp>
 
+#include "storm/builder/DdVariableOrder.h"
+
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -95,7 +97,7 @@ class ParameterCreator<Type, storm::RationalFunction> {
 template<storm::dd::DdType Type, typename ValueType>
 class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
    public:
-    GenerationInformation(storm::prism::Program const& program, std::shared_ptr<storm::dd::DdManager<Type>> const& manager)
+    GenerationInformation(storm::prism::Program const& program, std::shared_ptr<storm::dd::DdManager<Type>> const& manager, bool staticVariableOrder)
         : program(program),
           manager(manager),
           rowMetaVariables(),
@@ -110,7 +112,7 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
           moduleToIdentityMap(),
           parameters() {
         // Initializes variables and identity DDs.
-        createMetaVariablesAndIdentities();
+        createMetaVariablesAndIdentities(staticVariableOrder);
 
         // Initialize the parameters (if any).
         ParameterCreator<Type, ValueType> parameterCreator;
@@ -169,8 +171,10 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
    private:
     /*!
      * Creates the required meta variables and variable/module identities.
+     *
+     * @param staticVariableOrder If set, the meta variables of the program variables are created in the order computed by the FORCE heuristic.
      */
-    void createMetaVariablesAndIdentities() {
+    void createMetaVariablesAndIdentities(bool staticVariableOrder) {
         // Add synchronization variables.
         for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
             std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(program.getActionName(actionIndex));
@@ -190,11 +194,34 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allNondeterminismVariables.insert(variablePair.first);
         }
 
-        // Create meta variables for global program variables.
+        // Create the meta variables for the program variables in the chosen order.
+        std::map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> integerVariableBounds;
+        auto addBounds = [&integerVariableBounds](storm::prism::IntegerVariable const& integerVariable) {
+            integerVariableBounds.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(),
+                                                                                                  integerVariable.getUpperBoundExpression().evaluateAsInt()));
+        };
+        for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
+            addBounds(integerVariable);
+        }
+        for (storm::prism::Module const& module : program.getModules()) {
+            for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                addBounds(integerVariable);
+            }
+        }
+        std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> variableToMetaVariablePairMap;
+        for (auto const& variable : getDdVariableOrder(program, staticVariableOrder)) {
+            auto boundsIt = integerVariableBounds.find(variable);
+            if (boundsIt != integerVariableBounds.end()) {
+                variableToMetaVariablePairMap.emplace(variable, manager->addMetaVariable(variable.getName(), boundsIt->second.first, boundsIt->second.second));
+            } else {
+                variableToMetaVariablePairMap.emplace(variable, manager->addMetaVariable(variable.getName()));
+            }
+        }
+
+        // Create the identities for global program variables.
         for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-            int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-            int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
+                variableToMetaVariablePairMap.at(integerVariable.getExpressionVariable());
 
             STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                    << "] and " << variablePair.second.getName() << "["
@@ -213,7 +240,8 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allGlobalVariables.insert(integerVariable.getExpressionVariable());
         }
         for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
+                variableToMetaVariablePairMap.at(booleanVariable.getExpressionVariable());
 
             STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                    << "] and " << variablePair.second.getName() << "["
@@ -232,16 +260,14 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allGlobalVariables.insert(booleanVariable.getExpressionVariable());
         }
 
-        // Create meta variables for each of the modules' variables.
+        // Create the identities for each of the modules' variables.
         for (storm::prism::Module const& module : program.getModules()) {
             storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
             storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
 
             for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
                 std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                    manager->addMetaVariable(integerVariable.getName(), low, high);
+                    variableToMetaVariablePairMap.at(integerVariable.getExpressionVariable());
                 STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                 << "] and " << variablePair.second.getName() << "["
                                                                                 << variablePair.second.getIndex() << "]");
@@ -260,7 +286,8 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
                 rowColumnMetaVariablePairs.push_back(variablePair);
             }
             for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
+                    variableToMetaVariablePairMap.at(booleanVariable.getExpressionVariable());
                 STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                 << "] and " << variablePair.second.getName() << "["
                                                                                 << variablePair.second.getIndex() << "]");
@@ -607,20 +634,20 @@ bool DdPrismModelBuilder<Type, ValueType>::canHandle(storm::prism::Program const
 
 template<storm::dd::DdType Type, typename ValueType>
 DdPrismModelBuilder<Type, ValueType>::Options::Options()
-    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates() {
+    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), staticVariableOrder(false) {
     // Intentionally left empty.
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula)
-    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()) {
+    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()), staticVariableOrder(false) {
     this->preserveFormula(formula);
     this->setTerminalStatesFromFormula(formula);
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas)
-    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild() {
+    : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), staticVariableOrder(false) {
     for (auto const& formula : formulas) {
         this->preserveFormula(*formula);
     }
@@ -1424,7 +1451,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
     storm::prism::Program const& program, Options const& options, std::shared_ptr<storm::dd::DdManager<Type>> const& manager) {
     // Start by initializing the structure used for storing all information needed during the model generation.
     // In particular, this creates the meta variables used to encode the model.
-    GenerationInformation generationInfo(program, manager);
+    GenerationInformation generationInfo(program, manager, options.staticVariableOrder);
 
     SystemResult system = createSystemDecisionDiagram(generationInfo);
     storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
@@ -0,0 +1,210 @@
+#include "storm/builder/DdVariableOrder.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+uint64_t const maximalNumberOfForceIterations = 100;
+
+void insertVariables(storm::expressions::Expression const& expression, std::set<storm::expressions::Variable>& variables) {
+    auto expressionVariables = expression.getVariables();
+    variables.insert(expressionVariables.begin(), expressionVariables.end());
+}
+
+uint64_t computeTotalSpan(std::vector<std::vector<uint64_t>> const& hyperedges, std::vector<uint64_t> const& positions) {
+    uint64_t result = 0;
+    for (auto const& hyperedge : hyperedges) {
+        auto minMax = std::minmax_element(hyperedge.begin(), hyperedge.end(), [&positions](uint64_t a, uint64_t b) { return positions[a] < positions[b]; });
+        result += positions[*minMax.second] - positions[*minMax.first];
+    }
+    return result;
+}
+}  // namespace
+
+std::vector<storm::expressions::Variable> computeForceVariableOrder(std::vector<storm::expressions::Variable> const& variables,
+                                                                   std::vector<std::set<storm::expressions::Variable>> const& hyperedges) {
+    std::map<storm::expressions::Variable, uint64_t> variableToIndex;
+    for (uint64_t index = 0; index < variables.size(); ++index) {
+        variableToIndex.emplace(variables[index], index);
+    }
+
+    // Only hyperedges connecting at least two of the variables influence the order.
+    std::vector<std::vector<uint64_t>> indexHyperedges;
+    std::vector<std::vector<uint64_t>> variableToHyperedges(variables.size());
+    for (auto const& hyperedge : hyperedges) {
+        std::vector<uint64_t> indexHyperedge;
+        for (auto const& variable : hyperedge) {
+            auto indexIt = variableToIndex.find(variable);
+            if (indexIt != variableToIndex.end()) {
+                indexHyperedge.push_back(indexIt->second);
+            }
+        }
+        if (indexHyperedge.size() > 1) {
+            for (auto const& index : indexHyperedge) {
+                variableToHyperedges[index].push_back(indexHyperedges.size());
+            }
+            indexHyperedges.push_back(std::move(indexHyperedge));
+        }
+    }
+    if (indexHyperedges.empty()) {
+        return variables;
+    }
+
+    // The variable indices sorted by their position and the position of each variable index.
+    std::vector<uint64_t> order(variables.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<uint64_t> positions = order;
+    std::vector<uint64_t> bestOrder = order;
+    uint64_t initialSpan = computeTotalSpan(indexHyperedges, positions);
+    uint64_t bestSpan = initialSpan;
+
+    std::vector<double> centersOfGravity(indexHyperedges.size());
+    std::vector<double> tentativePositions(variables.size());
+    for (uint64_t iteration = 0; iteration < maximalNumberOfForceIterations; ++iteration) {
+        for (uint64_t hyperedge = 0; hyperedge < indexHyperedges.size(); ++hyperedge) {
+            double sum = 0.0;
+            for (auto const& index : indexHyperedges[hyperedge]) {
+                sum += positions[index];
+            }
+            centersOfGravity[hyperedge] = sum / indexHyperedges[hyperedge].size();
+        }
+        for (uint64_t index = 0; index < variables.size(); ++index) {
+            if (variableToHyperedges[index].empty()) {
+                tentativePositions[index] = positions[index];
+            } else {
+                double sum = 0.0;
+                for (auto const& hyperedge : variableToHyperedges[index]) {
+                    sum += centersOfGravity[hyperedge];
+                }
+                tentativePositions[index] = sum / variableToHyperedges[index].size();
+            }
+        }
+        std::stable_sort(order.begin(), order.end(), [&tentativePositions](uint64_t a, uint64_t b) { return tentativePositions[a] < tentativePositions[b]; });
+        for (uint64_t position = 0; position < order.size(); ++position) {
+            positions[order[position]] = position;
+        }
+
+        uint64_t span = computeTotalSpan(indexHyperedges, positions);
+        if (span >= bestSpan) {
+            break;
+        }
+        bestSpan = span;
+        bestOrder = order;
+    }
+    STORM_LOG_INFO("Static variable order reduces the total span of the variable dependencies from " << initialSpan << " to " << bestSpan << ".");
+
+    std::vector<storm::expressions::Variable> result;
+    result.reserve(variables.size());
+    for (auto const& index : bestOrder) {
+        result.push_back(variables[index]);
+    }
+    return result;
+}
+
+std::vector<storm::expressions::Variable> getDdVariableOrder(storm::prism::Program const& program, bool useStaticOrder) {
+    std::vector<storm::expressions::Variable> variables;
+    for (auto const& integerVariable : program.getGlobalIntegerVariables()) {
+        variables.push_back(integerVariable.getExpressionVariable());
+    }
+    for (auto const& booleanVariable : program.getGlobalBooleanVariables()) {
+        variables.push_back(booleanVariable.getExpressionVariable());
+    }
+    for (auto const& module : program.getModules()) {
+        for (auto const& integerVariable : module.getIntegerVariables()) {
+            variables.push_back(integerVariable.getExpressionVariable());
+        }
+        for (auto const& booleanVariable : module.getBooleanVariables()) {
+            variables.push_back(booleanVariable.getExpressionVariable());
+        }
+    }
+    if (!useStaticOrder) {
+        return variables;
+    }
+
+    // Every command connects the variables it reads and writes. Synchronizing commands additionally connect the variables of all participating modules.
+    std::vector<std::set<storm::expressions::Variable>> hyperedges;
+    std::map<uint_fast64_t, std::set<storm::expressions::Variable>> actionToVariables;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            std::set<storm::expressions::Variable> commandVariables;
+            insertVariables(command.getGuardExpression(), commandVariables);
+            for (auto const& update : command.getUpdates()) {
+                insertVariables(update.getLikelihoodExpression(), commandVariables);
+                for (auto const& assignment : update.getAssignments()) {
+                    commandVariables.insert(assignment.getVariable());
+                    insertVariables(assignment.getExpression(), commandVariables);
+                }
+            }
+            if (program.getSynchronizingActionIndices().count(command.getActionIndex()) > 0) {
+                actionToVariables[command.getActionIndex()].insert(commandVariables.begin(), commandVariables.end());
+            }
+            hyperedges.push_back(std::move(commandVariables));
+        }
+    }
+    for (auto& actionVariables : actionToVariables) {
+        hyperedges.push_back(std::move(actionVariables.second));
+    }
+    return computeForceVariableOrder(variables, hyperedges);
+}
+
+std::vector<storm::expressions::Variable> getDdVariableOrder(storm::jani::Model const& model, std::set<std::string> const& automata, bool useStaticOrder) {
+    std::vector<storm::expressions::Variable> variables;
+    for (auto const& automatonName : automata) {
+        variables.push_back(model.getAutomaton(automatonName).getLocationExpressionVariable());
+    }
+    for (auto const& variable : model.getGlobalVariables()) {
+        if (!variable.isTransient()) {
+            variables.push_back(variable.getExpressionVariable());
+        }
+    }
+    for (auto const& automaton : model.getAutomata()) {
+        for (auto const& variable : automaton.getVariables()) {
+            if (!variable.isTransient()) {
+                variables.push_back(variable.getExpressionVariable());
+            }
+        }
+    }
+    if (!useStaticOrder) {
+        return variables;
+    }
+
+    // Every edge connects the location variable of its automaton with the variables it reads and writes. Edges labeled with the same non-silent action
+    // additionally connect the variables of all participating automata.
+    std::vector<std::set<storm::expressions::Variable>> hyperedges;
+    std::map<uint64_t, std::set<storm::expressions::Variable>> actionToVariables;
+    for (auto const& automaton : model.getAutomata()) {
+        for (auto const& edge : automaton.getEdges()) {
+            std::set<storm::expressions::Variable> edgeVariables;
+            edgeVariables.insert(automaton.getLocationExpressionVariable());
+            insertVariables(edge.getGuard(), edgeVariables);
+            for (auto const& destination : edge.getDestinations()) {
+                insertVariables(destination.getProbability(), edgeVariables);
+                for (auto const& assignment : destination.getOrderedAssignments()) {
+                    edgeVariables.insert(assignment.getExpressionVariable());
+                    insertVariables(assignment.getAssignedExpression(), edgeVariables);
+                }
+            }
+            if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
+                actionToVariables[edge.getActionIndex()].insert(edgeVariables.begin(), edgeVariables.end());
+            }
+            hyperedges.push_back(std::move(edgeVariables));
+        }
+    }
+    for (auto& actionVariables : actionToVariables) {
+        hyperedges.push_back(std::move(actionVariables.second));
+    }
+    return computeForceVariableOrder(variables, hyperedges);
+}
+
+}  // namespace builder
+}  // namespace storm
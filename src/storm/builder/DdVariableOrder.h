@@ -0,0 +1,53 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+
+namespace prism {
+class Program;
+}
+namespace jani {
+class Model;
+}
+
+namespace builder {
+
+/*!
+ * Orders the given variables with the FORCE heuristic such that variables that occur in the same hyperedge are placed close to each other. Starting from
+ * the given order, each variable is repeatedly moved to the average center of gravity of its hyperedges until the total span of the hyperedges no longer
+ * decreases.
+ *
+ * @param variables The variables in their initial order.
+ * @param hyperedges Sets of variables that are accessed together. Variables not contained in the given variables are ignored.
+ * @return The variables in the computed order.
+ */
+std::vector<storm::expressions::Variable> computeForceVariableOrder(std::vector<storm::expressions::Variable> const& variables,
+                                                                   std::vector<std::set<storm::expressions::Variable>> const& hyperedges);
+
+/*!
+ * Retrieves the variables of the program in the order in which the symbolic model builder creates their meta variables.
+ *
+ * @param program The program whose variables to order.
+ * @param useStaticOrder If set, the variables are ordered by the FORCE heuristic where each command and each synchronizing action constitutes a
+ * hyperedge. Otherwise, the variables are returned in declaration order.
+ */
+std::vector<storm::expressions::Variable> getDdVariableOrder(storm::prism::Program const& program, bool useStaticOrder);
+
+/*!
+ * Retrieves the location variables of the given automata and the non-transient variables of the model in the order in which the symbolic model builder
+ * creates their meta variables.
+ *
+ * @param model The model whose variables to order.
+ * @param automata The names of the automata in the system composition.
+ * @param useStaticOrder If set, the variables are ordered by the FORCE heuristic where each edge and each non-silent action constitutes a hyperedge.
+ * Otherwise, the location variables are followed by the global variables and the variables of each automaton in declaration order.
+ */
+std::vector<storm::expressions::Variable> getDdVariableOrder(storm::jani::Model const& model, std::set<std::string> const& automata, bool useStaticOrder);
+
+}  // namespace builder
+}  // namespace storm
@@ -1,5 +1,6 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
 #include <map>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -30,6 +31,8 @@
 #include "storm/storage/jani/ParallelComposition.h"
 
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/MemoryAccounting.h"
+#include "storm/utility/Profiling.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
@@ -89,6 +92,7 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::build() {
+    STORM_PROFILE_SCOPE("build");
     STORM_LOG_DEBUG("Exploration order is: " << options.explorationOrder);
 
     switch (generator->getModelType()) {
@@ -113,6 +117,17 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Explic
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex(CompressedState const& state) {
+    if (generator->isSymmetryReductionEnabled()) {
+        // Symmetric states are identified by their representative.
+        CompressedState canonicalState(state);
+        generator->canonicalizeState(canonicalState);
+        return getOrAddCanonicalStateIndex(canonicalState);
+    }
+    return getOrAddCanonicalStateIndex(state);
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddCanonicalStateIndex(CompressedState const& state) {
     StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
 
     // Check, if the state was already registered.
@@ -146,6 +161,7 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
     std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
     StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+    STORM_PROFILE_SCOPE("explore");
     // Initialize building state valuations (if necessary)
     if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
         stateAndChoiceInformationBuilder.stateValuationsBuilder() = generator->initializeStateValuationsBuilder();
@@ -166,6 +182,12 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
     STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
                     "The model does not have a single initial state.");
+    if (generator->isSymmetryReductionEnabled()) {
+        // Symmetric initial states share their representative.
+        std::sort(this->stateStorage.initialStateIndices.begin(), this->stateStorage.initialStateIndices.end());
+        this->stateStorage.initialStateIndices.erase(std::unique(this->stateStorage.initialStateIndices.begin(), this->stateStorage.initialStateIndices.end()),
+                                                     this->stateStorage.initialStateIndices.end());
+    }
 
     // Now explore the current state until there is no more reachable state.
     uint_fast64_t currentRowGroup = 0;
@@ -321,13 +343,14 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             }
         }
 
-        if (storm::utility::resources::isTerminate()) {
+        if (storm::utility::memory::isSoftLimitExceeded() || storm::utility::resources::isTerminate()) {
             auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
             std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
             STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
             break;
         }
     }
+    STORM_PROFILE_COUNT("explored states", numberOfExploredStates);
 
     // If the exploration order was not breadth-first, we need to fix the entries in the matrix according to
     // (reversed) mapping of row groups to indices.
@@ -378,6 +401,7 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     stateAndChoiceInformationBuilder.setBuildStateValuations(generator->getOptions().isBuildStateValuationsSet());
 
     buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+    storm::utility::memory::recordStructureSize("state storage", stateStorage.stateToId.getSizeInBytes());
 
     // Initialize the model components with the obtained information.
     storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(
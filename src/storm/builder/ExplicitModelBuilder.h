@@ -120,7 +120,7 @@ class ExplicitModelBuilder {
 
     /*!
      * Export a wrapper that contains (a copy of) the internal information that maps states to ids.
-     * This wrapper can be helpful to find states in later stages.
+     * This wrapper can be helpful to find states in later stages. If the exploration is symmetry-reduced, it only contains canonical states.
      * @return
      */
     ExplicitStateLookup<StateType> exportExplicitStateLookup() const;
@@ -137,6 +137,11 @@ class ExplicitModelBuilder {
      */
     StateType getOrAddStateIndex(CompressedState const& state);
 
+    /*!
+     * Retrieves the state id of the given state, which is already canonicalized (if the exploration is symmetry-reduced).
+     */
+    StateType getOrAddCanonicalStateIndex(CompressedState const& state);
+
     /*!
      * Builds the transition matrix and the transition reward matrix based for the given program.
      *
@@ -66,8 +66,9 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ParallelCompositionBuild
             if (labelingB.containsLabel(label)) {
                 // Only consider labels contained in both CTMCs
                 storm::storage::BitVector labelStates(size, false);
-                for (auto entryA : labelingA.getStates(label)) {
-                    for (auto entryB : labelingB.getStates(label)) {
+                storm::storage::CompressedBitVector const& labelStatesB = labelingB.getCompressedStates(label);
+                for (auto entryA : labelingA.getCompressedStates(label)) {
+                    for (auto entryB : labelStatesB) {
                         labelStates.set(entryA * sizeB + entryB);
                     }
                 }
@@ -81,15 +82,16 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ParallelCompositionBuild
                 // Initial states must be initial in both CTMCs
                 STORM_LOG_ASSERT(labelingB.containsLabel(label), "B does not have init.");
                 storm::storage::BitVector labelStates(size, false);
-                for (auto entryA : labelingA.getStates(label)) {
-                    for (auto entryB : labelingB.getStates(label)) {
+                storm::storage::CompressedBitVector const& labelStatesB = labelingB.getCompressedStates(label);
+                for (auto entryA : labelingA.getCompressedStates(label)) {
+                    for (auto entryB : labelStatesB) {
                         labelStates.set(entryA * sizeB + entryB);
                     }
                 }
                 labeling.addLabel(label, labelStates);
             } else {
                 storm::storage::BitVector labelStates(size, false);
-                for (auto entry : labelingA.getStates(label)) {
+                for (auto entry : labelingA.getCompressedStates(label)) {
                     for (size_t index = entry * sizeB; index < entry * sizeB + sizeB; ++index) {
                         labelStates.set(index, true);
                     }
@@ -104,14 +106,14 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ParallelCompositionBuild
             }
             if (labeling.containsLabel(label)) {
                 // Label is already there from A
-                for (auto entry : labelingB.getStates(label)) {
+                for (auto entry : labelingB.getCompressedStates(label)) {
                     for (size_t index = 0; index < sizeA; ++index) {
                         labeling.addLabelToState(label, index * sizeB + entry);
                     }
                 }
             } else {
                 storm::storage::BitVector labelStates(size, false);
-                for (auto entry : labelingB.getStates(label)) {
+                for (auto entry : labelingB.getCompressedStates(label)) {
                     for (size_t index = 0; index < sizeA; ++index) {
                         labelStates.set(index * sizeB + entry, true);
                     }
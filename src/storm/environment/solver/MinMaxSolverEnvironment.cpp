@@ -25,6 +25,7 @@ MinMaxSolverEnvironment::MinMaxSolverEnvironment() {
                      "Unknown convergence criterion");
     multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
     forceRequireUnique = minMaxSettings.isForceUniqueSolutionRequirementSet();
+    mixedPrecision = minMaxSettings.isMixedPrecisionSet();
 }
 
 MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -84,4 +85,12 @@ void MinMaxSolverEnvironment::setForceRequireUnique(bool value) {
     forceRequireUnique = value;
 }
 
+bool MinMaxSolverEnvironment::isMixedPrecision() const {
+    return mixedPrecision;
+}
+
+void MinMaxSolverEnvironment::setMixedPrecision(bool value) {
+    mixedPrecision = value;
+}
+
 }  // namespace storm
@@ -148,6 +148,7 @@ std::pair<boost::optional<storm::RationalNumber>, boost::optional<bool>> SolverE
             result.second = native().getRelativeTerminationCriterion();
             break;
         case storm::solver::EquationSolverType::Elimination:
+        case storm::solver::EquationSolverType::PAdic:
             break;
         case storm::solver::EquationSolverType::Topological:
             result = getPrecisionOfLinearEquationSolver(topological().getUnderlyingEquationSolverType());
@@ -165,13 +166,14 @@ void SolverEnvironment::setLinearEquationSolverPrecision(boost::optional<storm::
                          getLinearEquationSolverType() == storm::solver::EquationSolverType::Gmmxx ||
                          getLinearEquationSolverType() == storm::solver::EquationSolverType::Eigen ||
                          getLinearEquationSolverType() == storm::solver::EquationSolverType::Elimination ||
+                         getLinearEquationSolverType() == storm::solver::EquationSolverType::PAdic ||
                          getLinearEquationSolverType() == storm::solver::EquationSolverType::Topological,
                      "The current solver type is not respected in this method.");
     if (newPrecision) {
         native().setPrecision(newPrecision.get());
         gmmxx().setPrecision(newPrecision.get());
         eigen().setPrecision(newPrecision.get());
-        // Elimination and Topological solver do not have a precision
+        // Elimination, p-adic, and Topological solver do not have a precision
     }
     if (relativePrecision) {
         native().setRelativeTerminationCriterion(relativePrecision.get());
@@ -0,0 +1,175 @@
+#include "storm/generator/CommandGuardIndex.h"
+
+#include <map>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/OperatorType.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+// Tables for variables with larger domains are not built.
+uint64_t const maximalNumberOfValues = 1ull << 16;
+
+struct VariablePosition {
+    uint64_t bitOffset;
+    uint64_t bitWidth;
+    int64_t lowerBound;
+    int64_t upperBound;
+};
+
+void collectConjuncts(storm::expressions::Expression const& expression, std::vector<storm::expressions::Expression>& conjuncts) {
+    if (expression.isFunctionApplication() && expression.getOperator() == storm::expressions::OperatorType::And) {
+        for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            collectConjuncts(expression.getOperand(operandIndex), conjuncts);
+        }
+    } else {
+        conjuncts.push_back(expression);
+    }
+}
+
+// Checks whether the given conjunct is of the form x=k (for an integer or boolean k), x or !x and, if so, sets the variable and the value.
+bool isValueTest(storm::expressions::Expression const& conjunct, storm::expressions::Variable& variable, int64_t& value) {
+    if (conjunct.isVariable()) {
+        if (!conjunct.hasBooleanType()) {
+            return false;
+        }
+        variable = *conjunct.getVariables().begin();
+        value = 1;
+        return true;
+    }
+    if (!conjunct.isFunctionApplication() || conjunct.getArity() == 0) {
+        return false;
+    }
+    if (conjunct.getOperator() == storm::expressions::OperatorType::Not && conjunct.getOperand(0).isVariable()) {
+        variable = *conjunct.getOperand(0).getVariables().begin();
+        value = 0;
+        return true;
+    }
+    if (conjunct.getOperator() == storm::expressions::OperatorType::Equal || conjunct.getOperator() == storm::expressions::OperatorType::Iff) {
+        for (uint64_t variableOperand = 0; variableOperand < 2; ++variableOperand) {
+            storm::expressions::Expression const& variableExpression = conjunct.getOperand(variableOperand);
+            storm::expressions::Expression const& valueExpression = conjunct.getOperand(1 - variableOperand);
+            if (variableExpression.isVariable() && !valueExpression.containsVariables()) {
+                variable = *variableExpression.getVariables().begin();
+                // Comparisons with rational values (e.g. x=N/2) are not indexed, as the value can not be evaluated as an integer.
+                if (variableExpression.hasBooleanType() && valueExpression.hasBooleanType()) {
+                    value = valueExpression.evaluateAsBool() ? 1 : 0;
+                    return true;
+                } else if (variableExpression.hasIntegerType() && valueExpression.hasIntegerType()) {
+                    value = valueExpression.evaluateAsInt();
+                    return true;
+                }
+                return false;
+            }
+        }
+    }
+    return false;
+}
+}  // namespace
+
+CommandGuardIndex::CommandGuardIndex(storm::prism::Program const& program, VariableInformation const& variableInformation) {
+    std::map<storm::expressions::Variable, VariablePosition> variablePositions;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        variablePositions[booleanVariable.variable] = {booleanVariable.bitOffset, 1, 0, 1};
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        uint64_t numberOfValues = static_cast<uint64_t>(integerVariable.upperBound - integerVariable.lowerBound) + 1;
+        if (integerVariable.bitWidth > 0 && integerVariable.lowerBound < integerVariable.upperBound && numberOfValues <= maximalNumberOfValues) {
+            variablePositions[integerVariable.variable] = {integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound,
+                                                           integerVariable.upperBound};
+        }
+    }
+
+    for (auto const& module : program.getModules()) {
+        uint64_t numberOfCommands = module.getNumberOfCommands();
+
+        // Collect the value tests of each command and count how often each variable is tested.
+        std::vector<std::map<storm::expressions::Variable, int64_t>> commandTests(numberOfCommands);
+        std::map<storm::expressions::Variable, uint64_t> testCounts;
+        for (uint64_t commandIndex = 0; commandIndex < numberOfCommands; ++commandIndex) {
+            std::vector<storm::expressions::Expression> conjuncts;
+            collectConjuncts(module.getCommand(commandIndex).getGuardExpression(), conjuncts);
+            for (auto const& conjunct : conjuncts) {
+                storm::expressions::Variable variable;
+                int64_t value;
+                if (isValueTest(conjunct, variable, value)) {
+                    auto positionIt = variablePositions.find(variable);
+                    // Tests of values outside of the domain are ignored.
+                    if (positionIt != variablePositions.end() && positionIt->second.lowerBound <= value && value <= positionIt->second.upperBound &&
+                        commandTests[commandIndex].emplace(variable, value).second) {
+                        ++testCounts[variable];
+                    }
+                }
+            }
+        }
+
+        // A variable is only worth indexing if it is tested by at least two commands.
+        ModuleIndex moduleIndex;
+        storm::expressions::Variable discriminatingVariable;
+        uint64_t maximalTestCount = 1;
+        for (auto const& variableCount : testCounts) {
+            if (variableCount.second > maximalTestCount) {
+                discriminatingVariable = variableCount.first;
+                maximalTestCount = variableCount.second;
+            }
+        }
+        if (maximalTestCount == 1) {
+            moduleIndex.bitOffset = 0;
+            moduleIndex.bitWidth = 0;
+            moduleIndex.buckets.emplace_back(numberOfCommands, true);
+            moduleIndices.push_back(std::move(moduleIndex));
+            continue;
+        }
+
+        VariablePosition const& position = variablePositions.at(discriminatingVariable);
+        moduleIndex.bitOffset = position.bitOffset;
+        moduleIndex.bitWidth = position.bitWidth;
+        moduleIndex.valueToBucket.assign(static_cast<uint64_t>(position.upperBound - position.lowerBound) + 1, 0);
+        storm::storage::BitVector untestedCommands(numberOfCommands);
+        for (uint64_t commandIndex = 0; commandIndex < numberOfCommands; ++commandIndex) {
+            if (commandTests[commandIndex].count(discriminatingVariable) == 0) {
+                untestedCommands.set(commandIndex);
+            }
+        }
+        moduleIndex.buckets.push_back(untestedCommands);
+        for (uint64_t commandIndex = 0; commandIndex < numberOfCommands; ++commandIndex) {
+            auto testIt = commandTests[commandIndex].find(discriminatingVariable);
+            if (testIt == commandTests[commandIndex].end()) {
+                continue;
+            }
+            uint64_t& bucket = moduleIndex.valueToBucket[static_cast<uint64_t>(testIt->second - position.lowerBound)];
+            if (bucket == 0) {
+                bucket = moduleIndex.buckets.size();
+                moduleIndex.buckets.push_back(untestedCommands);
+            }
+            moduleIndex.buckets[bucket].set(commandIndex);
+        }
+        moduleIndices.push_back(std::move(moduleIndex));
+    }
+}
+
+storm::storage::BitVector const& CommandGuardIndex::getPotentiallyEnabledCommands(uint64_t moduleIndex, CompressedState const& state) const {
+    ModuleIndex const& index = moduleIndices[moduleIndex];
+    if (index.valueToBucket.empty()) {
+        return index.buckets.front();
+    }
+    // Values outside of the domain (e.g. in the out-of-bounds state) violate all tests.
+    uint64_t value = state.getAsInt(index.bitOffset, index.bitWidth);
+    return value < index.valueToBucket.size() ? index.buckets[index.valueToBucket[value]] : index.buckets.front();
+}
+
+uint64_t CommandGuardIndex::getNumberOfIndexedModules() const {
+    uint64_t result = 0;
+    for (auto const& moduleIndex : moduleIndices) {
+        if (!moduleIndex.valueToBucket.empty()) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * An index that determines the commands of each module of a PRISM program that are possibly enabled in a given state without evaluating their guards.
+ *
+ * For each module, the variable that is tested most often by guard conjuncts of the form x=k (or x and !x for boolean variables) is selected as the
+ * discriminating variable of the module (typically a local program counter). The commands of the module are then bucketed by the value they require
+ * for this variable, which yields a jump table from the value of the variable in a state to the commands whose guards are not trivially violated.
+ */
+class CommandGuardIndex {
+   public:
+    /*!
+     * Builds the index for the given program.
+     *
+     * @param program The program (whose constants and formulas are substituted).
+     * @param variableInformation Information about how the variables are packed within the states.
+     */
+    CommandGuardIndex(storm::prism::Program const& program, VariableInformation const& variableInformation);
+
+    /*!
+     * Retrieves the (module-local) indices of the commands of the given module whose guards are not violated by the value of the discriminating variable
+     * in the given state. The guards of these commands still need to be evaluated.
+     */
+    storm::storage::BitVector const& getPotentiallyEnabledCommands(uint64_t moduleIndex, CompressedState const& state) const;
+
+    /*!
+     * Retrieves the number of modules for which a discriminating variable was found.
+     */
+    uint64_t getNumberOfIndexedModules() const;
+
+   private:
+    struct ModuleIndex {
+        // The position of the discriminating variable within the states.
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+
+        // Maps the (packed) value of the discriminating variable to its bucket. Empty if the module has no discriminating variable.
+        std::vector<uint64_t> valueToBucket;
+
+        // The commands of each bucket. The first bucket contains the commands that do not test the discriminating variable.
+        std::vector<storm::storage::BitVector> buckets;
+    };
+
+    std::vector<ModuleIndex> moduleIndices;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -56,6 +56,10 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
       evaluateRewardExpressionsAtDestinations(false) {
     STORM_LOG_THROW(!this->options.isBuildChoiceLabelsSet(), storm::exceptions::NotSupportedException,
                     "JANI next-state generator cannot generate choice labels.");
+    STORM_LOG_WARN_COND(!this->options.isSymmetryReductionSet(),
+                        "Symmetry reduction is only supported for PRISM programs. The full state space of the JANI model is explored.");
+    STORM_LOG_WARN_COND(!this->options.isPartialOrderReductionSet(),
+                        "Partial-order reduction is only supported for PRISM programs. The full state space of the JANI model is explored.");
 
     auto features = this->model.getModelFeatures();
     features.remove(storm::jani::ModelFeature::DerivedOperators);
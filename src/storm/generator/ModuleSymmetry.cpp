@@ -0,0 +1,360 @@
+#include "storm/generator/ModuleSymmetry.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <unordered_map>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/OperatorType.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+typedef std::map<storm::expressions::Variable, storm::expressions::Expression> VariableSubstitution;
+typedef std::map<uint64_t, uint64_t> ActionRenaming;
+
+struct PackedVariable {
+    uint64_t bitOffset;
+    uint64_t bitWidth;
+    int64_t lowerBound;
+    int64_t upperBound;
+};
+
+bool isAssociativeAndCommutative(storm::expressions::OperatorType const& operatorType) {
+    using storm::expressions::OperatorType;
+    return operatorType == OperatorType::And || operatorType == OperatorType::Or || operatorType == OperatorType::Plus || operatorType == OperatorType::Times ||
+           operatorType == OperatorType::Min || operatorType == OperatorType::Max;
+}
+
+bool isCommutative(storm::expressions::OperatorType const& operatorType) {
+    using storm::expressions::OperatorType;
+    return isAssociativeAndCommutative(operatorType) || operatorType == OperatorType::Equal || operatorType == OperatorType::NotEqual ||
+           operatorType == OperatorType::Iff || operatorType == OperatorType::Xor;
+}
+
+std::string canonicalString(storm::expressions::Expression const& expression);
+
+void collectOperands(storm::expressions::Expression const& expression, storm::expressions::OperatorType const& operatorType,
+                     std::vector<std::string>& operands) {
+    if (expression.isFunctionApplication() && expression.getOperator() == operatorType) {
+        for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            collectOperands(expression.getOperand(operandIndex), operatorType, operands);
+        }
+    } else {
+        operands.push_back(canonicalString(expression));
+    }
+}
+
+std::string join(std::vector<std::string>&& strings, std::string const& separator, bool sort) {
+    if (sort) {
+        std::sort(strings.begin(), strings.end());
+    }
+    std::stringstream stream;
+    for (uint64_t index = 0; index < strings.size(); ++index) {
+        stream << (index == 0 ? "" : separator) << strings[index];
+    }
+    return stream.str();
+}
+
+/*!
+ * Computes a string representation of the expression that is the same for expressions that only differ in the order of the operands of commutative
+ * operators. Hence, equal strings imply equivalent expressions (but not vice versa).
+ */
+std::string canonicalString(storm::expressions::Expression const& expression) {
+    if (!expression.isFunctionApplication()) {
+        return expression.toString();
+    }
+    auto operatorType = expression.getOperator();
+    std::vector<std::string> operands;
+    if (isAssociativeAndCommutative(operatorType)) {
+        collectOperands(expression, operatorType, operands);
+    } else {
+        for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            operands.push_back(canonicalString(expression.getOperand(operandIndex)));
+        }
+    }
+    std::stringstream stream;
+    stream << operatorType << "(" << join(std::move(operands), ",", isCommutative(operatorType)) << ")";
+    return stream.str();
+}
+
+std::string canonicalString(storm::expressions::Expression const& expression, VariableSubstitution const& substitution) {
+    return canonicalString(substitution.empty() ? expression : expression.substitute(substitution));
+}
+
+std::string actionString(bool isLabeled, uint64_t actionIndex, ActionRenaming const& actionRenaming) {
+    if (!isLabeled) {
+        return "[]";
+    }
+    auto renamedIt = actionRenaming.find(actionIndex);
+    return "[" + std::to_string(renamedIt == actionRenaming.end() ? actionIndex : renamedIt->second) + "]";
+}
+
+std::string canonicalString(storm::prism::Module const& module, VariableSubstitution const& substitution, ActionRenaming const& actionRenaming) {
+    std::vector<std::string> commands;
+    for (auto const& command : module.getCommands()) {
+        std::vector<std::string> updates;
+        for (auto const& update : command.getUpdates()) {
+            std::vector<std::string> assignments;
+            for (auto const& assignment : update.getAssignments()) {
+                assignments.push_back(canonicalString(assignment.getVariable().getExpression(), substitution) + ":=" +
+                                      canonicalString(assignment.getExpression(), substitution));
+            }
+            updates.push_back(canonicalString(update.getLikelihoodExpression(), substitution) + ":" + join(std::move(assignments), "&", true));
+        }
+        commands.push_back(actionString(command.isLabeled(), command.getActionIndex(), actionRenaming) + (command.isMarkovian() ? "M" : "") +
+                           canonicalString(command.getGuardExpression(), substitution) + "->" + join(std::move(updates), "+", true));
+    }
+    return join(std::move(commands), "\n", true);
+}
+
+std::string canonicalString(storm::prism::RewardModel const& rewardModel, VariableSubstitution const& substitution, ActionRenaming const& actionRenaming) {
+    std::vector<std::string> items;
+    for (auto const& reward : rewardModel.getStateRewards()) {
+        items.push_back("S" + canonicalString(reward.getStatePredicateExpression(), substitution) + ":" +
+                        canonicalString(reward.getRewardValueExpression(), substitution));
+    }
+    for (auto const& reward : rewardModel.getStateActionRewards()) {
+        items.push_back("A" + actionString(reward.isLabeled(), reward.getActionIndex(), actionRenaming) +
+                        canonicalString(reward.getStatePredicateExpression(), substitution) + ":" +
+                        canonicalString(reward.getRewardValueExpression(), substitution));
+    }
+    for (auto const& reward : rewardModel.getTransitionRewards()) {
+        items.push_back("T" + actionString(reward.isLabeled(), reward.getActionIndex(), actionRenaming) +
+                        canonicalString(reward.getSourceStatePredicateExpression(), substitution) + "->" +
+                        canonicalString(reward.getTargetStatePredicateExpression(), substitution) + ":" +
+                        canonicalString(reward.getRewardValueExpression(), substitution));
+    }
+    return join(std::move(items), "\n", true);
+}
+
+std::vector<storm::expressions::Variable> getVariables(storm::prism::Module const& module) {
+    std::vector<storm::expressions::Variable> result;
+    for (auto const& variable : module.getBooleanVariables()) {
+        result.push_back(variable.getExpressionVariable());
+    }
+    for (auto const& variable : module.getIntegerVariables()) {
+        result.push_back(variable.getExpressionVariable());
+    }
+    return result;
+}
+
+/*!
+ * Checks whether the candidate module has the same shape (variables and commands) as the base module and, if so, retrieves the positional mapping of the
+ * actions of the base module to the actions of the candidate.
+ */
+std::optional<ActionRenaming> matchShape(storm::prism::Module const& base, storm::prism::Module const& candidate,
+                                         std::unordered_map<storm::expressions::Variable, PackedVariable> const& packedVariables) {
+    if (candidate.getNumberOfClockVariables() > 0 || base.getNumberOfBooleanVariables() != candidate.getNumberOfBooleanVariables() ||
+        base.getNumberOfIntegerVariables() != candidate.getNumberOfIntegerVariables() || base.getNumberOfCommands() != candidate.getNumberOfCommands()) {
+        return std::nullopt;
+    }
+    for (uint64_t index = 0; index < base.getNumberOfIntegerVariables(); ++index) {
+        auto const& baseVariable = packedVariables.at(base.getIntegerVariables()[index].getExpressionVariable());
+        auto const& candidateVariable = packedVariables.at(candidate.getIntegerVariables()[index].getExpressionVariable());
+        if (baseVariable.lowerBound != candidateVariable.lowerBound || baseVariable.upperBound != candidateVariable.upperBound) {
+            return std::nullopt;
+        }
+    }
+    ActionRenaming actionRenaming, inverseActionRenaming;
+    for (uint64_t index = 0; index < base.getNumberOfCommands(); ++index) {
+        auto const& baseCommand = base.getCommand(index);
+        auto const& candidateCommand = candidate.getCommand(index);
+        if (baseCommand.isLabeled() != candidateCommand.isLabeled()) {
+            return std::nullopt;
+        }
+        if (baseCommand.isLabeled()) {
+            auto actionIt = actionRenaming.emplace(baseCommand.getActionIndex(), candidateCommand.getActionIndex()).first;
+            auto inverseActionIt = inverseActionRenaming.emplace(candidateCommand.getActionIndex(), baseCommand.getActionIndex()).first;
+            if (actionIt->second != candidateCommand.getActionIndex() || inverseActionIt->second != baseCommand.getActionIndex()) {
+                return std::nullopt;
+            }
+        }
+    }
+    return actionRenaming;
+}
+
+VariableSubstitution swapVariables(std::vector<storm::expressions::Variable> const& first, std::vector<storm::expressions::Variable> const& second) {
+    VariableSubstitution result;
+    for (uint64_t index = 0; index < first.size(); ++index) {
+        result.emplace(first[index], second[index].getExpression());
+        result.emplace(second[index], first[index].getExpression());
+    }
+    return result;
+}
+
+/*!
+ * Retrieves the renaming that swaps the actions of two modules (given by the mappings from the actions of the base module), if this is a proper swap.
+ */
+std::optional<ActionRenaming> swapActions(ActionRenaming const& first, ActionRenaming const& second) {
+    ActionRenaming result;
+    for (auto const& baseAndAction : first) {
+        uint64_t firstAction = baseAndAction.second;
+        uint64_t secondAction = second.at(baseAndAction.first);
+        if (firstAction == secondAction) {
+            continue;
+        }
+        auto firstIt = result.emplace(firstAction, secondAction).first;
+        auto secondIt = result.emplace(secondAction, firstAction).first;
+        if (firstIt->second != secondAction || secondIt->second != firstAction) {
+            return std::nullopt;
+        }
+    }
+    return result;
+}
+}  // namespace
+
+ModuleSymmetry::ModuleSymmetry(storm::prism::Program const& program, VariableInformation const& variableInformation,
+                               std::vector<storm::expressions::Expression> const& stateExpressions,
+                               std::vector<std::reference_wrapper<storm::prism::RewardModel const>> const& rewardModels) {
+    std::unordered_map<storm::expressions::Variable, PackedVariable> packedVariables;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        packedVariables.emplace(booleanVariable.variable, PackedVariable{booleanVariable.bitOffset, 1, 0, 1});
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        packedVariables.emplace(integerVariable.variable,
+                                PackedVariable{integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, integerVariable.upperBound});
+    }
+
+    auto const& modules = program.getModules();
+    std::vector<std::string> moduleStrings;
+    for (auto const& module : modules) {
+        moduleStrings.push_back(canonicalString(module, {}, {}));
+    }
+    std::vector<std::string> expressionStrings;
+    for (auto const& expression : stateExpressions) {
+        expressionStrings.push_back(canonicalString(expression));
+    }
+    std::vector<std::string> rewardModelStrings;
+    for (auto const& rewardModel : rewardModels) {
+        rewardModelStrings.push_back(canonicalString(rewardModel.get(), {}, {}));
+    }
+
+    std::vector<bool> grouped(modules.size(), false);
+    for (uint64_t baseIndex = 0; baseIndex < modules.size(); ++baseIndex) {
+        auto const& base = modules[baseIndex];
+        if (grouped[baseIndex] || base.getNumberOfClockVariables() > 0 || base.getNumberOfBooleanVariables() + base.getNumberOfIntegerVariables() == 0) {
+            continue;
+        }
+
+        // Collect the modules that coincide with the base module when swapping their variables and actions positionally.
+        std::vector<uint64_t> members = {baseIndex};
+        std::vector<std::vector<storm::expressions::Variable>> blockVariables = {getVariables(base)};
+        std::vector<ActionRenaming> blockActions = {*matchShape(base, base, packedVariables)};
+        for (uint64_t candidateIndex = baseIndex + 1; candidateIndex < modules.size(); ++candidateIndex) {
+            if (grouped[candidateIndex]) {
+                continue;
+            }
+            auto actionRenaming = matchShape(base, modules[candidateIndex], packedVariables);
+            if (!actionRenaming) {
+                continue;
+            }
+            auto candidateVariables = getVariables(modules[candidateIndex]);
+            auto actionSwap = swapActions(blockActions.front(), *actionRenaming);
+            if (actionSwap &&
+                canonicalString(modules[candidateIndex], swapVariables(blockVariables.front(), candidateVariables), *actionSwap) == moduleStrings[baseIndex]) {
+                members.push_back(candidateIndex);
+                blockVariables.push_back(std::move(candidateVariables));
+                blockActions.push_back(std::move(*actionRenaming));
+            }
+        }
+        if (members.size() < 2) {
+            continue;
+        }
+        for (auto const& member : members) {
+            grouped[member] = true;
+        }
+
+        // Check that swapping adjacent modules of the group (which generates all permutations) maps the program to itself.
+        bool symmetric = true;
+        for (uint64_t block = 0; symmetric && block + 1 < members.size(); ++block) {
+            auto variableSwap = swapVariables(blockVariables[block], blockVariables[block + 1]);
+            auto actionSwap = swapActions(blockActions[block], blockActions[block + 1]);
+            if (!actionSwap) {
+                symmetric = false;
+                break;
+            }
+            for (uint64_t moduleIndex = 0; symmetric && moduleIndex < modules.size(); ++moduleIndex) {
+                uint64_t expectedModuleIndex = moduleIndex;
+                if (moduleIndex == members[block]) {
+                    expectedModuleIndex = members[block + 1];
+                } else if (moduleIndex == members[block + 1]) {
+                    expectedModuleIndex = members[block];
+                }
+                symmetric = canonicalString(modules[moduleIndex], variableSwap, *actionSwap) == moduleStrings[expectedModuleIndex];
+            }
+            for (uint64_t index = 0; symmetric && index < stateExpressions.size(); ++index) {
+                symmetric = canonicalString(stateExpressions[index], variableSwap) == expressionStrings[index];
+            }
+            for (uint64_t index = 0; symmetric && index < rewardModels.size(); ++index) {
+                symmetric = canonicalString(rewardModels[index].get(), variableSwap, *actionSwap) == rewardModelStrings[index];
+            }
+        }
+
+        std::vector<std::string> moduleNames;
+        for (auto const& member : members) {
+            moduleNames.push_back(modules[member].getName());
+        }
+        if (!symmetric) {
+            STORM_LOG_WARN("The modules " << join(std::move(moduleNames), ", ", false)
+                                          << " have the same structure but the program (including labels and reward models) is not symmetric in them.");
+            continue;
+        }
+
+        SymmetricGroup group;
+        group.moduleNames = std::move(moduleNames);
+        for (auto const& variable : blockVariables.front()) {
+            group.bitWidths.push_back(packedVariables.at(variable).bitWidth);
+        }
+        for (auto const& variables : blockVariables) {
+            for (auto const& variable : variables) {
+                group.bitOffsets.push_back(packedVariables.at(variable).bitOffset);
+            }
+        }
+        groups.push_back(std::move(group));
+    }
+}
+
+uint64_t ModuleSymmetry::getNumberOfGroups() const {
+    return groups.size();
+}
+
+std::vector<std::string> const& ModuleSymmetry::getModuleNames(uint64_t group) const {
+    return groups[group].moduleNames;
+}
+
+void ModuleSymmetry::canonicalize(CompressedState& state) const {
+    for (auto const& group : groups) {
+        uint64_t const numberOfBlocks = group.moduleNames.size();
+        uint64_t const blockSize = group.bitWidths.size();
+        values.resize(numberOfBlocks * blockSize);
+        for (uint64_t index = 0; index < values.size(); ++index) {
+            values[index] = state.getAsInt(group.bitOffsets[index], group.bitWidths[index % blockSize]);
+        }
+
+        order.resize(numberOfBlocks);
+        std::iota(order.begin(), order.end(), 0);
+        auto blockLess = [this, blockSize](uint64_t first, uint64_t second) {
+            return std::lexicographical_compare(values.begin() + first * blockSize, values.begin() + (first + 1) * blockSize,
+                                                values.begin() + second * blockSize, values.begin() + (second + 1) * blockSize);
+        };
+        if (std::is_sorted(order.begin(), order.end(), blockLess)) {
+            continue;
+        }
+        std::sort(order.begin(), order.end(), blockLess);
+        for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+            for (uint64_t variable = 0; variable < blockSize; ++variable) {
+                state.setFromInt(group.bitOffsets[block * blockSize + variable], group.bitWidths[variable], values[order[block] * blockSize + variable]);
+            }
+        }
+    }
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace prism {
+class Program;
+class RewardModel;
+}  // namespace prism
+
+namespace generator {
+struct VariableInformation;
+
+/*!
+ * Detects groups of fully symmetric modules of a PRISM program (typically created by module renaming, e.g. the processes of a mutual exclusion protocol)
+ * and canonicalizes states under permutations of the variable blocks of these modules. Exploring only canonical states yields the quotient model, which
+ * preserves all properties that are symmetric in the modules of each group.
+ *
+ * A group is only considered symmetric if swapping the variables (and the renamed actions) of any two of its modules maps the program to itself. This
+ * includes all other modules as well as the given state expressions (labels, terminal states) and reward models. As renamings are not retained after
+ * substituting constants and formulas, the candidates for a group are identified structurally, i.e., by modules that coincide after swapping their
+ * variables and actions positionally.
+ */
+class ModuleSymmetry {
+   public:
+    /*!
+     * Detects the groups of symmetric modules.
+     *
+     * @param program The program (whose constants and formulas are substituted).
+     * @param variableInformation Information about how the variables are packed within the states.
+     * @param stateExpressions Expressions (e.g. of the labels to build) that need to be invariant under the symmetry.
+     * @param rewardModels The reward models to build, which need to be invariant under the symmetry.
+     */
+    ModuleSymmetry(storm::prism::Program const& program, VariableInformation const& variableInformation,
+                   std::vector<storm::expressions::Expression> const& stateExpressions,
+                   std::vector<std::reference_wrapper<storm::prism::RewardModel const>> const& rewardModels);
+
+    /*!
+     * Retrieves the number of detected groups of symmetric modules.
+     */
+    uint64_t getNumberOfGroups() const;
+
+    /*!
+     * Retrieves the names of the modules of the given group.
+     */
+    std::vector<std::string> const& getModuleNames(uint64_t group) const;
+
+    /*!
+     * Replaces the given state by the representative of its symmetry class, i.e., the variable blocks of the modules of each group are sorted.
+     * Note that this is not thread-safe as it uses internal buffers.
+     *
+     * @param state The state to canonicalize.
+     */
+    void canonicalize(CompressedState& state) const;
+
+   private:
+    struct SymmetricGroup {
+        // The names of the modules in the group.
+        std::vector<std::string> moduleNames;
+
+        // The bit offsets of the variables of each module (in the order of the variables of the first module).
+        std::vector<uint64_t> bitOffsets;
+
+        // The bit widths of the variables (which are the same for every module).
+        std::vector<uint64_t> bitWidths;
+    };
+
+    std::vector<SymmetricGroup> groups;
+
+    // Buffers used when canonicalizing a state.
+    mutable std::vector<uint64_t> values;
+    mutable std::vector<uint64_t> order;
+};
+
+}  // namespace generator
+}  // namespace storm
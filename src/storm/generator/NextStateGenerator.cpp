@@ -130,6 +130,18 @@ VariableInformation const& NextStateGenerator<ValueType, StateType>::getVariable
     return variableInformation;
 }
 
+template<typename ValueType, typename StateType>
+bool NextStateGenerator<ValueType, StateType>::isSymmetryReductionEnabled() const {
+    return static_cast<bool>(moduleSymmetry);
+}
+
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::canonicalizeState(CompressedState& state) const {
+    if (moduleSymmetry) {
+        moduleSymmetry->canonicalize(state);
+    }
+}
+
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::addStateValuation(storm::storage::sparse::state_type const& currentStateIndex,
                                                                  storm::storage::sparse::StateValuationsBuilder& valuationsBuilder) const {
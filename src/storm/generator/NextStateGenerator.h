@@ -16,6 +16,7 @@
 #include "storm/builder/RewardModelInformation.h"
 
 #include "storm/generator/CompressedState.h"
+#include "storm/generator/ModuleSymmetry.h"
 #include "storm/generator/StateBehavior.h"
 #include "storm/generator/VariableInformation.h"
 
@@ -130,6 +131,16 @@ class NextStateGenerator {
 
     VariableInformation const& getVariableInformation() const;
 
+    /*!
+     * Retrieves whether states are only explored up to symmetric modules. If so, states have to be canonicalized before they are looked up.
+     */
+    bool isSymmetryReductionEnabled() const;
+
+    /*!
+     * Replaces the given state by the representative of its symmetry class (if symmetry reduction is enabled).
+     */
+    void canonicalizeState(CompressedState& state) const;
+
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const;
 
     /*!
@@ -205,6 +216,9 @@ class NextStateGenerator {
     boost::optional<std::vector<uint64_t>> overlappingGuardStates;
 
     std::shared_ptr<ActionMask<ValueType, StateType>> actionMask;
+
+    /// The groups of symmetric modules (if symmetry reduction is enabled and there are any).
+    std::unique_ptr<ModuleSymmetry> moduleSymmetry;
 };
 }  // namespace generator
 }  // namespace storm
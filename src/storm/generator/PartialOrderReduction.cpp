@@ -0,0 +1,139 @@
+#include "storm/generator/PartialOrderReduction.h"
+
+#include <map>
+#include <set>
+
+#include "storm/storage/expressions/OperatorType.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+typedef std::set<storm::expressions::Variable> VariableSet;
+
+struct CommandVariables {
+    VariableSet read;
+    VariableSet written;
+};
+
+bool intersects(VariableSet const& first, VariableSet const& second) {
+    auto firstIt = first.begin();
+    auto secondIt = second.begin();
+    while (firstIt != first.end() && secondIt != second.end()) {
+        if (*firstIt < *secondIt) {
+            ++firstIt;
+        } else if (*secondIt < *firstIt) {
+            ++secondIt;
+        } else {
+            return true;
+        }
+    }
+    return false;
+}
+
+void collectConjuncts(storm::expressions::Expression const& expression, std::vector<storm::expressions::Expression>& conjuncts) {
+    if (expression.isFunctionApplication() && expression.getOperator() == storm::expressions::OperatorType::And) {
+        for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            collectConjuncts(expression.getOperand(operandIndex), conjuncts);
+        }
+    } else {
+        conjuncts.push_back(expression);
+    }
+}
+}  // namespace
+
+PartialOrderReduction::PartialOrderReduction(storm::prism::Program const& program, std::vector<storm::expressions::Expression> const& visibleExpressions) {
+    auto const& modules = program.getModules();
+
+    // Gather the variables that are read and written by each command as well as the modules writing each variable.
+    std::vector<std::vector<CommandVariables>> commandVariables(modules.size());
+    std::map<storm::expressions::Variable, std::set<uint64_t>> writingModules;
+    for (uint64_t moduleIndex = 0; moduleIndex < modules.size(); ++moduleIndex) {
+        for (auto const& command : modules[moduleIndex].getCommands()) {
+            CommandVariables variables;
+            variables.read = command.getGuardExpression().getVariables();
+            for (auto const& update : command.getUpdates()) {
+                auto likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                variables.read.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                for (auto const& assignment : update.getAssignments()) {
+                    auto assignedVariables = assignment.getExpression().getVariables();
+                    variables.read.insert(assignedVariables.begin(), assignedVariables.end());
+                    variables.written.insert(assignment.getVariable());
+                    writingModules[assignment.getVariable()].insert(moduleIndex);
+                }
+            }
+            commandVariables[moduleIndex].push_back(std::move(variables));
+        }
+    }
+    VariableSet visibleVariables;
+    for (auto const& expression : visibleExpressions) {
+        auto variables = expression.getVariables();
+        visibleVariables.insert(variables.begin(), variables.end());
+    }
+
+    // Retrieves the conjunction of the conjuncts of the guard that can only change if the given module moves (if there are any).
+    auto getFrozenGuardPart = [&writingModules](storm::prism::Command const& command, uint64_t moduleIndex) {
+        std::vector<storm::expressions::Expression> conjuncts, frozenConjuncts;
+        collectConjuncts(command.getGuardExpression(), conjuncts);
+        for (auto const& conjunct : conjuncts) {
+            bool frozen = true;
+            for (auto const& variable : conjunct.getVariables()) {
+                auto writingModulesIt = writingModules.find(variable);
+                if (writingModulesIt != writingModules.end() &&
+                    (writingModulesIt->second.size() > 1 || *writingModulesIt->second.begin() != moduleIndex)) {
+                    frozen = false;
+                    break;
+                }
+            }
+            if (frozen) {
+                frozenConjuncts.push_back(conjunct);
+            }
+        }
+        return frozenConjuncts.empty() ? storm::expressions::Expression() : storm::expressions::conjunction(frozenConjuncts);
+    };
+
+    for (uint64_t moduleIndex = 0; moduleIndex < modules.size(); ++moduleIndex) {
+        for (uint64_t commandIndex = 0; commandIndex < modules[moduleIndex].getNumberOfCommands(); ++commandIndex) {
+            auto const& command = modules[moduleIndex].getCommand(commandIndex);
+            auto const& variables = commandVariables[moduleIndex][commandIndex];
+            if (program.getPossiblySynchronizingCommands().get(command.getGlobalIndex()) || command.isMarkovian() ||
+                intersects(variables.written, visibleVariables)) {
+                continue;
+            }
+
+            // All dependent commands need to be disabled until the module moves.
+            bool isCandidate = true;
+            std::vector<storm::expressions::Expression> conflicts;
+            for (uint64_t otherModuleIndex = 0; isCandidate && otherModuleIndex < modules.size(); ++otherModuleIndex) {
+                for (uint64_t otherCommandIndex = 0; otherCommandIndex < modules[otherModuleIndex].getNumberOfCommands(); ++otherCommandIndex) {
+                    if (otherModuleIndex == moduleIndex && otherCommandIndex == commandIndex) {
+                        continue;
+                    }
+                    auto const& otherVariables = commandVariables[otherModuleIndex][otherCommandIndex];
+                    if (otherModuleIndex != moduleIndex && !intersects(variables.written, otherVariables.read) &&
+                        !intersects(variables.written, otherVariables.written) && !intersects(variables.read, otherVariables.written)) {
+                        continue;
+                    }
+                    auto frozenGuardPart = getFrozenGuardPart(modules[otherModuleIndex].getCommand(otherCommandIndex), moduleIndex);
+                    if (!frozenGuardPart.isInitialized()) {
+                        isCandidate = false;
+                        break;
+                    }
+                    conflicts.push_back(frozenGuardPart);
+                }
+            }
+            if (isCandidate) {
+                ampleCandidates.push_back(
+                    {moduleIndex, commandIndex, conflicts.empty() ? storm::expressions::Expression() : storm::expressions::disjunction(conflicts)});
+            }
+        }
+    }
+}
+
+std::vector<PartialOrderReduction::AmpleCandidate> const& PartialOrderReduction::getAmpleCandidates() const {
+    return ampleCandidates;
+}
+
+}  // namespace generator
+}  // namespace storm
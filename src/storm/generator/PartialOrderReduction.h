@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace generator {
+
+/*!
+ * Static independence information of the commands of a PRISM program that is used for a partial-order reduction of the explored MDP.
+ *
+ * In a given state, a single asynchronous command c of module M constitutes an ample set, if
+ *  - c is enabled and invisible, i.e., it does not write variables occurring in the given visible expressions,
+ *  - every command that is dependent on c (i.e., all other commands of M and all commands of other modules that read or write variables written by c or
+ *    that write variables read by c) is disabled and remains disabled as long as M does not move. The latter is ensured by a conjunct of its guard that
+ *    only refers to variables that are written by M exclusively and evaluates to false.
+ * Together with the cycle proviso (which needs to be checked during the exploration), this preserves the maximal and minimal probabilities of
+ * (unbounded) LTL properties without next operator whose atomic propositions are among the visible expressions.
+ */
+class PartialOrderReduction {
+   public:
+    struct AmpleCandidate {
+        // The index of the module and the index of the command within the module.
+        uint64_t moduleIndex;
+        uint64_t commandIndex;
+
+        // An expression that is satisfied if one of the dependent commands is possibly enabled (uninitialized if there is no dependent command).
+        storm::expressions::Expression conflicts;
+    };
+
+    /*!
+     * Determines the commands that might constitute an ample set.
+     *
+     * @param program The program (whose constants and formulas are substituted).
+     * @param visibleExpressions The expressions whose values need to be preserved (e.g. the labels to build).
+     */
+    PartialOrderReduction(storm::prism::Program const& program, std::vector<storm::expressions::Expression> const& visibleExpressions);
+
+    /*!
+     * Retrieves the commands that might constitute an ample set.
+     */
+    std::vector<AmpleCandidate> const& getAmpleCandidates() const;
+
+   private:
+    std::vector<AmpleCandidate> ampleCandidates;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -1,5 +1,7 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <algorithm>
+
 #include <boost/any.hpp>
 #include <boost/container/flat_map.hpp>
 
@@ -46,6 +48,8 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
     this->checkValid();
     this->variableInformation = VariableInformation(program, options.getReservedBitsForUnboundedVariables(), options.isAddOutOfBoundsStateSet());
     this->initializeSpecialStates();
+    commandGuardIndex = std::make_unique<CommandGuardIndex>(this->program, this->variableInformation);
+    STORM_LOG_TRACE("Indexed the commands of " << commandGuardIndex->getNumberOfIndexedModules() << " modules by a discriminating variable.");
 
     // Create a proper evaluator.
     this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
@@ -101,6 +105,88 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
         moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
         actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
     }
+
+    if (this->options.isSymmetryReductionSet()) {
+        initializeModuleSymmetry();
+    }
+
+    if (this->options.isPartialOrderReductionSet()) {
+        initializePartialOrderReduction();
+    }
+}
+
+template<typename ValueType, typename StateType>
+std::vector<storm::expressions::Expression> PrismNextStateGenerator<ValueType, StateType>::getVisibleExpressions() const {
+    std::vector<storm::expressions::Expression> result;
+    if (this->options.isBuildAllLabelsSet()) {
+        for (auto const& label : program.getLabels()) {
+            result.push_back(label.getStatePredicateExpression());
+        }
+    } else {
+        for (auto const& labelName : this->options.getLabelNames()) {
+            if (program.hasLabel(labelName)) {
+                result.push_back(program.getLabelExpression(labelName));
+            }
+        }
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        result.push_back(expressionLabel.second);
+    }
+    for (auto const& expressionBool : this->terminalStates) {
+        result.push_back(expressionBool.first);
+    }
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::initializeModuleSymmetry() {
+    if (program.getModelType() == storm::prism::Program::ModelType::POMDP || program.getModelType() == storm::prism::Program::ModelType::SMG) {
+        STORM_LOG_WARN("Symmetry reduction is not supported for partially observable models and games. The full state space is explored.");
+        return;
+    }
+
+    // The labels and terminal states must not distinguish between symmetric modules.
+    auto symmetry = std::make_unique<ModuleSymmetry>(program, this->variableInformation, getVisibleExpressions(), rewardModels);
+    if (symmetry->getNumberOfGroups() == 0) {
+        STORM_LOG_WARN("Symmetry reduction is enabled but the program has no symmetric modules. The full state space is explored.");
+        return;
+    }
+    for (uint64_t group = 0; group < symmetry->getNumberOfGroups(); ++group) {
+        std::stringstream moduleNames;
+        for (auto const& moduleName : symmetry->getModuleNames(group)) {
+            moduleNames << " " << moduleName;
+        }
+        STORM_LOG_INFO("Exploring the state space up to permutations of the symmetric modules" << moduleNames.str() << ".");
+    }
+    this->moduleSymmetry = std::move(symmetry);
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::initializePartialOrderReduction() {
+    if (program.getModelType() != storm::prism::Program::ModelType::MDP) {
+        STORM_LOG_WARN("Partial-order reduction is only supported for MDPs. The full state space is explored.");
+        return;
+    }
+    if (!rewardModels.empty()) {
+        STORM_LOG_WARN("Partial-order reduction does not preserve rewards. The full state space is explored.");
+        return;
+    }
+    if (this->actionMask != nullptr) {
+        STORM_LOG_WARN("Partial-order reduction is not supported in combination with action masks. The full state space is explored.");
+        return;
+    }
+    if (this->moduleSymmetry) {
+        STORM_LOG_WARN("Partial-order reduction is not supported in combination with symmetry reduction. The full state space is explored.");
+        return;
+    }
+
+    auto reduction = std::make_unique<PartialOrderReduction>(program, getVisibleExpressions());
+    if (reduction->getAmpleCandidates().empty()) {
+        STORM_LOG_WARN("Partial-order reduction is enabled but no command is independent of the others. The full state space is explored.");
+        return;
+    }
+    STORM_LOG_INFO("Partial-order reduction may expand states by " << reduction->getAmpleCandidates().size() << " independent commands only.");
+    partialOrderReduction = std::move(reduction);
 }
 
 template<typename ValueType, typename StateType>
@@ -310,7 +396,12 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     result.setExpanded();
 
     std::vector<Choice<ValueType>> allChoices;
-    if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
+    if (partialOrderReduction) {
+        allChoices = getAmpleChoices(*this->state, stateToIdCallback);
+    }
+    if (!allChoices.empty()) {
+        // The state is only expanded by a single ample command.
+    } else if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
         allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
         addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
@@ -483,12 +574,16 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
 
 struct ActiveCommandData {
     ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr,
-                      typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt)
-        : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+                      storm::storage::BitVector const* potentiallyEnabledCommandsPtr, typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt)
+        : modulePtr(modulePtr),
+          commandIndicesPtr(commandIndicesPtr),
+          potentiallyEnabledCommandsPtr(potentiallyEnabledCommandsPtr),
+          currentCommandIndexIt(currentCommandIndexIt) {
         // Intentionally left empty
     }
     storm::prism::Module const* modulePtr;
     std::set<uint_fast64_t> const* commandIndicesPtr;
+    storm::storage::BitVector const* potentiallyEnabledCommandsPtr;
     typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
 };
 
@@ -519,8 +614,12 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
         }
 
         // Look up commands by their indices and check if the guard evaluates to true in the given state.
+        storm::storage::BitVector const& potentiallyEnabledCommands = commandGuardIndex->getPotentiallyEnabledCommands(i, *this->state);
         bool hasOneEnabledCommand = false;
         for (auto commandIndexIt = commandIndices.begin(), commandIndexIte = commandIndices.end(); commandIndexIt != commandIndexIte; ++commandIndexIt) {
+            if (!potentiallyEnabledCommands.get(*commandIndexIt)) {
+                continue;
+            }
             storm::prism::Command const& command = module.getCommand(*commandIndexIt);
             if (!isCommandPotentiallySynchronizing(command)) {
                 continue;
@@ -534,7 +633,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
             if (this->evaluator->asBool(command.getGuardExpression())) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
-                activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
+                activeCommands.emplace_back(&module, &commandIndices, &potentiallyEnabledCommands, commandIndexIt);
                 break;
             }
         }
@@ -558,6 +657,9 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
         // Look up commands by their indices and add them if the guard evaluates to true in the given state.
         auto commandIndexIte = activeCommand.commandIndicesPtr->end();
         for (++commandIndexIt; commandIndexIt != commandIndexIte; ++commandIndexIt) {
+            if (!activeCommand.potentiallyEnabledCommandsPtr->get(*commandIndexIt)) {
+                continue;
+            }
             storm::prism::Command const& command = activeCommand.modulePtr->getCommand(*commandIndexIt);
             if (commandFilter != CommandFilter::All) {
                 STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
@@ -587,8 +689,8 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
     for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
         storm::prism::Module const& module = program.getModule(i);
 
-        // Iterate over all commands.
-        for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+        // Iterate over all commands whose guards are not already violated by the value of the discriminating variable of the module.
+        for (auto j : commandGuardIndex->getPotentiallyEnabledCommands(i, state)) {
             storm::prism::Command const& command = module.getCommand(j);
 
             // Only consider commands that are not possibly synchronizing.
@@ -612,67 +714,109 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
                 continue;
             }
 
-            result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-            Choice<ValueType>& choice = result.back();
+            result.push_back(createAsynchronousChoice(i, command, state, stateToIdCallback));
+        }
+    }
 
-            // Remember the choice origin only if we were asked to.
-            if (this->options.isBuildChoiceOriginsSet()) {
-                CommandSet commandIndex{command.getGlobalIndex()};
-                choice.addOriginData(boost::any(std::move(commandIndex)));
-            }
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+Choice<ValueType> PrismNextStateGenerator<ValueType, StateType>::createAsynchronousChoice(uint64_t moduleIndex, storm::prism::Command const& command,
+                                                                                         CompressedState const& state, StateToIdCallback stateToIdCallback) {
+    Choice<ValueType> choice(command.getActionIndex(), command.isMarkovian());
+
+    // Remember the choice origin only if we were asked to.
+    if (this->options.isBuildChoiceOriginsSet()) {
+        CommandSet commandIndex{command.getGlobalIndex()};
+        choice.addOriginData(boost::any(std::move(commandIndex)));
+    }
 
-            // Iterate over all updates of the current command.
-            ValueType probabilitySum = storm::utility::zero<ValueType>();
-            for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
-                storm::prism::Update const& update = command.getUpdate(k);
+    // Iterate over all updates of the current command.
+    ValueType probabilitySum = storm::utility::zero<ValueType>();
+    for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
+        storm::prism::Update const& update = command.getUpdate(k);
 
-                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
-                if (probability != storm::utility::zero<ValueType>()) {
-                    // Obtain target state index and add it to the list of known states. If it has not yet been
-                    // seen, we also add it to the set of states that have yet to be explored.
-                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+        if (probability != storm::utility::zero<ValueType>()) {
+            // Obtain target state index and add it to the list of known states. If it has not yet been
+            // seen, we also add it to the set of states that have yet to be explored.
+            StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
 
-                    // Update the choice by adding the probability/target state to it.
-                    choice.addProbability(stateIndex, probability);
-                    if (this->options.isExplorationChecksSet()) {
-                        probabilitySum += probability;
-                    }
-                }
+            // Update the choice by adding the probability/target state to it.
+            choice.addProbability(stateIndex, probability);
+            if (this->options.isExplorationChecksSet()) {
+                probabilitySum += probability;
             }
+        }
+    }
 
-            // Create the state-action reward for the newly created choice.
-            for (auto const& rewardModel : rewardModels) {
-                ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                if (rewardModel.get().hasStateActionRewards()) {
-                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                        if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                            this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                            stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                        }
-                    }
+    // Create the state-action reward for the newly created choice.
+    for (auto const& rewardModel : rewardModels) {
+        ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
+        if (rewardModel.get().hasStateActionRewards()) {
+            for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
+                    this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
+                    stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
                 }
-                choice.addReward(stateActionRewardValue);
             }
+        }
+        choice.addReward(stateActionRewardValue);
+    }
 
-            if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
-                choice.addLabel(program.getActionName(command.getActionIndex()));
-            }
+    if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
+        choice.addLabel(program.getActionName(command.getActionIndex()));
+    }
 
-            if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
-                storm::storage::PlayerIndex const& playerOfModule = moduleIndexToPlayerIndexMap.at(i);
-                STORM_LOG_THROW(playerOfModule != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException,
-                                "Module " << module.getName() << " is not owned by any player but has at least one enabled, unlabeled command.");
-                choice.setPlayerIndex(playerOfModule);
-            }
+    if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
+        storm::storage::PlayerIndex const& playerOfModule = moduleIndexToPlayerIndexMap.at(moduleIndex);
+        STORM_LOG_THROW(playerOfModule != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException,
+                        "Module " << program.getModule(moduleIndex).getName()
+                                  << " is not owned by any player but has at least one enabled, unlabeled command.");
+        choice.setPlayerIndex(playerOfModule);
+    }
 
-            if (this->options.isExplorationChecksSet()) {
-                // Check that the resulting distribution is in fact a distribution.
-                STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException,
-                                "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
-            }
-        }
+    if (this->options.isExplorationChecksSet()) {
+        // Check that the resulting distribution is in fact a distribution.
+        STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException,
+                        "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
     }
 
+    return choice;
+}
+
+template<typename ValueType, typename StateType>
+std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAmpleChoices(CompressedState const& state,
+                                                                                              StateToIdCallback const& stateToIdCallback) {
+    std::vector<Choice<ValueType>> result;
+    StateType currentStateIndex = stateToIdCallback(state);
+    if (currentStateIndex >= expandedStates.size()) {
+        expandedStates.resize(std::max<uint64_t>(currentStateIndex + 1, 2 * expandedStates.size()));
+    }
+    expandedStates.set(currentStateIndex);
+
+    for (auto const& candidate : partialOrderReduction->getAmpleCandidates()) {
+        storm::prism::Command const& command = program.getModule(candidate.moduleIndex).getCommand(candidate.commandIndex);
+        if (!this->evaluator->asBool(command.getGuardExpression()) || (candidate.conflicts.isInitialized() && this->evaluator->asBool(candidate.conflicts))) {
+            continue;
+        }
+
+        // The cycle proviso: every cycle of the reduced model needs to contain a fully expanded state. This is the case if the ample set of a state
+        // never leads to a state that has already been expanded.
+        bool onlyUnexpandedSuccessors = true;
+        StateToIdCallback provisoCallback = [this, &stateToIdCallback, &onlyUnexpandedSuccessors](CompressedState const& successor) {
+            StateType successorIndex = stateToIdCallback(successor);
+            onlyUnexpandedSuccessors &= successorIndex >= expandedStates.size() || !expandedStates.get(successorIndex);
+            return successorIndex;
+        };
+        Choice<ValueType> choice = createAsynchronousChoice(candidate.moduleIndex, command, state, provisoCallback);
+        if (onlyUnexpandedSuccessors) {
+            result.push_back(std::move(choice));
+        }
+        // Otherwise, the state is fully expanded (which also covers the successors that were just discovered).
+        break;
+    }
     return result;
 }
 
@@ -1,7 +1,9 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include "storm/generator/CommandGuardIndex.h"
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/PartialOrderReduction.h"
 
 #include "storm/storage/BoostTypes.h"
 #include "storm/storage/prism/Program.h"
@@ -51,6 +53,29 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
    private:
     void checkValid() const;
 
+    /*!
+     * Retrieves the expressions whose values are observed in the built model, i.e., the labels to build and the terminal states.
+     */
+    std::vector<storm::expressions::Expression> getVisibleExpressions() const;
+
+    /*!
+     * Detects the groups of symmetric modules under which states are canonicalized.
+     */
+    void initializeModuleSymmetry();
+
+    /*!
+     * Determines the static independence information of the commands that is needed for the partial-order reduction.
+     */
+    void initializePartialOrderReduction();
+
+    /*!
+     * Retrieves the choice of a single command that constitutes an ample set of the given state (if there is any).
+     *
+     * @param state The state for which to retrieve the ample set.
+     * @return The choice of the ample set or an empty vector if the state needs to be fully expanded.
+     */
+    std::vector<Choice<ValueType>> getAmpleChoices(CompressedState const& state, StateToIdCallback const& stateToIdCallback);
+
     /*!
      * A delegate constructor that is used to preprocess the program before the constructor of the superclass is
      * being called. The last argument is only present to distinguish the signature of this constructor from the
@@ -96,6 +121,12 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     std::vector<Choice<ValueType>> getAsynchronousChoices(CompressedState const& state, StateToIdCallback stateToIdCallback,
                                                           CommandFilter const& commandFilter = CommandFilter::All);
 
+    /*!
+     * Creates the choice of the given (enabled) asynchronous command.
+     */
+    Choice<ValueType> createAsynchronousChoice(uint64_t moduleIndex, storm::prism::Command const& command, CompressedState const& state,
+                                               StateToIdCallback stateToIdCallback);
+
     /*!
      * Retrieves all (potentially) synchronous choices possible from the given state.
      * Note that these may include choices that run asynchronously for this state.
@@ -138,6 +169,15 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    // The index used to skip commands whose guards are violated by the value of a discriminating variable.
+    std::unique_ptr<CommandGuardIndex> commandGuardIndex;
+
+    // The independence information of the commands (if the partial-order reduction is enabled).
+    std::unique_ptr<PartialOrderReduction> partialOrderReduction;
+
+    // The indices of the states that were expanded so far, which is needed to check the cycle proviso of the partial-order reduction.
+    storm::storage::BitVector expandedStates;
 };
 
 }  // namespace generator
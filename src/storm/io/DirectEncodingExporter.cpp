@@ -1,6 +1,17 @@
 #include "storm/io/DirectEncodingExporter.h"
 #include <storm/exceptions/NotSupportedException.h>
 
+#include <array>
+#include <charconv>
+#include <limits>
+#include <sstream>
+
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -8,6 +19,8 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -16,6 +29,159 @@
 namespace storm {
 namespace exporter {
 
+namespace {
+// The number of states that are formatted at once when exporting in parallel.
+uint64_t const numberOfStatesPerChunk = 1024;
+
+/*!
+ * Writes the given value such that it can be restored exactly.
+ */
+void writeRoundTripValue(std::ostream& os, double value) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    // Write the shortest representation from which the value can be restored exactly.
+    std::array<char, 32> buffer;
+    auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    STORM_LOG_ASSERT(result.ec == std::errc(), "Unable to format value " << value << ".");
+    os.write(buffer.data(), result.ptr - buffer.data());
+#else
+    // Floating point to_chars is not available in this standard library, so we write enough digits to restore the value exactly.
+    std::streamsize oldPrecision = os.precision(std::numeric_limits<double>::max_digits10);
+    os << value;
+    os.precision(oldPrecision);
+#endif
+}
+}  // namespace
+
+template<>
+void writeValue(std::ostream& os, double value, std::unordered_map<double, std::string> const&) {
+    writeRoundTripValue(os, value);
+}
+
+template<>
+void writeValue(std::ostream& os, storm::Interval value, std::unordered_map<storm::Interval, std::string> const&) {
+    if (value.lowerBoundType() == carl::BoundType::INFTY || value.upperBoundType() == carl::BoundType::INFTY) {
+        os << value;
+        return;
+    }
+    os << (value.lowerBoundType() == carl::BoundType::STRICT ? '(' : '[');
+    writeRoundTripValue(os, value.lower());
+    os << ", ";
+    writeRoundTripValue(os, value.upper());
+    os << (value.upperBoundType() == carl::BoundType::STRICT ? ')' : ']');
+}
+
+/*!
+ * Writes the given state including its choices and transitions.
+ */
+template<typename ValueType>
+void writeState(std::ostream& os, storm::models::sparse::Model<ValueType> const& sparseModel, uint64_t group, std::vector<ValueType> const& exitRates,
+                std::unordered_map<ValueType, std::string> const& placeholders) {
+    storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel.getTransitionMatrix();
+    os << "state " << group;
+
+    // Write exit rates for CTMCs and MAs
+    if (!exitRates.empty()) {
+        os << " !";
+        writeValue(os, exitRates.at(group), placeholders);
+    }
+
+    if (sparseModel.getType() == storm::models::ModelType::Pomdp) {
+        os << " {" << static_cast<storm::models::sparse::Pomdp<ValueType> const&>(sparseModel).getObservation(group) << "}";
+    }
+
+    // Write state rewards
+    bool first = true;
+    for (auto const& rewardModelEntry : sparseModel.getRewardModels()) {
+        if (first) {
+            os << " [";
+            first = false;
+        } else {
+            os << ", ";
+        }
+
+        if (rewardModelEntry.second.hasStateRewards()) {
+            writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
+        } else {
+            os << "0";
+        }
+    }
+
+    if (!first) {
+        os << "]";
+    }
+
+    // Write labels. Only labels with a whitespace are put in (double) quotation marks.
+    for (auto const& label : sparseModel.getStateLabeling().getLabelsOfState(group)) {
+        STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
+                        "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
+        // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
+        if (std::count_if(label.begin(), label.end(), isspace) > 0) {
+            os << " \"" << label << "\"";
+        } else {
+            os << " " << label;
+        }
+    }
+    os << '\n';
+    // Write state valuations as comments
+    if (sparseModel.hasStateValuations()) {
+        os << "//" << sparseModel.getStateValuations().getStateInfo(group) << '\n';
+    }
+
+    // Write probabilities
+    typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
+    typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+
+    // Iterate over all actions
+    for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
+        // Write choice
+        if (sparseModel.hasChoiceLabeling()) {
+            os << "\taction ";
+            bool lfirst = true;
+            if (sparseModel.getChoiceLabeling().getLabelsOfChoice(row).empty()) {
+                os << "__NOLABEL__";
+            }
+            for (auto const& label : sparseModel.getChoiceLabeling().getLabelsOfChoice(row)) {
+                if (!lfirst) {
+                    os << "_";
+                    lfirst = false;
+                }
+                os << label;
+            }
+        } else {
+            os << "\taction " << row - start;
+        }
+
+        // Write action rewards
+        bool first = true;
+        for (auto const& rewardModelEntry : sparseModel.getRewardModels()) {
+            if (first) {
+                os << " [";
+                first = false;
+            } else {
+                os << ", ";
+            }
+
+            if (rewardModelEntry.second.hasStateActionRewards()) {
+                writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
+            } else {
+                os << "0";
+            }
+        }
+        if (!first) {
+            os << "]";
+        }
+        os << '\n';
+
+        // Write transitions
+        for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
+            ValueType prob = it->getValue();
+            os << "\t\t" << it->getColumn() << " : ";
+            writeValue(os, prob, placeholders);
+            os << '\n';
+        }
+    }
+}
+
 template<typename ValueType>
 void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
                                std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
@@ -69,113 +235,48 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
     os << "@model\n";
 
     storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
-
-    // Iterate over states and export state information and outgoing transitions
-    for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
-        os << "state " << group;
-
-        // Write exit rates for CTMCs and MAs
-        if (!exitRates.empty()) {
-            os << " !";
-            writeValue(os, exitRates.at(group), placeholders);
-        }
-
-        if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-            os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
-        }
-
-        // Write state rewards
-        bool first = true;
-        for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-            if (first) {
-                os << " [";
-                first = false;
-            } else {
-                os << ", ";
-            }
-
-            if (rewardModelEntry.second.hasStateRewards()) {
-                writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
-            } else {
-                os << "0";
-            }
-        }
-
-        if (!first) {
-            os << "]";
-        }
-
-        // Write labels. Only labels with a whitespace are put in (double) quotation marks.
-        for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
-            STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
-                            "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
-            // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
-            if (std::count_if(label.begin(), label.end(), isspace) > 0) {
-                os << " \"" << label << "\"";
-            } else {
-                os << " " << label;
-            }
-        }
-        os << '\n';
-        // Write state valuations as comments
-        if (sparseModel->hasStateValuations()) {
-            os << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
-        }
-
-        // Write probabilities
-        typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
-        typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
-
-        // Iterate over all actions
-        for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
-            // Write choice
-            if (sparseModel->hasChoiceLabeling()) {
-                os << "\taction ";
-                bool lfirst = true;
-                if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
-                    os << "__NOLABEL__";
-                }
-                for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
-                    if (!lfirst) {
-                        os << "_";
-                        lfirst = false;
+    uint64_t const numberOfStates = matrix.getRowGroupCount();
+
+    // Iterate over states and export state information and outgoing transitions.
+    // Rational functions are always written sequentially as printing them accesses carl's global variable pool.
+    bool parallelize = !std::is_same_v<ValueType, storm::RationalFunction> && numberOfStates > numberOfStatesPerChunk &&
+                       storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#ifdef STORM_HAVE_INTELTBB
+    if (parallelize) {
+        // Chunks of states are formatted into buffers in parallel and then written in order. Only a bounded window of chunks is kept in memory.
+        uint64_t const numberOfChunks = (numberOfStates + numberOfStatesPerChunk - 1) / numberOfStatesPerChunk;
+        uint64_t const chunksPerWindow = 4 * static_cast<uint64_t>(tbb::this_task_arena::max_concurrency());
+        std::vector<std::string> buffers(std::min(numberOfChunks, chunksPerWindow));
+        for (uint64_t firstChunk = 0; firstChunk < numberOfChunks; firstChunk += chunksPerWindow) {
+            uint64_t const endChunk = std::min(numberOfChunks, firstChunk + chunksPerWindow);
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(firstChunk, endChunk), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+                    // The chunks are formatted like the output stream itself.
+                    std::ostringstream chunkStream;
+                    chunkStream.flags(os.flags());
+                    chunkStream.precision(os.precision());
+                    chunkStream.imbue(os.getloc());
+                    uint64_t const endState = std::min(numberOfStates, (chunk + 1) * numberOfStatesPerChunk);
+                    for (uint64_t group = chunk * numberOfStatesPerChunk; group < endState; ++group) {
+                        writeState(chunkStream, *sparseModel, group, exitRates, placeholders);
                     }
-                    os << label;
+                    buffers[chunk - firstChunk] = chunkStream.str();
                 }
-            } else {
-                os << "\taction " << row - start;
-            }
-
-            // Write action rewards
-            bool first = true;
-            for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-                if (first) {
-                    os << " [";
-                    first = false;
-                } else {
-                    os << ", ";
-                }
-
-                if (rewardModelEntry.second.hasStateActionRewards()) {
-                    writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
-                } else {
-                    os << "0";
-                }
-            }
-            if (!first) {
-                os << "]";
-            }
-            os << '\n';
-
-            // Write transitions
-            for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
-                ValueType prob = it->getValue();
-                os << "\t\t" << it->getColumn() << " : ";
-                writeValue(os, prob, placeholders);
-                os << '\n';
+            });
+            for (uint64_t chunk = firstChunk; chunk < endChunk; ++chunk) {
+                os << buffers[chunk - firstChunk];
             }
         }
-    }  // end state iteration
+    }
+#else
+    STORM_LOG_WARN_COND(!parallelize, "Parallel export of the model requires Intel TBB.");
+    parallelize = false;
+#endif
+    if (!parallelize) {
+        for (uint64_t group = 0; group < numberOfStates; ++group) {
+            writeState(os, *sparseModel, group, exitRates, placeholders);
+        }
+    }
 }
 
 template<typename ValueType>
@@ -13,6 +13,8 @@ struct DirectEncodingOptions {
 };
 /*!
  * Exports a sparse model into the explicit DRN format.
+ * Floating point values are written in their shortest representation that parses back to the same value. If the use of Intel TBB is enabled,
+ * chunks of states of floating point models are formatted in parallel.
  *
  * @param os           Stream to export to
  * @param sparseModel  Model to export
@@ -0,0 +1,587 @@
+#include "storm/io/SparseModelCache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+// Identifies cache entries and their layout. The version needs to be increased whenever the layout changes.
+std::string const cacheMagic = "STORMSMC";
+uint64_t const cacheFormatVersion = 2;
+
+std::string getCacheFilename(std::string const& directory, SparseModelCacheKey const& key) {
+    return (std::filesystem::path(directory) / (key.name + ".smc")).string();
+}
+
+void writeUint(std::ostream& out, uint64_t value) {
+    out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+uint64_t readUint(std::istream& in) {
+    uint64_t value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of model cache entry.");
+    return value;
+}
+
+uint64_t getRemainingBytes(std::istream& in, uint64_t entrySize) {
+    uint64_t position = static_cast<uint64_t>(in.tellg());
+    STORM_LOG_THROW(position <= entrySize, storm::exceptions::WrongFormatException, "Unexpected end of model cache entry.");
+    return entrySize - position;
+}
+
+// Reads the number of elements of a subsequent sequence and checks that the remainder of the entry (of the given size in bytes) can hold it.
+// This way, corrupt entries are detected before any memory is allocated for the elements.
+uint64_t readLength(std::istream& in, uint64_t entrySize, uint64_t minimalBytesPerElement) {
+    uint64_t length = readUint(in);
+    STORM_LOG_THROW(length <= getRemainingBytes(in, entrySize) / minimalBytesPerElement, storm::exceptions::WrongFormatException,
+                    "Invalid length in model cache entry.");
+    return length;
+}
+
+void writeString(std::ostream& out, std::string const& value) {
+    writeUint(out, value.size());
+    out.write(value.data(), value.size());
+}
+
+std::string readString(std::istream& in, uint64_t entrySize) {
+    std::string value(readLength(in, entrySize, 1), '\0');
+    in.read(value.data(), value.size());
+    STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of model cache entry.");
+    return value;
+}
+
+template<typename IntegerType>
+void writeIntegerVector(std::ostream& out, std::vector<IntegerType> const& values) {
+    writeUint(out, values.size());
+    for (auto const& value : values) {
+        writeUint(out, static_cast<uint64_t>(value));
+    }
+}
+
+template<typename IntegerType>
+std::vector<IntegerType> readIntegerVector(std::istream& in, uint64_t entrySize) {
+    std::vector<IntegerType> values(readLength(in, entrySize, sizeof(uint64_t)));
+    for (auto& value : values) {
+        value = static_cast<IntegerType>(readUint(in));
+    }
+    return values;
+}
+
+void writeBitVector(std::ostream& out, storm::storage::BitVector const& bitVector) {
+    writeUint(out, bitVector.size());
+    for (uint64_t index = 0; index < bitVector.size(); index += 64) {
+        writeUint(out, bitVector.getAsInt(index, std::min<uint64_t>(64, bitVector.size() - index)));
+    }
+}
+
+storm::storage::BitVector readBitVector(std::istream& in, uint64_t entrySize) {
+    // Every (started) block of 64 bits occupies 8 bytes.
+    uint64_t bitCount = readUint(in);
+    uint64_t bucketCount = bitCount / 64 + (bitCount % 64 != 0 ? 1 : 0);
+    STORM_LOG_THROW(bucketCount <= getRemainingBytes(in, entrySize) / sizeof(uint64_t), storm::exceptions::WrongFormatException,
+                    "Invalid length in model cache entry.");
+    storm::storage::BitVector bitVector(bitCount);
+    for (uint64_t index = 0; index < bitVector.size(); index += 64) {
+        bitVector.setFromInt(index, std::min<uint64_t>(64, bitVector.size() - index), readUint(in));
+    }
+    return bitVector;
+}
+
+template<typename ValueType>
+std::string getValueTypeName();
+
+template<>
+std::string getValueTypeName<double>() {
+    return "double";
+}
+
+template<>
+std::string getValueTypeName<storm::RationalNumber>() {
+    return "rational";
+}
+
+void writeValue(std::ostream& out, double const& value) {
+    out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+void writeValue(std::ostream& out, storm::RationalNumber const& value) {
+    writeString(out, storm::utility::to_string(value));
+}
+
+template<typename ValueType>
+ValueType readValue(std::istream& in, uint64_t entrySize);
+
+template<>
+double readValue<double>(std::istream& in, uint64_t) {
+    double value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of model cache entry.");
+    return value;
+}
+
+template<>
+storm::RationalNumber readValue<storm::RationalNumber>(std::istream& in, uint64_t entrySize) {
+    return storm::utility::convertNumber<storm::RationalNumber>(readString(in, entrySize));
+}
+
+template<typename ValueType>
+void writeValueVector(std::ostream& out, std::vector<ValueType> const& values) {
+    writeUint(out, values.size());
+    for (auto const& value : values) {
+        writeValue(out, value);
+    }
+}
+
+template<typename ValueType>
+std::vector<ValueType> readValueVector(std::istream& in, uint64_t entrySize) {
+    // Both doubles and the length of the string representation of rational numbers occupy 8 bytes.
+    std::vector<ValueType> values(readLength(in, entrySize, sizeof(uint64_t)));
+    for (auto& value : values) {
+        value = readValue<ValueType>(in, entrySize);
+    }
+    return values;
+}
+
+template<typename ValueType>
+void writeMatrix(std::ostream& out, storm::storage::SparseMatrix<ValueType> const& matrix) {
+    writeUint(out, matrix.getColumnCount());
+    writeUint(out, matrix.hasTrivialRowGrouping() ? 0 : 1);
+    if (!matrix.hasTrivialRowGrouping()) {
+        writeIntegerVector(out, matrix.getRowGroupIndices());
+    }
+    writeUint(out, matrix.getRowCount());
+    writeUint(out, matrix.getEntryCount());
+    for (uint_fast64_t row = 0; row < matrix.getRowCount(); ++row) {
+        writeUint(out, matrix.getRow(row).getNumberOfEntries());
+    }
+    for (uint_fast64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            writeUint(out, entry.getColumn());
+            writeValue(out, entry.getValue());
+        }
+    }
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> readMatrix(std::istream& in, uint64_t entrySize) {
+    uint_fast64_t columnCount = readUint(in);
+    boost::optional<std::vector<uint_fast64_t>> rowGroupIndices;
+    if (readUint(in) != 0) {
+        rowGroupIndices = readIntegerVector<uint_fast64_t>(in, entrySize);
+    }
+    // Each row occupies 8 bytes for its number of entries and each entry occupies (at least) 16 bytes for its column and value.
+    std::vector<uint_fast64_t> rowIndications(readLength(in, entrySize, sizeof(uint64_t)) + 1, 0);
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(readLength(in, entrySize, 2 * sizeof(uint64_t)));
+    for (uint_fast64_t row = 1; row < rowIndications.size(); ++row) {
+        rowIndications[row] = rowIndications[row - 1] + readUint(in);
+    }
+    STORM_LOG_THROW(rowIndications.back() == columnsAndValues.size(), storm::exceptions::WrongFormatException, "Inconsistent matrix in model cache entry.");
+    for (auto& entry : columnsAndValues) {
+        uint_fast64_t column = readUint(in);
+        entry = storm::storage::MatrixEntry<uint_fast64_t, ValueType>(column, readValue<ValueType>(in, entrySize));
+    }
+    return storm::storage::SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+}
+
+void writeLabeling(std::ostream& out, storm::models::sparse::StateLabeling const& labeling) {
+    writeUint(out, labeling.getNumberOfItems());
+    std::set<std::string> labels = labeling.getLabels();
+    writeUint(out, labels.size());
+    for (auto const& label : labels) {
+        writeString(out, label);
+        writeBitVector(out, labeling.getStates(label));
+    }
+}
+
+void writeLabeling(std::ostream& out, storm::models::sparse::ChoiceLabeling const& labeling) {
+    writeUint(out, labeling.getNumberOfItems());
+    std::set<std::string> labels = labeling.getLabels();
+    writeUint(out, labels.size());
+    for (auto const& label : labels) {
+        writeString(out, label);
+        writeBitVector(out, labeling.getChoices(label));
+    }
+}
+
+template<typename LabelingType>
+LabelingType readLabeling(std::istream& in, uint64_t entrySize) {
+    LabelingType labeling(readUint(in));
+    uint64_t numberOfLabels = readUint(in);
+    for (uint64_t labelIndex = 0; labelIndex < numberOfLabels; ++labelIndex) {
+        std::string label = readString(in, entrySize);
+        labeling.addLabel(label, readBitVector(in, entrySize));
+    }
+    return labeling;
+}
+
+// Variables and observation labels are written in the order in which the valuations enumerate them, which is also the
+// order in which the builder needs to be fed with them when reading the valuations back.
+void writeStateValuations(std::ostream& out, storm::storage::sparse::StateValuations const& valuations) {
+    writeUint(out, valuations.getNumberOfStates());
+    if (valuations.getNumberOfStates() == 0) {
+        return;
+    }
+
+    std::vector<std::pair<std::string, uint64_t>> variables;
+    std::vector<std::string> labels;
+    auto const& firstValuation = valuations.at(0);
+    for (auto valIt = firstValuation.begin(); valIt != firstValuation.end(); ++valIt) {
+        if (valIt.isLabelAssignment()) {
+            labels.push_back(valIt.getLabel());
+        } else {
+            variables.emplace_back(valIt.getVariable().getName(), valIt.isBoolean() ? 0 : (valIt.isInteger() ? 1 : 2));
+        }
+    }
+    writeUint(out, variables.size());
+    for (auto const& variable : variables) {
+        writeString(out, variable.first);
+        writeUint(out, variable.second);
+    }
+    writeUint(out, labels.size());
+    for (auto const& label : labels) {
+        writeString(out, label);
+    }
+
+    for (uint64_t state = 0; state < valuations.getNumberOfStates(); ++state) {
+        auto const& valuation = valuations.at(state);
+        for (auto valIt = valuation.begin(); valIt != valuation.end(); ++valIt) {
+            if (valIt.isLabelAssignment()) {
+                writeUint(out, static_cast<uint64_t>(valIt.getLabelValue()));
+            } else if (valIt.isBoolean()) {
+                out.put(valIt.getBooleanValue() ? 1 : 0);
+            } else if (valIt.isInteger()) {
+                writeUint(out, static_cast<uint64_t>(valIt.getIntegerValue()));
+            } else {
+                writeValue(out, valIt.getRationalValue());
+            }
+        }
+    }
+}
+
+storm::storage::sparse::StateValuations readStateValuations(std::istream& in, uint64_t entrySize, storm::expressions::ExpressionManager const& manager) {
+    storm::storage::sparse::StateValuationsBuilder builder;
+    uint64_t numberOfStates = readUint(in);
+    if (numberOfStates == 0) {
+        return builder.build();
+    }
+
+    // Each variable occupies 8 bytes for the length of its name and 8 bytes for its type.
+    std::vector<uint64_t> variableTypes(readLength(in, entrySize, 2 * sizeof(uint64_t)));
+    for (auto& type : variableTypes) {
+        std::string name = readString(in, entrySize);
+        STORM_LOG_THROW(manager.hasVariable(name), storm::exceptions::WrongFormatException, "Unknown variable '" << name << "' in model cache entry.");
+        builder.addVariable(manager.getVariable(name));
+        type = readUint(in);
+    }
+    uint64_t numberOfLabels = readUint(in);
+    for (uint64_t labelIndex = 0; labelIndex < numberOfLabels; ++labelIndex) {
+        builder.addObservationLabel(readString(in, entrySize));
+    }
+
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::vector<bool> booleanValues;
+        std::vector<int64_t> integerValues;
+        std::vector<storm::RationalNumber> rationalValues;
+        std::vector<int64_t> labelValues;
+        for (auto const& type : variableTypes) {
+            if (type == 0) {
+                booleanValues.push_back(in.get() != 0);
+            } else if (type == 1) {
+                integerValues.push_back(static_cast<int64_t>(readUint(in)));
+            } else {
+                rationalValues.push_back(readValue<storm::RationalNumber>(in, entrySize));
+            }
+        }
+        for (uint64_t labelIndex = 0; labelIndex < numberOfLabels; ++labelIndex) {
+            labelValues.push_back(static_cast<int64_t>(readUint(in)));
+        }
+        builder.addState(state, std::move(booleanValues), std::move(integerValues), std::move(rationalValues), std::move(labelValues));
+    }
+    STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of model cache entry.");
+    return builder.build();
+}
+
+bool hasEmptyValuation(storm::storage::sparse::StateValuations const& valuations) {
+    for (uint64_t state = 0; state < valuations.getNumberOfStates(); ++state) {
+        if (valuations.isEmpty(state)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 64-bit FNV-1a hash. In contrast to std::hash, it is stable across platforms and standard library versions.
+uint64_t computeStableHash(std::string const& data) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char character : data) {
+        hash ^= character;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+}  // namespace
+
+SparseModelCacheKey computeSparseModelCacheKey(storm::storage::SymbolicModelDescription const& modelDescription, std::string const& constantDefinitions,
+                                               storm::builder::BuilderOptions const& options) {
+    std::stringstream description;
+    description << modelDescription << '\n';
+    description << "constants: " << constantDefinitions << '\n';
+
+    description << "rewards:";
+    if (options.isBuildAllRewardModelsSet()) {
+        description << " <all>";
+    }
+    for (auto const& name : options.getRewardModelNames()) {
+        description << " " << name;
+    }
+    description << "\nlabels:";
+    if (options.isBuildAllLabelsSet()) {
+        description << " <all>";
+    }
+    for (auto const& name : options.getLabelNames()) {
+        description << " " << name;
+    }
+    for (auto const& expressionLabel : options.getExpressionLabels()) {
+        description << " " << expressionLabel.first << "=" << expressionLabel.second;
+    }
+    description << "\nterminal:";
+    for (auto const& terminalStates : options.getTerminalStates()) {
+        if (terminalStates.first.isLabel()) {
+            description << " " << terminalStates.first.getLabel();
+        } else {
+            description << " " << terminalStates.first.getExpression();
+        }
+        description << "=" << terminalStates.second;
+    }
+    description << "\nflags: " << options.isApplyMaximalProgressAssumptionSet() << options.isBuildChoiceLabelsSet() << options.isBuildStateValuationsSet()
+                << options.isBuildObservationValuationsSet() << options.isExplorationChecksSet() << options.isInferObservationsFromActionsSet()
+                << options.isScaleAndLiftTransitionRewardsSet() << options.isAddOutOfBoundsStateSet() << options.isAddOverlappingGuardLabelSet()
+                << options.isSymmetryReductionSet() << options.isPartialOrderReductionSet() << " " << options.getReservedBitsForUnboundedVariables() << '\n';
+
+    // Some aspects of the exploration are not part of the builder options but are taken from the settings.
+    auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    description << "exploration: " << buildSettings.isDontFixDeadlocksSet();
+    if (buildSettings.isExplorationOrderSet()) {
+        description << " order=" << static_cast<uint64_t>(buildSettings.getExplorationOrder());
+    }
+    if (buildSettings.isExplorationStateLimitSet()) {
+        description << " limit=" << buildSettings.getExplorationStateLimit();
+    }
+
+    SparseModelCacheKey key;
+    key.description = description.str();
+    std::stringstream name;
+    name << std::hex << std::setfill('0') << std::setw(16) << computeStableHash(key.description) << "-" << std::setw(8) << key.description.size();
+    key.name = name.str();
+    return key;
+}
+
+bool isSparseModelCacheSupported(storm::builder::BuilderOptions const& options) {
+    return !options.isBuildChoiceOriginsSet() && !options.isBuildObservationValuationsSet();
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> loadSparseModelFromCache(std::string const& directory, SparseModelCacheKey const& key,
+                                                                                  storm::expressions::ExpressionManager const& manager) {
+    std::string filename = getCacheFilename(directory, key);
+    std::ifstream in(filename, std::ios::binary);
+    if (!in) {
+        STORM_LOG_INFO("No model cache entry " << filename << ".");
+        return nullptr;
+    }
+
+    try {
+        in.seekg(0, std::ios::end);
+        uint64_t const entrySize = static_cast<uint64_t>(in.tellg());
+        in.seekg(0, std::ios::beg);
+
+        std::string magic(cacheMagic.size(), '\0');
+        in.read(magic.data(), magic.size());
+        STORM_LOG_THROW(in && magic == cacheMagic && readUint(in) == cacheFormatVersion && readString(in, entrySize) == getValueTypeName<ValueType>(),
+                        storm::exceptions::WrongFormatException, "Incompatible model cache entry.");
+        if (readString(in, entrySize) != key.description) {
+            // The hashes of two different inputs collide, so the entry holds a different model.
+            STORM_LOG_INFO("Model cache entry " << filename << " was stored for a different input.");
+            return nullptr;
+        }
+
+        auto modelType = static_cast<storm::models::ModelType>(readUint(in));
+        storm::storage::SparseMatrix<ValueType> transitionMatrix = readMatrix<ValueType>(in, entrySize);
+        storm::models::sparse::StateLabeling stateLabeling = readLabeling<storm::models::sparse::StateLabeling>(in, entrySize);
+        storm::storage::sparse::ModelComponents<ValueType> components(std::move(transitionMatrix), std::move(stateLabeling));
+        uint64_t numberOfRewardModels = readUint(in);
+        for (uint64_t rewardModelIndex = 0; rewardModelIndex < numberOfRewardModels; ++rewardModelIndex) {
+            std::string name = readString(in, entrySize);
+            std::optional<std::vector<ValueType>> stateRewards;
+            std::optional<std::vector<ValueType>> stateActionRewards;
+            std::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+            if (readUint(in) != 0) {
+                stateRewards = readValueVector<ValueType>(in, entrySize);
+            }
+            if (readUint(in) != 0) {
+                stateActionRewards = readValueVector<ValueType>(in, entrySize);
+            }
+            if (readUint(in) != 0) {
+                transitionRewards = readMatrix<ValueType>(in, entrySize);
+            }
+            components.rewardModels.emplace(name, storm::models::sparse::StandardRewardModel<ValueType>(
+                                                      std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+        }
+        if (readUint(in) != 0) {
+            components.choiceLabeling = readLabeling<storm::models::sparse::ChoiceLabeling>(in, entrySize);
+        }
+        if (readUint(in) != 0) {
+            components.stateValuations = readStateValuations(in, entrySize, manager);
+        }
+
+        bool canonicPomdp = false;
+        if (modelType == storm::models::ModelType::Ctmc) {
+            components.rateTransitions = true;
+            components.exitRates = readValueVector<ValueType>(in, entrySize);
+        } else if (modelType == storm::models::ModelType::MarkovAutomaton) {
+            components.exitRates = readValueVector<ValueType>(in, entrySize);
+            components.markovianStates = readBitVector(in, entrySize);
+        } else if (modelType == storm::models::ModelType::Pomdp) {
+            components.observabilityClasses = readIntegerVector<uint32_t>(in, entrySize);
+            canonicPomdp = readUint(in) != 0;
+        }
+
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
+        if (modelType == storm::models::ModelType::Pomdp) {
+            model = std::make_shared<storm::models::sparse::Pomdp<ValueType>>(std::move(components), canonicPomdp);
+        } else {
+            model = storm::utility::builder::buildModelFromComponents(modelType, std::move(components));
+        }
+        STORM_LOG_INFO("Loaded model from cache entry " << filename << ".");
+        return model;
+    } catch (std::exception const& e) {
+        // Besides our own checks, building the model from inconsistent components may fail with exceptions from the standard library.
+        STORM_LOG_WARN("Ignoring model cache entry " << filename << ": " << e.what());
+        return nullptr;
+    }
+}
+
+template<typename ValueType>
+void storeSparseModelInCache(std::string const& directory, SparseModelCacheKey const& key, storm::models::sparse::Model<ValueType> const& model) {
+    if (model.isOfType(storm::models::ModelType::S2pg) || model.isOfType(storm::models::ModelType::Smg)) {
+        STORM_LOG_WARN("Model cache does not support models of type " << model.getType() << ". The model is not cached.");
+        return;
+    }
+    if (model.hasChoiceOrigins() || (model.hasStateValuations() && hasEmptyValuation(model.getStateValuations()))) {
+        STORM_LOG_WARN("The model holds components that can not be cached. The model is not cached.");
+        return;
+    }
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(directory, errorCode);
+    if (errorCode) {
+        STORM_LOG_WARN("Could not create model cache directory " << directory << ": " << errorCode.message() << ". The model is not cached.");
+        return;
+    }
+
+    // Write to a temporary file first and move it into place afterwards, so that concurrent runs never read incomplete entries.
+    std::string filename = getCacheFilename(directory, key);
+    std::stringstream temporaryFilename;
+    temporaryFilename << filename << ".tmp" << std::hex << std::random_device()();
+    {
+        std::ofstream out(temporaryFilename.str(), std::ios::binary | std::ios::trunc);
+        if (!out) {
+            STORM_LOG_WARN("Could not open file " << temporaryFilename.str() << ". The model is not cached.");
+            return;
+        }
+
+        out.write(cacheMagic.data(), cacheMagic.size());
+        writeUint(out, cacheFormatVersion);
+        writeString(out, getValueTypeName<ValueType>());
+        writeString(out, key.description);
+        writeUint(out, static_cast<uint64_t>(model.getType()));
+        writeMatrix(out, model.getTransitionMatrix());
+        writeLabeling(out, model.getStateLabeling());
+
+        writeUint(out, model.getRewardModels().size());
+        for (auto const& rewardModel : model.getRewardModels()) {
+            writeString(out, rewardModel.first);
+            writeUint(out, rewardModel.second.hasStateRewards() ? 1 : 0);
+            if (rewardModel.second.hasStateRewards()) {
+                writeValueVector(out, rewardModel.second.getStateRewardVector());
+            }
+            writeUint(out, rewardModel.second.hasStateActionRewards() ? 1 : 0);
+            if (rewardModel.second.hasStateActionRewards()) {
+                writeValueVector(out, rewardModel.second.getStateActionRewardVector());
+            }
+            writeUint(out, rewardModel.second.hasTransitionRewards() ? 1 : 0);
+            if (rewardModel.second.hasTransitionRewards()) {
+                writeMatrix(out, rewardModel.second.getTransitionRewardMatrix());
+            }
+        }
+
+        writeUint(out, model.hasChoiceLabeling() ? 1 : 0);
+        if (model.hasChoiceLabeling()) {
+            writeLabeling(out, model.getChoiceLabeling());
+        }
+        writeUint(out, model.hasStateValuations() ? 1 : 0);
+        if (model.hasStateValuations()) {
+            writeStateValuations(out, model.getStateValuations());
+        }
+
+        if (model.isOfType(storm::models::ModelType::Ctmc)) {
+            writeValueVector(out, model.template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector());
+        } else if (model.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            auto const& ma = *model.template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+            writeValueVector(out, ma.getExitRates());
+            writeBitVector(out, ma.getMarkovianStates());
+        } else if (model.isOfType(storm::models::ModelType::Pomdp)) {
+            auto const& pomdp = *model.template as<storm::models::sparse::Pomdp<ValueType>>();
+            writeIntegerVector(out, pomdp.getObservations());
+            writeUint(out, pomdp.isCanonic() ? 1 : 0);
+        }
+        out.flush();
+        if (!out) {
+            STORM_LOG_WARN("Could not write file " << temporaryFilename.str() << ". The model is not cached.");
+            out.close();
+            std::filesystem::remove(temporaryFilename.str(), errorCode);
+            return;
+        }
+    }
+
+    std::filesystem::rename(temporaryFilename.str(), filename, errorCode);
+    if (errorCode) {
+        STORM_LOG_WARN("Could not write model cache entry " << filename << ": " << errorCode.message() << ". The model is not cached.");
+        std::filesystem::remove(temporaryFilename.str(), errorCode);
+        return;
+    }
+    STORM_LOG_INFO("Stored model in cache entry " << filename << ".");
+}
+
+template std::shared_ptr<storm::models::sparse::Model<double>> loadSparseModelFromCache(std::string const& directory, SparseModelCacheKey const& key,
+                                                                                        storm::expressions::ExpressionManager const& manager);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> loadSparseModelFromCache(std::string const& directory,
+                                                                                                       SparseModelCacheKey const& key,
+                                                                                                       storm::expressions::ExpressionManager const& manager);
+template void storeSparseModelInCache(std::string const& directory, SparseModelCacheKey const& key, storm::models::sparse::Model<double> const& model);
+template void storeSparseModelInCache(std::string const& directory, SparseModelCacheKey const& key,
+                                      storm::models::sparse::Model<storm::RationalNumber> const& model);
+
+}  // namespace exporter
+}  // namespace storm
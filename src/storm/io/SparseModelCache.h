@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Identifies the sparse model built from some input in the model cache.
+ */
+struct SparseModelCacheKey {
+    // The name of the cache entry, which is derived from a hash of the description and is also the file name of the entry.
+    std::string name;
+
+    // The complete description of the input. It is stored in the cache entry, such that inputs whose hashes collide do not share models.
+    std::string description;
+};
+
+/*!
+ * Computes the key under which the sparse model built from the given input is stored in the model cache.
+ *
+ * @param modelDescription The (preprocessed) symbolic description of the model.
+ * @param constantDefinitions The constant definitions used to preprocess the model description.
+ * @param options The options for the model builder.
+ * @return The key of the model.
+ */
+SparseModelCacheKey computeSparseModelCacheKey(storm::storage::SymbolicModelDescription const& modelDescription, std::string const& constantDefinitions,
+                                       storm::builder::BuilderOptions const& options);
+
+/*!
+ * Retrieves whether sparse models built with the given options can be stored in the model cache.
+ * Models holding components without binary representation (e.g. choice origins) are never cached.
+ */
+bool isSparseModelCacheSupported(storm::builder::BuilderOptions const& options);
+
+/*!
+ * Loads the sparse model with the given key from the model cache.
+ *
+ * @param directory The directory holding the cache.
+ * @param key The key of the model.
+ * @param manager The manager that is used to look up the variables of the state valuations.
+ * @return The cached model or nullptr if there is no (valid) cache entry for the given key. This includes entries with the same name
+ * that were stored for a different description.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> loadSparseModelFromCache(std::string const& directory, SparseModelCacheKey const& key,
+                                                                                  storm::expressions::ExpressionManager const& manager);
+
+/*!
+ * Stores the given sparse model in the model cache. The entry is first written to a temporary file, so concurrent
+ * invocations never see partially written entries. If the entry can not be written (e.g. because the directory is not
+ * writable), a warning is issued and the model is not cached.
+ *
+ * @param directory The directory holding the cache. It is created if it does not exist.
+ * @param key The key of the model.
+ * @param model The model to store.
+ */
+template<typename ValueType>
+void storeSparseModelInCache(std::string const& directory, SparseModelCacheKey const& key, storm::models::sparse::Model<ValueType> const& model);
+
+}  // namespace exporter
+}  // namespace storm
@@ -2,6 +2,7 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/modelchecker/hints/ModelCheckerResultCache.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
@@ -341,7 +342,25 @@ template<typename ModelType>
 std::unique_ptr<CheckResult> AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(
     Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, SolutionType> const& checkTask) {
     storm::logic::ProbabilityOperatorFormula const& stateFormula = checkTask.getFormula();
-    std::unique_ptr<CheckResult> result = this->computeProbabilities(env, checkTask.substituteFormula(stateFormula.getSubformula()));
+    storm::logic::Formula const& pathFormula = stateFormula.getSubformula();
+    std::unique_ptr<CheckResult> result;
+    if (resultCache && !checkTask.isQualitativeSet() && (pathFormula.isUntilFormula() || pathFormula.isReachabilityProbabilityFormula() || pathFormula.isGloballyFormula())) {
+        std::stringstream key;
+        key << "P";
+        if (checkTask.isOptimizationDirectionSet()) {
+            key << checkTask.getOptimizationDirection();
+        }
+        key << " [" << pathFormula << "]";
+        // Later queries can only be seeded with values that are valid for all states, so we compute them even if only the initial states
+        // are relevant for this task.
+        auto subTask = checkTask.substituteFormula(pathFormula);
+        subTask.setOnlyInitialStatesRelevant(false);
+        seedFromResultCache(key.str(), subTask);
+        result = this->computeProbabilities(env, subTask);
+        recordInResultCache(key.str(), *result);
+    } else {
+        result = this->computeProbabilities(env, checkTask.substituteFormula(pathFormula));
+    }
 
     if (checkTask.isBoundSet()) {
         STORM_LOG_THROW(result->isQuantitative(), storm::exceptions::InvalidOperationException,
@@ -356,7 +375,29 @@ template<typename ModelType>
 std::unique_ptr<CheckResult> AbstractModelChecker<ModelType>::checkRewardOperatorFormula(
     Environment const& env, CheckTask<storm::logic::RewardOperatorFormula, SolutionType> const& checkTask) {
     storm::logic::RewardOperatorFormula const& stateFormula = checkTask.getFormula();
-    std::unique_ptr<CheckResult> result = this->computeRewards(env, stateFormula.getMeasureType(), checkTask.substituteFormula(stateFormula.getSubformula()));
+    storm::logic::Formula const& rewardFormula = stateFormula.getSubformula();
+    std::unique_ptr<CheckResult> result;
+    if (resultCache && !checkTask.isQualitativeSet() && (rewardFormula.isReachabilityRewardFormula() || rewardFormula.isTotalRewardFormula())) {
+        std::stringstream key;
+        key << "R";
+        if (checkTask.isRewardModelSet()) {
+            key << "{\"" << checkTask.getRewardModel() << "\"}";
+        }
+        key << stateFormula.getMeasureType();
+        if (checkTask.isOptimizationDirectionSet()) {
+            key << checkTask.getOptimizationDirection();
+        }
+        key << " [" << rewardFormula << "]";
+        // Later queries can only be seeded with values that are valid for all states, so we compute them even if only the initial states
+        // are relevant for this task.
+        auto subTask = checkTask.substituteFormula(rewardFormula);
+        subTask.setOnlyInitialStatesRelevant(false);
+        seedFromResultCache(key.str(), subTask);
+        result = this->computeRewards(env, stateFormula.getMeasureType(), subTask);
+        recordInResultCache(key.str(), *result);
+    } else {
+        result = this->computeRewards(env, stateFormula.getMeasureType(), checkTask.substituteFormula(rewardFormula));
+    }
 
     if (checkTask.isBoundSet()) {
         STORM_LOG_THROW(result->isQuantitative(), storm::exceptions::InvalidOperationException,
@@ -444,6 +485,41 @@ std::unique_ptr<CheckResult> AbstractModelChecker<ModelType>::checkGameFormula(E
                     "This model checker (" << getClassName() << ") does not support the formula: " << checkTask.getFormula() << ".");
 }
 
+template<typename ModelType>
+void AbstractModelChecker<ModelType>::setResultCache(std::shared_ptr<ModelCheckerResultCache<SolutionType>> const& cache) {
+    STORM_LOG_WARN_COND(!cache || ModelType::Representation == storm::models::ModelRepresentation::Sparse,
+                        "Result caches are only supported for sparse models. The cache will be ignored.");
+    resultCache = cache;
+}
+
+template<typename ModelType>
+void AbstractModelChecker<ModelType>::seedFromResultCache(std::string const& key, CheckTask<storm::logic::Formula, SolutionType>& checkTask) const {
+    if constexpr (ModelType::Representation == storm::models::ModelRepresentation::Sparse && std::is_same_v<ValueType, SolutionType>) {
+        // Hints that were given explicitly take precedence.
+        if (!checkTask.getHint().isEmpty()) {
+            return;
+        }
+        if (auto hint = resultCache->getHint(key)) {
+            STORM_LOG_INFO("Using cached result of '" << key << "' as hint.");
+            checkTask.setHint(hint);
+        }
+    }
+}
+
+template<typename ModelType>
+void AbstractModelChecker<ModelType>::recordInResultCache(std::string const& key, CheckResult const& result) {
+    if constexpr (ModelType::Representation == storm::models::ModelRepresentation::Sparse && std::is_same_v<ValueType, SolutionType>) {
+        if (!result.isExplicitQuantitativeCheckResult() || !result.isResultForAllStates()) {
+            return;
+        }
+        auto const& quantitativeResult = result.asExplicitQuantitativeCheckResult<SolutionType>();
+        if (quantitativeResult.getValueVector().size() != resultCache->getNumberOfStates()) {
+            return;
+        }
+        resultCache->store(key, quantitativeResult.getValueVector(), quantitativeResult.hasScheduler() ? &quantitativeResult.getScheduler() : nullptr);
+    }
+}
+
 ///////////////////////////////////////////////
 // Explicitly instantiate the template class.
 ///////////////////////////////////////////////
@@ -1,6 +1,7 @@
 #ifndef STORM_MODELCHECKER_ABSTRACTMODELCHECKER_H_
 #define STORM_MODELCHECKER_ABSTRACTMODELCHECKER_H_
 
+#include <memory>
 #include <string>
 
 #include "storm/logic/Formulas.h"
@@ -14,6 +15,9 @@ class Environment;
 namespace modelchecker {
 class CheckResult;
 
+template<typename ValueType>
+class ModelCheckerResultCache;
+
 enum class RewardType { Expectation, Variance };
 
 template<typename ModelType>
@@ -130,6 +134,22 @@ class AbstractModelChecker {
 
     // The methods to check game formulas.
     virtual std::unique_ptr<CheckResult> checkGameFormula(Environment const& env, CheckTask<storm::logic::GameFormula, SolutionType> const& checkTask);
+
+    /*!
+     * Sets a cache that records the results of (unbounded) probability and reward operators. Later queries with the same path formula
+     * (e.g. with a different bound) are seeded with the cached values and choices. To make the results reusable, these operators are
+     * checked for all states even if only the initial states are relevant. Only used for sparse models.
+     */
+    void setResultCache(std::shared_ptr<ModelCheckerResultCache<SolutionType>> const& cache);
+
+   private:
+    // Seeds the given task with the cached result for the given key (if any).
+    void seedFromResultCache(std::string const& key, CheckTask<storm::logic::Formula, SolutionType>& checkTask) const;
+
+    // Records the given result under the given key.
+    void recordInResultCache(std::string const& key, CheckResult const& result);
+
+    std::shared_ptr<ModelCheckerResultCache<SolutionType>> resultCache;
 };
 }  // namespace modelchecker
 }  // namespace storm
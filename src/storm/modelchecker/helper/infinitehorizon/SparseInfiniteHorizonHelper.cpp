@@ -3,6 +3,7 @@
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -24,8 +25,15 @@
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/exceptions/UnmetRequirementException.h"
 
+#include <atomic>
+#include <mutex>
+#include <numeric>
+
 namespace storm {
 namespace modelchecker {
 namespace helper {
@@ -130,6 +138,11 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     return computeLongRunAverageValues(env, stateValuesGetter, actionValuesGetter);
 }
 
+template<typename ValueType, bool Nondeterministic>
+bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isParallelComponentComputationSupported(Environment const&) const {
+    return true;
+}
+
 template<typename ValueType, bool Nondeterministic>
 std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeLongRunAverageValues(Environment const& env,
                                                                                                              ValueGetter const& stateRewardsGetter,
@@ -170,10 +183,47 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     progress.startNewMeasurement(0);
     STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
     std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-        progress.updateProgress(componentLraValues.size());
+    bool parallelize = std::is_same_v<ValueType, double> && _longRunComponentDecomposition->size() > 1 &&
+                       storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() &&
+                       isParallelComponentComputationSupported(underlyingSolverEnvironment);
+#ifdef STORM_HAVE_INTELTBB
+    if (parallelize) {
+        // The components are independent of each other. Dispatch them largest first, so that a single large component does not end up being processed last.
+        std::vector<uint64_t> componentOrder(_longRunComponentDecomposition->size());
+        std::iota(componentOrder.begin(), componentOrder.end(), 0ull);
+        std::stable_sort(componentOrder.begin(), componentOrder.end(), [this](uint64_t lhs, uint64_t rhs) {
+            return (*_longRunComponentDecomposition)[lhs].size() > (*_longRunComponentDecomposition)[rhs].size();
+        });
+        componentLraValues.resize(_longRunComponentDecomposition->size());
+        std::atomic<uint64_t> nextComponent(0);
+        uint64_t numberOfFinishedComponents = 0;
+        std::mutex progressMutex;
+        tbb::task_group workers;
+        for (int worker = 0; worker < tbb::this_task_arena::max_concurrency(); ++worker) {
+            workers.run([&]() {
+                // Each worker uses its own copy of the environment.
+                Environment componentEnvironment = underlyingSolverEnvironment;
+                for (uint64_t index = nextComponent++; index < componentOrder.size(); index = nextComponent++) {
+                    uint64_t component = componentOrder[index];
+                    componentLraValues[component] =
+                        computeLraForComponent(componentEnvironment, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[component]);
+                    std::lock_guard<std::mutex> lock(progressMutex);
+                    progress.updateProgress(++numberOfFinishedComponents);
+                }
+            });
+        }
+        workers.wait();
+    }
+#else
+    STORM_LOG_WARN_COND(!parallelize, "Parallel computation of long run average values requires Intel TBB.");
+    parallelize = false;
+#endif
+    if (!parallelize) {
+        componentLraValues.reserve(_longRunComponentDecomposition->size());
+        for (auto const& c : *_longRunComponentDecomposition) {
+            componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
+            progress.updateProgress(componentLraValues.size());
+        }
     }
 
     // Solve the resulting SSP where end components are collapsed into single auxiliary states
@@ -123,6 +123,12 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     virtual void createDecomposition() = 0;
 
+    /*!
+     * @return true iff the LRA values of the components can be computed concurrently with the given environment (e.g., the selected method does not
+     * rely on solvers that are not thread-safe).
+     */
+    virtual bool isParallelComponentComputationSupported(Environment const& env) const;
+
     /*!
      * @pre if scheduler production is enabled and Nondeterministic is true, a choice for each state within a component must be set such that the choices yield
      * optimal values w.r.t. the individual components.
@@ -75,6 +75,14 @@ void SparseNondeterministicInfiniteHorizonHelper<ValueType>::createDecomposition
     }
 }
 
+template<typename ValueType>
+bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::isParallelComponentComputationSupported(Environment const& env) const {
+    // LP solvers are not necessarily thread-safe. LP is also selected by default if exact results are required (see computeLraForComponent).
+    bool exact = storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact();
+    return env.solver().lra().getNondetLraMethod() != storm::solver::LraMethod::LinearProgramming &&
+           !(exact && env.solver().lra().isNondetLraMethodSetFromDefault());
+}
+
 template<typename ValueType>
 ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForComponent(Environment const& env, ValueGetter const& stateRewardsGetter,
                                                                                          ValueGetter const& actionRewardsGetter,
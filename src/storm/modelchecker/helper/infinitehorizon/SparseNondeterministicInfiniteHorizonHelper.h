@@ -65,6 +65,8 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
    protected:
     virtual void createDecomposition() override;
 
+    virtual bool isParallelComponentComputationSupported(Environment const& env) const override;
+
     std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                        storm::storage::MaximalEndComponent const& mec);
 
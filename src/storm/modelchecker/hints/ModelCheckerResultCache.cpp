@@ -0,0 +1,67 @@
+#include "storm/modelchecker/hints/ModelCheckerResultCache.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename ValueType>
+ModelCheckerResultCache<ValueType>::ModelCheckerResultCache(uint64_t numberOfStates) : numberOfStates(numberOfStates), numberOfHits(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+uint64_t ModelCheckerResultCache<ValueType>::getNumberOfStates() const {
+    return numberOfStates;
+}
+
+template<typename ValueType>
+std::shared_ptr<ExplicitModelCheckerHint<ValueType>> ModelCheckerResultCache<ValueType>::getHint(std::string const& key) const {
+    auto entryIt = entries.find(key);
+    if (entryIt == entries.end()) {
+        return nullptr;
+    }
+    ++numberOfHits;
+    auto hint = std::make_shared<ExplicitModelCheckerHint<ValueType>>();
+    hint->setComputeOnlyMaybeStates(false);
+    hint->setNoEndComponentsInMaybeStates(false);
+    hint->setResultHint(entryIt->second.values);
+    hint->setSchedulerHint(entryIt->second.scheduler);
+    return hint;
+}
+
+template<typename ValueType>
+void ModelCheckerResultCache<ValueType>::store(std::string const& key, std::vector<ValueType> const& values,
+                                               storm::storage::Scheduler<ValueType> const* scheduler) {
+    STORM_LOG_ASSERT(values.size() == numberOfStates, "Unexpected size of result vector.");
+    Entry& entry = entries[key];
+    entry.values = values;
+    if (scheduler && scheduler->isMemorylessScheduler() && scheduler->isDeterministicScheduler() && !scheduler->isPartialScheduler()) {
+        entry.scheduler = *scheduler;
+    } else {
+        entry.scheduler = boost::none;
+    }
+}
+
+template<typename ValueType>
+uint64_t ModelCheckerResultCache<ValueType>::size() const {
+    return entries.size();
+}
+
+template<typename ValueType>
+uint64_t ModelCheckerResultCache<ValueType>::getNumberOfHits() const {
+    return numberOfHits;
+}
+
+template<typename ValueType>
+void ModelCheckerResultCache<ValueType>::clear() {
+    entries.clear();
+}
+
+template class ModelCheckerResultCache<double>;
+template class ModelCheckerResultCache<storm::RationalNumber>;
+template class ModelCheckerResultCache<storm::RationalFunction>;
+
+}  // namespace modelchecker
+}  // namespace storm
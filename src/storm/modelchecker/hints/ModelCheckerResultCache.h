@@ -0,0 +1,72 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/storage/Scheduler.h"
+
+namespace storm {
+namespace modelchecker {
+
+/*!
+ * Records the converged values (and optimal choices, if available) of quantitative (sub)formulas, such that they can be used as
+ * hints when a compatible query is checked later on, e.g., the same formula with a different bound or the same formula on a model that
+ * only differs in the values of some constants.
+ * @note Cached values are only used as a starting point for the solvers. Whether such a hint is actually applicable is still decided
+ * by the model checker, so a cache may be shared between several queries on (possibly different) models with the same number of states.
+ */
+template<typename ValueType>
+class ModelCheckerResultCache {
+   public:
+    /*!
+     * Creates an empty cache for models with the given number of states.
+     */
+    ModelCheckerResultCache(uint64_t numberOfStates);
+
+    /*!
+     * Retrieves the number of states of the models this cache can be used for.
+     */
+    uint64_t getNumberOfStates() const;
+
+    /*!
+     * Retrieves a hint for the formula with the given key.
+     *
+     * @return The hint or nullptr if there is no entry for the key.
+     */
+    std::shared_ptr<ExplicitModelCheckerHint<ValueType>> getHint(std::string const& key) const;
+
+    /*!
+     * Stores the values and (if given) the optimal choices for the formula with the given key. Schedulers that are not memoryless and
+     * deterministic are not stored.
+     */
+    void store(std::string const& key, std::vector<ValueType> const& values, storm::storage::Scheduler<ValueType> const* scheduler = nullptr);
+
+    /*!
+     * Retrieves the number of cached formulas.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of lookups for which a hint was returned.
+     */
+    uint64_t getNumberOfHits() const;
+
+    void clear();
+
+   private:
+    struct Entry {
+        std::vector<ValueType> values;
+        boost::optional<storm::storage::Scheduler<ValueType>> scheduler;
+    };
+
+    uint64_t numberOfStates;
+    mutable uint64_t numberOfHits;
+    std::unordered_map<std::string, Entry> entries;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
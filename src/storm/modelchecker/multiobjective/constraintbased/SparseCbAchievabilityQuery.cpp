@@ -109,10 +109,11 @@ void SparseCbAchievabilityQuery<SparseModelType>::initializeConstraintSystem() {
 
     // assert that the "incoming" value of each state equals the "outgoing" value
     storm::storage::SparseMatrix<ValueType> backwardsTransitions = this->preprocessedModel->getTransitionMatrix().transpose();
+    storm::storage::BitVector const& initialStates = this->preprocessedModel->getInitialStates();
     auto bottomStateVariableIt = bottomStateVariables.begin();
     for (uint_fast64_t state = 0; state < numStates; ++state) {
         // get the "incomming" value
-        storm::expressions::Expression value = this->preprocessedModel->getInitialStates().get(state) ? one : zero;
+        storm::expressions::Expression value = initialStates.get(state) ? one : zero;
         for (auto const& backwardsEntry : backwardsTransitions.getRow(state)) {
             value =
                 value + (this->expressionManager->rational(backwardsEntry.getValue()) * expectedChoiceVariables[backwardsEntry.getColumn()].getExpression());
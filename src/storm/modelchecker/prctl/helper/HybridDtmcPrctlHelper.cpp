@@ -13,6 +13,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 
+#include "storm/models/symbolic/ExplicitSubmatrixCache.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
@@ -32,6 +33,43 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace {
+// Creates the ODD of the given states (or retrieves it from the cache of the model).
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Odd createOdd(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& states) {
+    if (auto explicitSubmatrixCache = model.getExplicitSubmatrixCache()) {
+        return explicitSubmatrixCache->getOdd(states);
+    }
+    return states.createOdd();
+}
+
+// Translates the given transition matrix restricted to the rows and columns of the maybe states to its explicit representation and, if requested,
+// converts it into the matrix (I-A) of the equation system. The given submatrix is the transition matrix restricted to the rows of the maybe states.
+// If the model caches explicit submatrices, the rows of the transition matrix are only extracted once and the restriction is done explicitly.
+template<storm::dd::DdType DdType, typename ValueType>
+storm::storage::SparseMatrix<ValueType> createExplicitSubmatrix(storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                                storm::dd::Add<DdType, ValueType> const& transitionMatrix,
+                                                                storm::dd::Add<DdType, ValueType> submatrix, storm::dd::Bdd<DdType> const& maybeStates,
+                                                                storm::dd::Odd const& odd, bool convertToEquationSystem) {
+    if (auto explicitSubmatrixCache = model.getExplicitSubmatrixCache()) {
+        storm::storage::SparseMatrix<ValueType> result = explicitSubmatrixCache->getSubmatrix(transitionMatrix, maybeStates, convertToEquationSystem);
+        if (convertToEquationSystem) {
+            result.convertToEquationSystem();
+        }
+        return result;
+    }
+
+    // Cut away all columns targeting non-maybe states and potentially convert the matrix into the matrix needed for
+    // solving the equation system (i.e. compute (I-A)).
+    storm::dd::Add<DdType, ValueType> maybeStatesAdd = maybeStates.template toAdd<ValueType>();
+    submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+    if (convertToEquationSystem) {
+        submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
+    }
+    return submatrix.toMatrix(odd, odd);
+}
+}  // namespace
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env,
                                                                                                  storm::models::symbolic::Model<DdType, ValueType> const& model,
@@ -63,7 +101,7 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
 
             // Create the ODD for the translation between symbolic and explicit storage.
             conversionWatch.start();
-            storm::dd::Odd odd = maybeStates.createOdd();
+            storm::dd::Odd odd = createOdd(model, maybeStates);
             conversionWatch.stop();
 
             // Create the matrix and the vector for the equation system.
@@ -91,19 +129,14 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
             bool convertToEquationSystem =
                 linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
 
-            // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
-            // into the matrix needed for solving the equation system (i.e. compute (I-A)).
-            submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
-            if (convertToEquationSystem) {
-                submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
-            }
-
             // Create the solution vector.
             std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::convertNumber<ValueType>(0.5));
 
-            // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
+            // Translate the symbolic matrix/vector to their explicit representations (thereby cutting away all columns targeting
+            // non-maybe states and potentially converting the matrix to (I-A)) and solve the equation system.
             conversionWatch.start();
-            storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+            storm::storage::SparseMatrix<ValueType> explicitSubmatrix =
+                createExplicitSubmatrix(model, transitionMatrix, submatrix, maybeStates, odd, convertToEquationSystem);
             std::vector<ValueType> b = subvector.toVector(odd);
             conversionWatch.stop();
             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
@@ -161,7 +194,7 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeBo
 
         // Create the ODD for the translation between symbolic and explicit storage.
         conversionWatch.start();
-        storm::dd::Odd odd = maybeStates.createOdd();
+        storm::dd::Odd odd = createOdd(model, maybeStates);
         conversionWatch.stop();
 
         // Create the matrix and the vector for the equation system.
@@ -176,15 +209,12 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeBo
         storm::dd::Add<DdType, ValueType> prob1StatesAsColumn = psiStates.template toAdd<ValueType>().swapVariables(model.getRowColumnMetaVariablePairs());
         storm::dd::Add<DdType, ValueType> subvector = (submatrix * prob1StatesAsColumn).sumAbstract(model.getColumnVariables());
 
-        // Finally cut away all columns targeting non-maybe states.
-        submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
-
         // Create the solution vector.
         std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::zero<ValueType>());
 
-        // Translate the symbolic matrix/vector to their explicit representations.
+        // Translate the symbolic matrix/vector to their explicit representations (thereby cutting away all columns targeting non-maybe states).
         conversionWatch.start();
-        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = createExplicitSubmatrix(model, transitionMatrix, submatrix, maybeStates, odd, false);
         std::vector<ValueType> b = subvector.toVector(odd);
         conversionWatch.stop();
         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
@@ -212,13 +242,15 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeIn
     storm::utility::Stopwatch conversionWatch(true);
 
     // Create the ODD for the translation between symbolic and explicit storage.
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
+    storm::dd::Odd odd = createOdd(model, model.getReachableStates());
 
     // Create the solution vector (and initialize it to the state rewards of the model).
     std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
 
     // Translate the symbolic matrix to its explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+    auto explicitSubmatrixCache = model.getExplicitSubmatrixCache();
+    storm::storage::SparseMatrix<ValueType> explicitMatrix =
+        explicitSubmatrixCache ? explicitSubmatrixCache->getSubmatrix(transitionMatrix, model.getReachableStates()) : transitionMatrix.toMatrix(odd, odd);
     conversionWatch.stop();
     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
@@ -248,10 +280,12 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeCu
     storm::utility::Stopwatch conversionWatch(true);
 
     // Create the ODD for the translation between symbolic and explicit storage.
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
+    storm::dd::Odd odd = createOdd(model, model.getReachableStates());
 
     // Translate the symbolic matrix/vector to their explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+    auto explicitSubmatrixCache = model.getExplicitSubmatrixCache();
+    storm::storage::SparseMatrix<ValueType> explicitMatrix =
+        explicitSubmatrixCache ? explicitSubmatrixCache->getSubmatrix(transitionMatrix, model.getReachableStates()) : transitionMatrix.toMatrix(odd, odd);
     std::vector<ValueType> b = totalRewardVector.toVector(odd);
     conversionWatch.stop();
     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
@@ -311,7 +345,7 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeRe
 
             // Create the ODD for the translation between symbolic and explicit storage.
             conversionWatch.start();
-            storm::dd::Odd odd = maybeStates.createOdd();
+            storm::dd::Odd odd = createOdd(model, maybeStates);
             conversionWatch.stop();
 
             // Create the matrix and the vector for the equation system.
@@ -344,19 +378,14 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeRe
             bool convertToEquationSystem =
                 linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
 
-            // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
-            // into the matrix needed for solving the equation system (i.e. compute (I-A)).
-            submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
-            if (convertToEquationSystem) {
-                submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
-            }
-
             // Create the solution vector.
             std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::convertNumber<ValueType>(0.5));
 
-            // Translate the symbolic matrix/vector to their explicit representations.
+            // Translate the symbolic matrix/vector to their explicit representations (thereby cutting away all columns targeting
+            // non-maybe states and potentially converting the matrix to (I-A)).
             conversionWatch.start();
-            storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+            storm::storage::SparseMatrix<ValueType> explicitSubmatrix =
+                createExplicitSubmatrix(model, transitionMatrix, submatrix, maybeStates, odd, convertToEquationSystem);
             std::vector<ValueType> b = subvector.toVector(odd);
             conversionWatch.stop();
             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
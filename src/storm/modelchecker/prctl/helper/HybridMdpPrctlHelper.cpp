@@ -11,6 +11,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 
+#include "storm/models/symbolic/ExplicitSubmatrixCache.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
@@ -32,6 +33,17 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace {
+// Creates the ODD of the given states (or retrieves it from the cache of the model).
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Odd createOdd(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& states) {
+    if (auto explicitSubmatrixCache = model.getExplicitSubmatrixCache()) {
+        return explicitSubmatrixCache->getOdd(states);
+    }
+    return states.createOdd();
+}
+}  // namespace
+
 template<typename ValueType>
 struct SolverRequirementsData {
     boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
@@ -201,7 +213,7 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
 
             // Create the ODD for the translation between symbolic and explicit storage.
             conversionWatch.start();
-            storm::dd::Odd odd = extendedMaybeStates.createOdd();
+            storm::dd::Odd odd = createOdd(model, extendedMaybeStates);
             conversionWatch.stop();
 
             // Convert the maybe states BDD to an ADD.
@@ -219,7 +231,11 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
 
                 // Only translate the matrix for now.
                 conversionWatch.start();
-                explicitRepresentation.first = submatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+                if (auto explicitSubmatrixCache = model.getExplicitSubmatrixCache()) {
+                    explicitRepresentation.first = explicitSubmatrixCache->getMatrix(submatrix, model.getNondeterminismVariables(), extendedMaybeStates);
+                } else {
+                    explicitRepresentation.first = submatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+                }
 
                 // Get all original maybe states in the extended matrix.
                 solverRequirementsData.properMaybeStates = maybeStates.toVector(odd);
@@ -281,7 +297,7 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
 
             // If we extended the maybe states, we create a new ODD containing only the propery maybe states.
             if (extendMaybeStates) {
-                odd = maybeStates.createOdd();
+                odd = createOdd(model, maybeStates);
             }
 
             // Return a hybrid check result that stores the numerical values explicitly.
@@ -336,7 +352,7 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeBou
 
         // Create the ODD for the translation between symbolic and explicit storage.
         conversionWatch.start();
-        storm::dd::Odd odd = maybeStates.createOdd();
+        storm::dd::Odd odd = createOdd(model, maybeStates);
         conversionWatch.stop();
 
         // Create the matrix and the vector for the equation system.
@@ -387,10 +403,17 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeIns
     storm::utility::Stopwatch conversionWatch;
 
     // Create the ODD for the translation between symbolic and explicit storage.
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
+    storm::dd::Odd odd = createOdd(model, model.getReachableStates());
 
-    // Translate the symbolic matrix to its explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+    // Translate the symbolic matrix to its explicit representations (or retrieve it from the cache of the model).
+    storm::storage::SparseMatrix<ValueType> translatedMatrix;
+    auto explicitSubmatrixCache = model.getExplicitSubmatrixCache();
+    if (!explicitSubmatrixCache) {
+        translatedMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+    }
+    storm::storage::SparseMatrix<ValueType> const& explicitMatrix =
+        explicitSubmatrixCache ? explicitSubmatrixCache->getMatrix(transitionMatrix, model.getNondeterminismVariables(), model.getReachableStates())
+                               : translatedMatrix;
 
     // Create the solution vector (and initialize it to the state rewards of the model).
     std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
@@ -422,7 +445,7 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeCum
     storm::utility::Stopwatch conversionWatch(true);
 
     // Create the ODD for the translation between symbolic and explicit storage.
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
+    storm::dd::Odd odd = createOdd(model, model.getReachableStates());
 
     // Translate the symbolic matrix/vector to their explicit representations.
     std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation =
@@ -652,7 +675,7 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeRea
 
             // Create the ODD for the translation between symbolic and explicit storage.
             conversionWatch.start();
-            storm::dd::Odd odd = requiredMaybeStates.createOdd();
+            storm::dd::Odd odd = createOdd(model, requiredMaybeStates);
             conversionWatch.stop();
 
             // Create the matrix and the vector for the equation system.
@@ -761,7 +784,7 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeRea
 
             // If we extended the maybe states, we create a new ODD that only contains proper maybe states.
             if (extendMaybeStates) {
-                odd = maybeStates.createOdd();
+                odd = createOdd(model, maybeStates);
             }
 
             // Return a hybrid check result that stores the numerical values explicitly.
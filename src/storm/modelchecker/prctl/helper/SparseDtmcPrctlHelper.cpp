@@ -28,6 +28,7 @@
 #include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/io/export.h"
+#include "storm/utility/MemoryAccounting.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
@@ -84,32 +85,44 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
     rewardUnfolding.setEquationSystemFormatForEpochModel(linearEquationSolverFactory.getEquationProblemFormat(preciseEnv));
 
-    storm::utility::ProgressMeasurement progress("epochs");
-    progress.setMaxCount(epochOrder.size());
-    progress.startNewMeasurement(0);
-    uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
+    if (rewardUnfolding.getNumberOfEpochWorkers() > 1 && !storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
+        // Epochs within a wavefront are analyzed concurrently, where each worker uses its own solver.
+        uint64_t numberOfWorkers = rewardUnfolding.getNumberOfEpochWorkers();
+        std::vector<std::vector<ValueType>> workerX(numberOfWorkers), workerB(numberOfWorkers);
+        std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> workerSolvers(numberOfWorkers);
         swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+        rewardUnfolding.analyzeEpochs(epochOrder, [&](auto& epochModel, auto const&, uint64_t worker) {
+            return epochModel.analyzeSingleObjective(preciseEnv, workerX[worker], workerB[worker], workerSolvers[worker], lowerBound, upperBound);
+        });
         swCheck.stop();
-        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-            !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-            std::vector<ValueType> cdfEntry;
-            for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                   rewardUnfolding.getDimension(i).scalingFactor);
+    } else {
+        storm::utility::ProgressMeasurement progress("epochs");
+        progress.setMaxCount(epochOrder.size());
+        progress.startNewMeasurement(0);
+        uint64_t numCheckedEpochs = 0;
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+            swCheck.stop();
+            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
+                !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                std::vector<ValueType> cdfEntry;
+                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                    uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                                       rewardUnfolding.getDimension(i).scalingFactor);
+                }
+                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                cdfData.push_back(std::move(cdfEntry));
+            }
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+            if (storm::utility::resources::isTerminate()) {
+                break;
             }
-            cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-            cdfData.push_back(std::move(cdfEntry));
-        }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
         }
     }
 
@@ -145,9 +158,10 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
 }
 
 template<typename ValueType, typename RewardModelType>
-std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(
+template<typename BackwardTransitionsType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilitiesImpl(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
     bool qualitative, ModelCheckerHint const& hint) {
     std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
 
@@ -175,6 +189,7 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
         STORM_LOG_INFO("Preprocessing: " << statesWithProbability1.getNumberOfSetBits() << " states with probability 1 (" << maybeStates.getNumberOfSetBits()
                                          << " states remaining).");
     } else {
+        storm::utility::memory::MemoryStage memoryStage("qualitative analysis");
         // Get all states that have probability 0 and 1 of satisfying the until-formula.
         std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
             storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
@@ -243,6 +258,22 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
     return result;
 }
 
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    bool qualitative, ModelCheckerHint const& hint) {
+    return computeUntilProbabilitiesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, phiStates, psiStates, qualitative, hint);
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    bool qualitative, ModelCheckerHint const& hint) {
+    return computeUntilProbabilitiesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, phiStates, psiStates, qualitative, hint);
+}
+
 template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeAllUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -307,9 +338,10 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
 }
 
 template<typename ValueType, typename RewardModelType>
-std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilities(
+template<typename BackwardTransitionsType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilitiesImpl(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative) {
+    BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative) {
     goal.oneMinus();
     std::vector<ValueType> result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions,
                                                               storm::storage::BitVector(transitionMatrix.getRowCount(), true), ~psiStates, qualitative);
@@ -319,6 +351,20 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
     return result;
 }
 
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative) {
+    return computeGloballyProbabilitiesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, psiStates, qualitative);
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative) {
+    return computeGloballyProbabilitiesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, psiStates, qualitative);
+}
+
 template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeNextProbabilities(
     Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& nextStates) {
@@ -368,9 +414,10 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
 }
 
 template<typename ValueType, typename RewardModelType>
-std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeTotalRewards(
+template<typename BackwardTransitionsType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeTotalRewardsImpl(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, bool qualitative, ModelCheckerHint const& hint) {
+    BackwardTransitionsType const& backwardTransitions, RewardModelType const& rewardModel, bool qualitative, ModelCheckerHint const& hint) {
     // Identify the states from which only states with zero reward are reachable.
     // We can then compute reachability rewards assuming these states as target set.
     storm::storage::BitVector statesWithoutReward = rewardModel.getStatesWithZeroReward(transitionMatrix);
@@ -380,9 +427,24 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
 }
 
 template<typename ValueType, typename RewardModelType>
-std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, bool qualitative, ModelCheckerHint const& hint) {
+    return computeTotalRewardsImpl(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, qualitative, hint);
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeTotalRewards(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, RewardModelType const& rewardModel, bool qualitative, ModelCheckerHint const& hint) {
+    return computeTotalRewardsImpl(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, qualitative, hint);
+}
+
+template<typename ValueType, typename RewardModelType>
+template<typename BackwardTransitionsType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewardsImpl(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    BackwardTransitionsType const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
     bool qualitative, ModelCheckerHint const& hint) {
     return computeReachabilityRewards(
         env, std::move(goal), transitionMatrix, backwardTransitions,
@@ -392,6 +454,22 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
         targetStates, qualitative, [&]() { return rewardModel.getStatesWithZeroReward(transitionMatrix); }, hint);
 }
 
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+    bool qualitative, ModelCheckerHint const& hint) {
+    return computeReachabilityRewardsImpl(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, targetStates, qualitative, hint);
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+    bool qualitative, ModelCheckerHint const& hint) {
+    return computeReachabilityRewardsImpl(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, targetStates, qualitative, hint);
+}
+
 template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -408,9 +486,10 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
 }
 
 template<typename ValueType, typename RewardModelType>
-std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityTimes(
+template<typename BackwardTransitionsType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityTimesImpl(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative,
+    BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative,
     ModelCheckerHint const& hint) {
     return computeReachabilityRewards(
         env, std::move(goal), transitionMatrix, backwardTransitions,
@@ -420,6 +499,22 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
         targetStates, qualitative, [&]() { return storm::storage::BitVector(transitionMatrix.getRowGroupCount(), false); }, hint);
 }
 
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityTimes(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative,
+    ModelCheckerHint const& hint) {
+    return computeReachabilityTimesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, targetStates, qualitative, hint);
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityTimes(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative,
+    ModelCheckerHint const& hint) {
+    return computeReachabilityTimesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, targetStates, qualitative, hint);
+}
+
 // This function computes an upper bound on the reachability rewards (see Baier et al, CAV'17).
 template<typename ValueType>
 std::vector<ValueType> computeUpperRewardBounds(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
@@ -437,9 +532,10 @@ std::vector<storm::RationalFunction> computeUpperRewardBounds(storm::storage::Sp
 }
 
 template<typename ValueType, typename RewardModelType>
+template<typename BackwardTransitionsType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    BackwardTransitionsType const& backwardTransitions,
     std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const&
         totalStateRewardVectorGetter,
     storm::storage::BitVector const& targetStates, bool qualitative, std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter,
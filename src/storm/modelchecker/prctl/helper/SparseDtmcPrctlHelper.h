@@ -11,6 +11,7 @@
 
 #include "storm/logic/OperatorFormula.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/SparseAdjacency.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/solver/LinearEquationSolver.h"
@@ -39,6 +40,12 @@ class SparseDtmcPrctlHelper {
                                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                             bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
 
+    static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                            storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                            storm::storage::SparseAdjacency const& backwardTransitions,
+                                                            storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                            bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
+
     static std::vector<ValueType> computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                storm::storage::BitVector const& initialStates, storm::storage::BitVector const& phiStates,
@@ -49,6 +56,11 @@ class SparseDtmcPrctlHelper {
                                                                storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                storm::storage::BitVector const& psiStates, bool qualitative);
 
+    static std::vector<ValueType> computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                               storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                               storm::storage::SparseAdjacency const& backwardTransitions,
+                                                               storm::storage::BitVector const& psiStates, bool qualitative);
+
     static std::vector<ValueType> computeCumulativeRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                            storm::storage::SparseMatrix<ValueType> const& transitionMatrix, RewardModelType const& rewardModel,
                                                            uint_fast64_t stepBound);
@@ -62,12 +74,23 @@ class SparseDtmcPrctlHelper {
                                                       storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel,
                                                       bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
 
+    static std::vector<ValueType> computeTotalRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                      storm::storage::SparseAdjacency const& backwardTransitions, RewardModelType const& rewardModel,
+                                                      bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
+
     static std::vector<ValueType> computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                              storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                              RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
                                                              bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
 
+    static std::vector<ValueType> computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                             storm::storage::SparseAdjacency const& backwardTransitions,
+                                                             RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+                                                             bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
+
     static std::vector<ValueType> computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                              storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
@@ -81,6 +104,12 @@ class SparseDtmcPrctlHelper {
                                                            storm::storage::BitVector const& targetStates, bool qualitative,
                                                            ModelCheckerHint const& hint = ModelCheckerHint());
 
+    static std::vector<ValueType> computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                           storm::storage::SparseAdjacency const& backwardTransitions,
+                                                           storm::storage::BitVector const& targetStates, bool qualitative,
+                                                           ModelCheckerHint const& hint = ModelCheckerHint());
+
     static std::vector<ValueType> computeConditionalProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                   storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                   storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
@@ -94,9 +123,43 @@ class SparseDtmcPrctlHelper {
                                                             storm::storage::BitVector const& conditionStates, bool qualitative);
 
    private:
+    template<typename BackwardTransitionsType>
+    static std::vector<ValueType> computeUntilProbabilitiesImpl(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                BackwardTransitionsType const& backwardTransitions,
+                                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                bool qualitative, ModelCheckerHint const& hint);
+
+    template<typename BackwardTransitionsType>
+    static std::vector<ValueType> computeGloballyProbabilitiesImpl(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                                   storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                   BackwardTransitionsType const& backwardTransitions,
+                                                                   storm::storage::BitVector const& psiStates, bool qualitative);
+
+    template<typename BackwardTransitionsType>
+    static std::vector<ValueType> computeTotalRewardsImpl(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                          storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                          BackwardTransitionsType const& backwardTransitions, RewardModelType const& rewardModel,
+                                                          bool qualitative, ModelCheckerHint const& hint);
+
+    template<typename BackwardTransitionsType>
+    static std::vector<ValueType> computeReachabilityRewardsImpl(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                                 storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                 BackwardTransitionsType const& backwardTransitions,
+                                                                 RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+                                                                 bool qualitative, ModelCheckerHint const& hint);
+
+    template<typename BackwardTransitionsType>
+    static std::vector<ValueType> computeReachabilityTimesImpl(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                               storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                               BackwardTransitionsType const& backwardTransitions,
+                                                               storm::storage::BitVector const& targetStates, bool qualitative,
+                                                               ModelCheckerHint const& hint);
+
+    template<typename BackwardTransitionsType>
     static std::vector<ValueType> computeReachabilityRewards(
         Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-        storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+        BackwardTransitionsType const& backwardTransitions,
         std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const&
             totalStateRewardVectorGetter,
         storm::storage::BitVector const& targetStates, bool qualitative, std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter,
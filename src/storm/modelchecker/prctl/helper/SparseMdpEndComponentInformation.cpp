@@ -372,10 +372,10 @@ void SparseMdpEndComponentInformation<ValueType>::setValues(std::vector<ValueTyp
 }
 
 template<typename ValueType>
-template<typename SolutionType>
+template<typename SolutionType, typename BackwardTransitionsType>
 void SparseMdpEndComponentInformation<ValueType>::setScheduler(storm::storage::Scheduler<SolutionType>& scheduler, storm::storage::BitVector const& maybeStates,
                                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                               storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                               BackwardTransitionsType const& backwardTransitions,
                                                                std::vector<uint64_t> const& fromResult) {
     // The following assumes that row groups associated to EC states are at the very end.
     storm::storage::BitVector maybeStatesWithoutChoice(maybeStates.size(), false);
@@ -439,6 +439,22 @@ template void SparseMdpEndComponentInformation<storm::Interval>::setScheduler(st
                                                                               storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                                               std::vector<uint64_t> const& fromResult);
 
+template void SparseMdpEndComponentInformation<double>::setScheduler(storm::storage::Scheduler<double>& scheduler, storm::storage::BitVector const& maybeStates,
+                                                                     storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                     storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                     std::vector<uint64_t> const& fromResult);
+
+template void SparseMdpEndComponentInformation<storm::RationalNumber>::setScheduler(
+    storm::storage::Scheduler<storm::RationalNumber>& scheduler, storm::storage::BitVector const& maybeStates,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseAdjacency const& backwardTransitions,
+    std::vector<uint64_t> const& fromResult);
+
+template void SparseMdpEndComponentInformation<storm::Interval>::setScheduler(storm::storage::Scheduler<double>& scheduler,
+                                                                              storm::storage::BitVector const& maybeStates,
+                                                                              storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                                              storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                              std::vector<uint64_t> const& fromResult);
+
 // template class SparseMdpEndComponentInformation<storm::RationalFunction>;
 
 }  // namespace helper
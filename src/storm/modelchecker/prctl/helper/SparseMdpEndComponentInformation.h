@@ -6,6 +6,7 @@
 namespace storm {
 namespace storage {
 class BitVector;
+class SparseAdjacency;
 
 template<typename ValueType>
 class SparseMatrix;
@@ -68,9 +69,9 @@ class SparseMdpEndComponentInformation {
 
     void setValues(std::vector<ValueType>& result, storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& fromResult);
 
-    template<typename SolutionType>
+    template<typename SolutionType, typename BackwardTransitionsType>
     void setScheduler(storm::storage::Scheduler<SolutionType>& scheduler, storm::storage::BitVector const& maybeStates,
-                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix, BackwardTransitionsType const& backwardTransitions,
                       std::vector<uint64_t> const& fromResult);
 
    private:
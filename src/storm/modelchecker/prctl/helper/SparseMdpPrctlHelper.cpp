@@ -1,5 +1,6 @@
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
+#include <algorithm>
 #include <boost/container/flat_map.hpp>
 
 #include "storm/modelchecker/prctl/helper/SemanticSolutionType.h"
@@ -33,6 +34,7 @@
 #include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/io/export.h"
+#include "storm/utility/MemoryAccounting.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
@@ -83,32 +85,44 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         // In case of cdf export we store the necessary data.
         std::vector<std::vector<ValueType>> cdfData;
 
-        storm::utility::ProgressMeasurement progress("epochs");
-        progress.setMaxCount(epochOrder.size());
-        progress.startNewMeasurement(0);
-        uint64_t numCheckedEpochs = 0;
-        for (auto const& epoch : epochOrder) {
-            swBuild.start();
-            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-            swBuild.stop();
+        if (rewardUnfolding.getNumberOfEpochWorkers() > 1 && !storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
+            // Epochs within a wavefront are analyzed concurrently, where each worker uses its own solver.
+            uint64_t numberOfWorkers = rewardUnfolding.getNumberOfEpochWorkers();
+            std::vector<std::vector<ValueType>> workerX(numberOfWorkers), workerB(numberOfWorkers);
+            std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> workerSolvers(numberOfWorkers);
             swCheck.start();
-            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+            rewardUnfolding.analyzeEpochs(epochOrder, [&](auto& epochModel, auto const&, uint64_t worker) {
+                return epochModel.analyzeSingleObjective(preciseEnv, dir, workerX[worker], workerB[worker], workerSolvers[worker], lowerBound, upperBound);
+            });
             swCheck.stop();
-            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-                !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-                std::vector<ValueType> cdfEntry;
-                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                    uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                       rewardUnfolding.getDimension(i).scalingFactor);
+        } else {
+            storm::utility::ProgressMeasurement progress("epochs");
+            progress.setMaxCount(epochOrder.size());
+            progress.startNewMeasurement(0);
+            uint64_t numCheckedEpochs = 0;
+            for (auto const& epoch : epochOrder) {
+                swBuild.start();
+                auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+                swBuild.stop();
+                swCheck.start();
+                rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+                swCheck.stop();
+                if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
+                    !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                    std::vector<ValueType> cdfEntry;
+                    for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                        uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+                        cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                                           rewardUnfolding.getDimension(i).scalingFactor);
+                    }
+                    cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                    cdfData.push_back(std::move(cdfEntry));
+                }
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+                if (storm::utility::resources::isTerminate()) {
+                    break;
                 }
-                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-                cdfData.push_back(std::move(cdfEntry));
-            }
-            ++numCheckedEpochs;
-            progress.updateProgress(numCheckedEpochs);
-            if (storm::utility::resources::isTerminate()) {
-                break;
             }
         }
 
@@ -162,10 +176,10 @@ std::vector<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::compute
     }
 }
 
-template<typename ValueType, typename SolutionType = ValueType>
+template<typename ValueType, typename SolutionType = ValueType, typename BackwardTransitionsType>
 std::vector<uint_fast64_t> computeValidSchedulerHint(Environment const& env, SemanticSolutionType const& type,
                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                     BackwardTransitionsType const& backwardTransitions,
                                                      storm::storage::BitVector const& maybeStates, storm::storage::BitVector const& filterStates,
                                                      storm::storage::BitVector const& targetStates,
                                                      boost::optional<storm::storage::BitVector> const& selectedChoices) {
@@ -282,9 +296,9 @@ struct SparseMdpHintType {
     bool noEndComponents;
 };
 
-template<typename ValueType, typename SolutionType>
+template<typename ValueType, typename SolutionType, typename BackwardTransitionsType>
 void extractValueAndSchedulerHint(SparseMdpHintType<SolutionType>& hintStorage, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& maybeStates,
+                                  BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& maybeStates,
                                   boost::optional<storm::storage::BitVector> const& selectedChoices, ModelCheckerHint const& hint,
                                   bool skipECWithinMaybeStatesCheck) {
     // Deal with scheduler hint.
@@ -295,12 +309,19 @@ void extractValueAndSchedulerHint(SparseMdpHintType<SolutionType>& hintStorage,
             auto const& schedulerHint = hint.template asExplicitModelCheckerHint<ValueType>().getSchedulerHint();
             std::vector<uint64_t> hintChoices;
 
-            // The scheduler hint is only applicable if it induces no BSCC consisting of maybe states.
-            bool hintApplicable;
-            if (!skipECWithinMaybeStatesCheck) {
+            // The scheduler hint is only applicable if it selects existing choices (it might stem from a different model) ...
+            bool hintApplicable = std::all_of(maybeStates.begin(), maybeStates.end(), [&](uint64_t state) {
+                return schedulerHint.getChoice(state).isDefined() &&
+                       schedulerHint.getChoice(state).getDeterministicChoice() < transitionMatrix.getRowGroupSize(state);
+            });
+            // ... and if it induces no BSCC consisting of maybe states.
+            if (!hintApplicable) {
+                STORM_LOG_INFO("The provided scheduler hint selects choices that do not exist and is ignored.");
+            } else if (!skipECWithinMaybeStatesCheck) {
                 hintChoices.reserve(maybeStates.size());
                 for (uint_fast64_t state = 0; state < maybeStates.size(); ++state) {
-                    hintChoices.push_back(schedulerHint.getChoice(state).getDeterministicChoice());
+                    // The choices of non-maybe states do not matter.
+                    hintChoices.push_back(maybeStates.get(state) ? schedulerHint.getChoice(state).getDeterministicChoice() : 0);
                 }
                 hintApplicable =
                     storm::utility::graph::performProb1(transitionMatrix.transposeSelectedRowsFromRowGroups(hintChoices), maybeStates, ~maybeStates).full();
@@ -339,10 +360,10 @@ void extractValueAndSchedulerHint(SparseMdpHintType<SolutionType>& hintStorage,
     }
 }
 
-template<typename ValueType, typename SolutionType>
+template<typename ValueType, typename SolutionType, typename BackwardTransitionsType>
 SparseMdpHintType<SolutionType> computeHints(Environment const& env, SemanticSolutionType const& type, ModelCheckerHint const& hint,
                                              storm::OptimizationDirection const& dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& maybeStates,
+                                             BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& maybeStates,
                                              storm::storage::BitVector const& phiStates, storm::storage::BitVector const& targetStates, bool produceScheduler,
                                              boost::optional<storm::storage::BitVector> const& selectedChoices = boost::none) {
     SparseMdpHintType<SolutionType> result;
@@ -536,12 +557,13 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
     return result;
 }
 
-template<typename ValueType, typename SolutionType>
+template<typename ValueType, typename SolutionType, typename BackwardTransitionsType>
 QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType, SolutionType> const& goal,
                                                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                     BackwardTransitionsType const& backwardTransitions,
                                                                                      storm::storage::BitVector const& phiStates,
                                                                                      storm::storage::BitVector const& psiStates) {
+    storm::utility::memory::MemoryStage memoryStage("qualitative analysis");
     QualitativeStateSetsUntilProbabilities result;
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
@@ -560,10 +582,10 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
     return result;
 }
 
-template<typename ValueType, typename SolutionType>
+template<typename ValueType, typename SolutionType, typename BackwardTransitionsType>
 QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType, SolutionType> const& goal,
                                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                 storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                 BackwardTransitionsType const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint) {
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
@@ -593,10 +615,10 @@ void extractSchedulerChoices(storm::storage::Scheduler<SolutionType>& scheduler,
     }
 }
 
-template<typename ValueType, typename SolutionType>
+template<typename ValueType, typename SolutionType, typename BackwardTransitionsType>
 void extendScheduler(storm::storage::Scheduler<SolutionType>& scheduler, storm::solver::SolveGoal<ValueType, SolutionType> const& goal,
                      QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                     BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& phiStates,
                      storm::storage::BitVector const& psiStates) {
     // Finally, if we need to produce a scheduler, we also need to figure out the parts of the scheduler for
     // the states with probability 1 or 0 (depending on whether we maximize or minimize).
@@ -647,10 +669,10 @@ void computeFixedPointSystemUntilProbabilities(storm::solver::SolveGoal<ValueTyp
     goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
 }
 
-template<typename ValueType, typename SolutionType>
+template<typename ValueType, typename SolutionType, typename BackwardTransitionsType>
 boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(
     storm::solver::SolveGoal<ValueType, SolutionType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets,
+    BackwardTransitionsType const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets,
     storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b, bool produceScheduler) {
     // Get the set of states that (under some scheduler) can stay in the set of maybestates forever
     storm::storage::BitVector candidateStates = storm::utility::graph::performProb0E(
@@ -695,9 +717,10 @@ boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSy
 }
 
 template<typename ValueType, typename SolutionType>
-MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilities(
+template<typename BackwardTransitionsType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilitiesImpl(
     Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
     bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
     STORM_LOG_THROW(!qualitative || !produceScheduler, storm::exceptions::InvalidSettingsException,
                     "Cannot produce scheduler when performing qualitative model checking only.");
@@ -808,9 +831,28 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
 }
 
 template<typename ValueType, typename SolutionType>
-MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeGloballyProbabilities(
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    return computeUntilProbabilitiesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, phiStates, psiStates, qualitative, produceScheduler,
+                                         hint);
+}
+
+template<typename ValueType, typename SolutionType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    return computeUntilProbabilitiesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, phiStates, psiStates, qualitative, produceScheduler,
+                                         hint);
+}
+
+template<typename ValueType, typename SolutionType>
+template<typename BackwardTransitionsType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeGloballyProbabilitiesImpl(
+    Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler,
     bool useMecBasedTechnique) {
     if (useMecBasedTechnique) {
         // TODO: does this really work for minimizing objectives?
@@ -836,6 +878,24 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
     }
 }
 
+template<typename ValueType, typename SolutionType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeGloballyProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler,
+    bool useMecBasedTechnique) {
+    return computeGloballyProbabilitiesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, psiStates, qualitative, produceScheduler,
+                                            useMecBasedTechnique);
+}
+
+template<typename ValueType, typename SolutionType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeGloballyProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler,
+    bool useMecBasedTechnique) {
+    return computeGloballyProbabilitiesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, psiStates, qualitative, produceScheduler,
+                                            useMecBasedTechnique);
+}
+
 template<typename ValueType, typename SolutionType>
 template<typename RewardModelType>
 std::vector<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeInstantaneousRewards(
@@ -882,10 +942,10 @@ std::vector<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::compute
 }
 
 template<typename ValueType, typename SolutionType>
-template<typename RewardModelType>
-MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeTotalRewards(
+template<typename RewardModelType, typename BackwardTransitionsType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeTotalRewardsImpl(
     Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, bool qualitative, bool produceScheduler,
+    BackwardTransitionsType const& backwardTransitions, RewardModelType const& rewardModel, bool qualitative, bool produceScheduler,
     ModelCheckerHint const& hint) {
     // Reduce to reachability rewards
     if (goal.minimize()) {
@@ -982,9 +1042,27 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
 
 template<typename ValueType, typename SolutionType>
 template<typename RewardModelType>
-MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityRewards(
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, bool qualitative, bool produceScheduler,
+    ModelCheckerHint const& hint) {
+    return computeTotalRewardsImpl(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, qualitative, produceScheduler, hint);
+}
+
+template<typename ValueType, typename SolutionType>
+template<typename RewardModelType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeTotalRewards(
+    Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, RewardModelType const& rewardModel, bool qualitative, bool produceScheduler,
+    ModelCheckerHint const& hint) {
+    return computeTotalRewardsImpl(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, qualitative, produceScheduler, hint);
+}
+
+template<typename ValueType, typename SolutionType>
+template<typename RewardModelType, typename BackwardTransitionsType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityRewardsImpl(
+    Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    BackwardTransitionsType const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
     bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
     // Only compute the result if the model has at least one reward this->getModel().
     STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Reward model for formula is empty. Skipping formula.");
@@ -998,9 +1076,30 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
 }
 
 template<typename ValueType, typename SolutionType>
-MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityTimes(
+template<typename RewardModelType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    return computeReachabilityRewardsImpl(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, targetStates, qualitative,
+                                          produceScheduler, hint);
+}
+
+template<typename ValueType, typename SolutionType>
+template<typename RewardModelType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityRewards(
+    Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    return computeReachabilityRewardsImpl(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, targetStates, qualitative,
+                                          produceScheduler, hint);
+}
+
+template<typename ValueType, typename SolutionType>
+template<typename BackwardTransitionsType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityTimesImpl(
+    Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
     ModelCheckerHint const& hint) {
     return computeReachabilityRewardsHelper(
         env, std::move(goal), transitionMatrix, backwardTransitions,
@@ -1011,6 +1110,22 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
         [&]() { return storm::storage::BitVector(transitionMatrix.getRowCount(), false); }, hint);
 }
 
+template<typename ValueType, typename SolutionType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityTimes(
+    Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
+    ModelCheckerHint const& hint) {
+    return computeReachabilityTimesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, targetStates, qualitative, produceScheduler, hint);
+}
+
+template<typename ValueType, typename SolutionType>
+MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityTimes(
+    Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
+    ModelCheckerHint const& hint) {
+    return computeReachabilityTimesImpl(env, std::move(goal), transitionMatrix, backwardTransitions, targetStates, qualitative, produceScheduler, hint);
+}
+
 #ifdef STORM_HAVE_CARL
 template<typename ValueType, typename SolutionType>
 std::vector<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityRewards(
@@ -1080,11 +1195,12 @@ QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewar
     return result;
 }
 
-template<typename ValueType, typename SolutionType>
+template<typename ValueType, typename SolutionType, typename BackwardTransitionsType>
 QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityRewards(
     storm::solver::SolveGoal<ValueType, SolutionType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates,
+    BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& targetStates,
     std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
+    storm::utility::memory::MemoryStage memoryStage("qualitative analysis");
     QualitativeStateSetsReachabilityRewards result;
     storm::storage::BitVector trueStates(transitionMatrix.getRowGroupCount(), true);
     if (goal.minimize()) {
@@ -1111,10 +1227,10 @@ QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityR
     return result;
 }
 
-template<typename ValueType, typename SolutionType>
+template<typename ValueType, typename SolutionType, typename BackwardTransitionsType>
 QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewards(storm::solver::SolveGoal<ValueType, SolutionType> const& goal,
                                                                                    storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                   storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                   BackwardTransitionsType const& backwardTransitions,
                                                                                    storm::storage::BitVector const& targetStates, ModelCheckerHint const& hint,
                                                                                    std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter,
                                                                                    std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
@@ -1126,10 +1242,10 @@ QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewar
     }
 }
 
-template<typename ValueType, typename SolutionType>
+template<typename ValueType, typename SolutionType, typename BackwardTransitionsType>
 void extendScheduler(storm::storage::Scheduler<SolutionType>& scheduler, storm::solver::SolveGoal<ValueType, SolutionType> const& goal,
                      QualitativeStateSetsReachabilityRewards const& qualitativeStateSets, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates,
+                     BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& targetStates,
                      std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
     // Finally, if we need to produce a scheduler, we also need to figure out the parts of the scheduler for
     // the states with reward zero/infinity.
@@ -1202,10 +1318,10 @@ void computeFixedPointSystemReachabilityRewards(
     goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
 }
 
-template<typename ValueType, typename SolutionType>
+template<typename ValueType, typename SolutionType, typename BackwardTransitionsType>
 boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemReachabilityRewardsEliminateEndComponents(
     storm::solver::SolveGoal<ValueType, SolutionType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsReachabilityRewards const& qualitativeStateSets,
+    BackwardTransitionsType const& backwardTransitions, QualitativeStateSetsReachabilityRewards const& qualitativeStateSets,
     boost::optional<storm::storage::BitVector> const& selectedChoices,
     std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const&
         totalStateRewardVectorGetter,
@@ -1306,9 +1422,10 @@ void computeUpperRewardBounds(SparseMdpHintType<SolutionType>& hintInformation,
 }
 
 template<typename ValueType, typename SolutionType>
+template<typename BackwardTransitionsType>
 MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityRewardsHelper(
     Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    BackwardTransitionsType const& backwardTransitions,
     std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const&
         totalStateRewardVectorGetter,
     storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
@@ -1624,10 +1741,18 @@ template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<dou
     Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel,
     storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
+template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeReachabilityRewards(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel,
+    storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
 template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, bool qualitative,
     bool produceScheduler, ModelCheckerHint const& hint);
+template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeTotalRewards(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, bool qualitative,
+    bool produceScheduler, ModelCheckerHint const& hint);
 
 #ifdef STORM_HAVE_CARL
 template class SparseMdpPrctlHelper<storm::RationalNumber>;
@@ -1642,11 +1767,21 @@ template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdp
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
     storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative,
     bool produceScheduler, ModelCheckerHint const& hint);
+template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeReachabilityRewards(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions,
+    storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative,
+    bool produceScheduler, ModelCheckerHint const& hint);
 template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
     storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, bool qualitative, bool produceScheduler,
     ModelCheckerHint const& hint);
+template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeTotalRewards(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions,
+    storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, bool qualitative, bool produceScheduler,
+    ModelCheckerHint const& hint);
 #endif
 
 template class SparseMdpPrctlHelper<storm::Interval, double>;
@@ -1660,10 +1795,18 @@ template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<sto
     Environment const& env, storm::solver::SolveGoal<storm::Interval, double>&& goal, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::Interval> const& rewardModel,
     storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
+template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<storm::Interval, double>::computeReachabilityRewards(
+    Environment const& env, storm::solver::SolveGoal<storm::Interval, double>&& goal, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::Interval> const& rewardModel,
+    storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
 template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<storm::Interval, double>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<storm::Interval, double>&& goal, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::Interval> const& rewardModel,
     bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
+template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<storm::Interval, double>::computeTotalRewards(
+    Environment const& env, storm::solver::SolveGoal<storm::Interval, double>&& goal, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::Interval> const& rewardModel,
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
 
 }  // namespace helper
 }  // namespace modelchecker
@@ -7,6 +7,7 @@
 #include "storm/modelchecker/hints/ModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/storage/MaximalEndComponent.h"
+#include "storm/storage/SparseAdjacency.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/solver/SolveGoal.h"
@@ -50,6 +51,11 @@ class SparseMdpPrctlHelper {
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
         storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
 
+    static MDPSparseModelCheckingHelperReturnType<SolutionType> computeUntilProbabilities(
+        Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+
     static MDPSparseModelCheckingHelperReturnType<SolutionType> computeGloballyProbabilities(Environment const& env,
                                                                                              storm::solver::SolveGoal<ValueType, SolutionType>&& goal,
                                                                                              storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -57,6 +63,13 @@ class SparseMdpPrctlHelper {
                                                                                              storm::storage::BitVector const& psiStates, bool qualitative,
                                                                                              bool produceScheduler, bool useMecBasedTechnique = false);
 
+    static MDPSparseModelCheckingHelperReturnType<SolutionType> computeGloballyProbabilities(Environment const& env,
+                                                                                             storm::solver::SolveGoal<ValueType, SolutionType>&& goal,
+                                                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                             storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                                             storm::storage::BitVector const& psiStates, bool qualitative,
+                                                                                             bool produceScheduler, bool useMecBasedTechnique = false);
+
     template<typename RewardModelType>
     static std::vector<SolutionType> computeInstantaneousRewards(Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal,
                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -75,17 +88,36 @@ class SparseMdpPrctlHelper {
                                                                                     RewardModelType const& rewardModel, bool qualitative, bool produceScheduler,
                                                                                     ModelCheckerHint const& hint = ModelCheckerHint());
 
+    template<typename RewardModelType>
+    static MDPSparseModelCheckingHelperReturnType<SolutionType> computeTotalRewards(Environment const& env,
+                                                                                    storm::solver::SolveGoal<ValueType, SolutionType>&& goal,
+                                                                                    storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                    storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                                    RewardModelType const& rewardModel, bool qualitative, bool produceScheduler,
+                                                                                    ModelCheckerHint const& hint = ModelCheckerHint());
+
     template<typename RewardModelType>
     static MDPSparseModelCheckingHelperReturnType<SolutionType> computeReachabilityRewards(
         Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
         bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
 
+    template<typename RewardModelType>
+    static MDPSparseModelCheckingHelperReturnType<SolutionType> computeReachabilityRewards(
+        Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        storm::storage::SparseAdjacency const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+        bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+
     static MDPSparseModelCheckingHelperReturnType<SolutionType> computeReachabilityTimes(
         Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative,
         bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
 
+    static MDPSparseModelCheckingHelperReturnType<SolutionType> computeReachabilityTimes(
+        Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative,
+        bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+
     static std::vector<SolutionType> computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal,
                                                                 storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                 storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
@@ -99,9 +131,40 @@ class SparseMdpPrctlHelper {
                                                                         storm::storage::BitVector const& conditionStates);
 
    private:
+    template<typename BackwardTransitionsType>
+    static MDPSparseModelCheckingHelperReturnType<SolutionType> computeUntilProbabilitiesImpl(
+        Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+        bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
+
+    template<typename BackwardTransitionsType>
+    static MDPSparseModelCheckingHelperReturnType<SolutionType> computeGloballyProbabilitiesImpl(
+        Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler,
+        bool useMecBasedTechnique);
+
+    template<typename RewardModelType, typename BackwardTransitionsType>
+    static MDPSparseModelCheckingHelperReturnType<SolutionType> computeTotalRewardsImpl(
+        Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        BackwardTransitionsType const& backwardTransitions, RewardModelType const& rewardModel, bool qualitative, bool produceScheduler,
+        ModelCheckerHint const& hint);
+
+    template<typename RewardModelType, typename BackwardTransitionsType>
+    static MDPSparseModelCheckingHelperReturnType<SolutionType> computeReachabilityRewardsImpl(
+        Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        BackwardTransitionsType const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
+        bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
+
+    template<typename BackwardTransitionsType>
+    static MDPSparseModelCheckingHelperReturnType<SolutionType> computeReachabilityTimesImpl(
+        Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
+        ModelCheckerHint const& hint);
+
+    template<typename BackwardTransitionsType>
     static MDPSparseModelCheckingHelperReturnType<SolutionType> computeReachabilityRewardsHelper(
         Environment const& env, storm::solver::SolveGoal<ValueType, SolutionType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-        storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+        BackwardTransitionsType const& backwardTransitions,
         std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const&
             totalStateRewardVectorGetter,
         storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
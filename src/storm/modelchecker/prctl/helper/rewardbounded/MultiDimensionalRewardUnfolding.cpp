@@ -4,7 +4,10 @@
 #include <set>
 #include <string>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/logic/Formulas.h"
+#include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
 
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
@@ -403,11 +406,20 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
 
 template<typename ValueType, bool SingleObjectiveMode>
 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
+    return setCurrentEpoch(mainEpochModelInstance, epoch);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(EpochModelInstance& instance,
+                                                                                                                       Epoch const& epoch) {
     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
+    auto& epochModel = instance.epochModel;
+    auto& currentEpoch = instance.currentEpoch;
+    auto const& epochModelToProductChoiceMap = instance.epochModelToProductChoiceMap;
 
     // Check if we need to update the current epoch class
     if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
-        setCurrentEpochClass(epoch);
+        setCurrentEpochClass(instance, epoch);
         epochModel.epochMatrixChanged = true;
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
             if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
@@ -515,7 +527,9 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
-void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch) {
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(EpochModelInstance& instance, Epoch const& epoch) {
+    auto& epochModel = instance.epochModel;
+    auto& epochModelToProductChoiceMap = instance.epochModelToProductChoiceMap;
     EpochClass epochClass = epochManager.getEpochClass(epoch);
     // std::cout << "Setting epoch class for epoch " << epochManager.toString(epoch) << '\n';
     auto productObjectiveRewards = productModel->computeObjectiveRewards(epochClass, objectives);
@@ -659,7 +673,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
     for (auto productState : productInStates) {
         toEpochModelInStatesMap[productState] = epochModelStateToInStateMap[productToEpochModelStateMapping[productState]];
     }
-    productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
+    instance.productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
 
     epochModel.objectiveRewardFilter.clear();
     for (auto const& objRewards : epochModel.objectiveRewards) {
@@ -672,7 +686,7 @@ template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEquationSystemFormatForEpochModel(
     storm::solver::LinearEquationSolverProblemFormat eqSysFormat) {
     STORM_LOG_ASSERT(model.isOfType(storm::models::ModelType::Dtmc), "Trying to set the equation problem format although the model is not deterministic.");
-    epochModel.equationSolverProblemFormat = eqSysFormat;
+    mainEpochModelInstance.epochModel.equationSolverProblemFormat = eqSysFormat;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -863,16 +877,21 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
-    STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
-    STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    STORM_LOG_ASSERT(mainEpochModelInstance.currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+    STORM_LOG_ASSERT(inStateSolutions.size() == mainEpochModelInstance.epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    setSolutionForEpoch(mainEpochModelInstance.currentEpoch.get(), mainEpochModelInstance.productStateToEpochModelInStateMap, std::move(inStateSolutions));
+}
 
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForEpoch(
+    Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap, std::vector<SolutionType>&& inStateSolutions) {
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
+    predecessorEpochs.erase(epoch);
+    successorEpochs.erase(epoch);
 
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
@@ -887,9 +906,90 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     // add the new solution
     EpochSolution solution;
     solution.count = predecessorEpochs.size();
-    solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
+    solution.productStateToSolutionVectorMap = productStateToSolutionVectorMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    epochSolutions[epoch] = std::move(solution);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getNumberOfEpochWorkers() const {
+#ifdef STORM_HAVE_INTELTBB
+    if (std::is_same_v<ValueType, double> && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        return std::max<int>(1, tbb::this_task_arena::max_concurrency());
+    }
+#endif
+    return 1;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(
+    std::vector<Epoch> const& epochs,
+    std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&, Epoch const&, uint64_t)> const& analyzeEpochModel) {
+    uint64_t const numberOfWorkers = getNumberOfEpochWorkers();
+    STORM_LOG_THROW(numberOfWorkers > 1, storm::exceptions::NotSupportedException,
+                    "Concurrent analysis of epochs requires Intel TBB to be enabled. Use setCurrentEpoch and setSolutionForCurrentEpoch instead.");
+    storm::utility::ProgressMeasurement progress("epochs");
+    progress.setMaxCount(epochs.size());
+    progress.startNewMeasurement(0);
+    uint64_t numberOfAnalyzedEpochs = 0;
+
+#ifdef STORM_HAVE_INTELTBB
+    // Group the epochs into wavefronts. An epoch only depends on its successor epochs, which precede it in the given order.
+    std::vector<std::vector<Epoch>> wavefronts;
+    {
+        std::map<Epoch, uint64_t> wavefrontOfEpoch;
+        for (auto const& epoch : epochs) {
+            uint64_t wavefront = 0;
+            for (auto const& step : possibleEpochSteps) {
+                auto successorIt = wavefrontOfEpoch.find(epochManager.getSuccessorEpoch(epoch, step));
+                if (successorIt != wavefrontOfEpoch.end()) {
+                    wavefront = std::max(wavefront, successorIt->second + 1);
+                }
+            }
+            wavefrontOfEpoch.emplace(epoch, wavefront);
+            if (wavefront == wavefronts.size()) {
+                wavefronts.emplace_back();
+            }
+            wavefronts[wavefront].push_back(epoch);
+        }
+    }
+    STORM_LOG_INFO("Analyzing " << epochs.size() << " epochs in " << wavefronts.size() << " wavefronts using " << numberOfWorkers << " workers.");
+
+    // Each worker builds its own epoch models.
+    std::vector<EpochModelInstance> instances(numberOfWorkers);
+    for (auto& instance : instances) {
+        instance.epochModel.equationSolverProblemFormat = mainEpochModelInstance.epochModel.equationSolverProblemFormat;
+    }
+    for (auto const& wavefront : wavefronts) {
+        std::vector<std::vector<SolutionType>> solutions(wavefront.size());
+        std::vector<std::shared_ptr<std::vector<uint64_t> const>> solutionVectorMaps(wavefront.size());
+        // Epochs of the same epoch class are adjacent, so keeping them together avoids rebuilding the epoch model structure.
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, wavefront.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            // Isolation guarantees that this thread does not pick up another chunk (which would use the same instance) while waiting for nested parallel work.
+            tbb::this_task_arena::isolate([&]() {
+                uint64_t worker = tbb::this_task_arena::current_thread_index();
+                STORM_LOG_ASSERT(worker < numberOfWorkers, "Unexpected worker index.");
+                auto& instance = instances[worker];
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    auto& epochModel = setCurrentEpoch(instance, wavefront[index]);
+                    solutions[index] = analyzeEpochModel(epochModel, wavefront[index], worker);
+                    STORM_LOG_ASSERT(solutions[index].size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+                    solutionVectorMaps[index] = instance.productStateToEpochModelInStateMap;
+                }
+            });
+        });
+        // Storing the solutions also releases the solutions of successor epochs that are no longer needed.
+        for (uint64_t index = 0; index < wavefront.size(); ++index) {
+            setSolutionForEpoch(wavefront[index], solutionVectorMaps[index], std::move(solutions[index]));
+        }
+        numberOfAnalyzedEpochs += wavefront.size();
+        progress.updateProgress(numberOfAnalyzedEpochs);
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+    }
+#endif
+    return numberOfAnalyzedEpochs;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
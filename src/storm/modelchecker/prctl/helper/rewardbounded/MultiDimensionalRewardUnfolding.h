@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/Dimension.h"
@@ -78,6 +79,26 @@ class MultiDimensionalRewardUnfolding {
     boost::optional<ValueType> getLowerObjectiveBound(uint64_t objectiveIndex = 0);
 
     void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions);
+
+    /*!
+     * Returns the number of workers that analyzeEpochs uses. This is one, unless parallelization is enabled.
+     */
+    uint64_t getNumberOfEpochWorkers() const;
+
+    /*!
+     * Analyzes the given epochs and stores their solutions, as repeated calls of setCurrentEpoch and setSolutionForCurrentEpoch would do.
+     * Epochs whose successor epochs are all solved (i.e. a wavefront in the epoch lattice) are independent of each other and are distributed among the
+     * workers, each of which builds its own epoch models. This requires more than one worker (see getNumberOfEpochWorkers). Otherwise, the epochs have to
+     * be analyzed one by one using setCurrentEpoch and setSolutionForCurrentEpoch.
+     *
+     * @param epochs the epochs to analyze in the order returned by getEpochComputationOrder.
+     * @param analyzeEpochModel solves the given epoch model. The last argument is the index of the calling worker (below getNumberOfEpochWorkers()), such
+     * that solvers can be reused by the same worker.
+     * @return the number of analyzed epochs. This is less than the number of given epochs if the computation was aborted.
+     */
+    uint64_t analyzeEpochs(
+        std::vector<Epoch> const& epochs,
+        std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&, Epoch const&, uint64_t)> const& analyzeEpochModel);
     SolutionType getInitialStateResult(Epoch const& epoch);  // Assumes that the initial state is unique
     SolutionType getInitialStateResult(Epoch const& epoch, uint64_t initialStateIndex);
 
@@ -85,7 +106,18 @@ class MultiDimensionalRewardUnfolding {
     Dimension<ValueType> const& getDimension(uint64_t dim) const;
 
    private:
-    void setCurrentEpochClass(Epoch const& epoch);
+    // The epoch model together with the data needed to map its solution back to the product model.
+    struct EpochModelInstance {
+        EpochModel<ValueType, SingleObjectiveMode> epochModel;
+        boost::optional<Epoch> currentEpoch;
+        std::vector<uint64_t> epochModelToProductChoiceMap;
+        std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
+    };
+
+    EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(EpochModelInstance& instance, Epoch const& epoch);
+    void setCurrentEpochClass(EpochModelInstance& instance, Epoch const& epoch);
+    void setSolutionForEpoch(Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap,
+                             std::vector<SolutionType>&& inStateSolutions);
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -129,12 +161,9 @@ class MultiDimensionalRewardUnfolding {
 
     std::unique_ptr<ProductModel<ValueType>> productModel;
 
-    std::vector<uint64_t> epochModelToProductChoiceMap;
-    std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
     std::set<Epoch> possibleEpochSteps;
 
-    EpochModel<ValueType, SingleObjectiveMode> epochModel;
-    boost::optional<Epoch> currentEpoch;
+    EpochModelInstance mainEpochModelInstance;
 
     EpochManager epochManager;
 
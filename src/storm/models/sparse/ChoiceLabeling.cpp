@@ -33,7 +33,7 @@ bool ChoiceLabeling::operator==(ChoiceLabeling const& other) const {
         if (!other.containsLabel(labelIndexPair.first)) {
             return false;
         }
-        if (labelings[labelIndexPair.second] != other.getChoices(labelIndexPair.first)) {
+        if (labelings[labelIndexPair.second] != other.labelings[other.nameToLabelingIndexMap.at(labelIndexPair.first)]) {
             return false;
         }
     }
@@ -60,6 +60,10 @@ storm::storage::BitVector const& ChoiceLabeling::getChoices(std::string const& l
     return this->getItems(label);
 }
 
+storm::storage::CompressedBitVector const& ChoiceLabeling::getCompressedChoices(std::string const& label) const {
+    return this->getCompressedItems(label);
+}
+
 void ChoiceLabeling::setChoices(std::string const& label, storage::BitVector const& labeling) {
     this->setItems(label, labeling);
 }
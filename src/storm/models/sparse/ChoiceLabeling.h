@@ -73,6 +73,14 @@ class ChoiceLabeling : public ItemLabeling {
      */
     storm::storage::BitVector const& getChoices(std::string const& label) const;
 
+    /*!
+     * Returns the compressed labeling of choices associated with the given label without creating an uncompressed copy.
+     *
+     * @param label The name of the label.
+     * @return A compressed bit vector that represents the labeling of the choices with the given label.
+     */
+    storm::storage::CompressedBitVector const& getCompressedChoices(std::string const& label) const;
+
     /*!
      * Sets the labeling of choices associated with the given label.
      *
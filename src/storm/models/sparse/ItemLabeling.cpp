@@ -10,10 +10,37 @@
 namespace storm {
 namespace models {
 namespace sparse {
-ItemLabeling::ItemLabeling(uint_fast64_t itemCount) : itemCount(itemCount), nameToLabelingIndexMap(), labelings() {
+namespace {
+// Labelings of at most this many items are small enough to also be kept uncompressed.
+uint64_t const maximalItemCountOfUncompressedLabelings = 1ull << 16;
+}  // namespace
+
+ItemLabeling::ItemLabeling(uint_fast64_t itemCount) : itemCount(itemCount), nameToLabelingIndexMap(), labelings(), uncompressedLabelings() {
     // Intentionally left empty.
 }
 
+ItemLabeling::ItemLabeling(ItemLabeling const& other)
+    : itemCount(other.itemCount), nameToLabelingIndexMap(other.nameToLabelingIndexMap), labelings(other.labelings) {
+    std::lock_guard<std::mutex> lock(other.uncompressedLabelingsMutex);
+    for (auto const& uncompressedLabeling : other.uncompressedLabelings) {
+        uncompressedLabelings.push_back(uncompressedLabeling ? std::make_unique<storm::storage::BitVector>(*uncompressedLabeling) : nullptr);
+    }
+}
+
+ItemLabeling& ItemLabeling::operator=(ItemLabeling const& other) {
+    if (this != &other) {
+        itemCount = other.itemCount;
+        nameToLabelingIndexMap = other.nameToLabelingIndexMap;
+        labelings = other.labelings;
+        std::lock_guard<std::mutex> lock(other.uncompressedLabelingsMutex);
+        uncompressedLabelings.clear();
+        for (auto const& uncompressedLabeling : other.uncompressedLabelings) {
+            uncompressedLabelings.push_back(uncompressedLabeling ? std::make_unique<storm::storage::BitVector>(*uncompressedLabeling) : nullptr);
+        }
+    }
+    return *this;
+}
+
 bool ItemLabeling::isStateLabeling() const {
     return false;
 }
@@ -45,7 +72,7 @@ bool ItemLabeling::operator==(ItemLabeling const& other) const {
         if (!other.containsLabel(labelIndexPair.first)) {
             return false;
         }
-        if (labelings[labelIndexPair.second] != other.getItems(labelIndexPair.first)) {
+        if (labelings[labelIndexPair.second] != other.labelings[other.nameToLabelingIndexMap.at(labelIndexPair.first)]) {
             return false;
         }
     }
@@ -55,7 +82,7 @@ bool ItemLabeling::operator==(ItemLabeling const& other) const {
 ItemLabeling ItemLabeling::getSubLabeling(storm::storage::BitVector const& items) const {
     ItemLabeling result(items.getNumberOfSetBits());
     for (auto const& labelIndexPair : nameToLabelingIndexMap) {
-        result.addLabel(labelIndexPair.first, labelings[labelIndexPair.second] % items);
+        result.addLabel(labelIndexPair.first, labelings[labelIndexPair.second].toBitVector() % items);
     }
     return result;
 }
@@ -73,6 +100,8 @@ void ItemLabeling::removeLabel(std::string const& label) {
     // Erase label by 'swap and pop'
     std::iter_swap(labelings.begin() + labelIndex, labelings.end() - 1);
     labelings.pop_back();
+    std::iter_swap(uncompressedLabelings.begin() + labelIndex, uncompressedLabelings.end() - 1);
+    uncompressedLabelings.pop_back();
 
     // Update index of labeling we swapped from the end
     for (auto& it : nameToLabelingIndexMap) {
@@ -86,11 +115,19 @@ void ItemLabeling::removeLabel(std::string const& label) {
 void ItemLabeling::join(ItemLabeling const& other) {
     STORM_LOG_THROW(this->itemCount == other.itemCount, storm::exceptions::InvalidArgumentException,
                     "The item count of the two labelings does not match: " << this->itemCount << " vs. " << other.itemCount << ".");
-    for (auto const& label : other.getLabels()) {
-        if (this->containsLabel(label)) {
-            this->setItems(label, this->getItems(label) | other.getItems(label));
+    for (auto const& labelIndexPair : other.nameToLabelingIndexMap) {
+        storm::storage::CompressedBitVector const& otherItems = other.labelings[labelIndexPair.second];
+        auto labelIt = nameToLabelingIndexMap.find(labelIndexPair.first);
+        if (labelIt != nameToLabelingIndexMap.end()) {
+            labelings[labelIt->second] = labelings[labelIt->second] | otherItems;
+            updateUncompressedLabeling(labelIt->second);
         } else {
-            this->addLabel(label, other.getItems(label));
+            nameToLabelingIndexMap.emplace(labelIndexPair.first, labelings.size());
+            labelings.push_back(otherItems);
+            uncompressedLabelings.emplace_back();
+            if (keepUncompressed(labelIndexPair.first)) {
+                uncompressedLabelings.back() = std::make_unique<storm::storage::BitVector>(otherItems.toBitVector());
+            }
         }
     }
 }
@@ -115,12 +152,15 @@ std::set<std::string> ItemLabeling::getLabelsOfItem(uint64_t item) const {
 
 void ItemLabeling::permuteItems(std::vector<uint64_t> const& inversePermutation) {
     STORM_LOG_THROW(inversePermutation.size() == itemCount, storm::exceptions::InvalidArgumentException, "Permutation does not match number of items");
-    std::vector<storm::storage::BitVector> newLabelings;
-    for (storm::storage::BitVector const& source : this->labelings) {
-        newLabelings.push_back(source.permute(inversePermutation));
+    std::vector<storm::storage::CompressedBitVector> newLabelings;
+    for (storm::storage::CompressedBitVector const& source : this->labelings) {
+        newLabelings.emplace_back(source.toBitVector().permute(inversePermutation));
     }
 
-    this->labelings = newLabelings;
+    this->labelings = std::move(newLabelings);
+    for (uint64_t labelIndex = 0; labelIndex < this->labelings.size(); ++labelIndex) {
+        updateUncompressedLabeling(labelIndex);
+    }
 }
 
 void ItemLabeling::addLabel(std::string const& label, storage::BitVector const& labeling) {
@@ -128,7 +168,8 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector const&
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException,
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
-    labelings.push_back(labeling);
+    labelings.emplace_back(labeling);
+    uncompressedLabelings.push_back(keepUncompressed(label) ? std::make_unique<storm::storage::BitVector>(labeling) : nullptr);
 }
 
 void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& labeling) {
@@ -136,7 +177,8 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& label
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException,
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
-    labelings.emplace_back(std::move(labeling));
+    labelings.emplace_back(labeling);
+    uncompressedLabelings.push_back(keepUncompressed(label) ? std::make_unique<storm::storage::BitVector>(std::move(labeling)) : nullptr);
 }
 
 std::string ItemLabeling::addUniqueLabel(std::string const& prefix, storage::BitVector const& labeling) {
@@ -158,14 +200,22 @@ bool ItemLabeling::containsLabel(std::string const& label) const {
 void ItemLabeling::addLabelToItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException, "Label '" << label << "' unknown.");
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, true);
+    uint64_t labelIndex = nameToLabelingIndexMap.at(label);
+    this->labelings[labelIndex].set(item, true);
+    if (this->uncompressedLabelings[labelIndex]) {
+        this->uncompressedLabelings[labelIndex]->set(item, true);
+    }
 }
 
 void ItemLabeling::removeLabelFromItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
     STORM_LOG_THROW(this->getItemHasLabel(label, item), storm::exceptions::InvalidArgumentException,
                     "Item " << item << " does not have label '" << label << "'.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, false);
+    uint64_t labelIndex = nameToLabelingIndexMap.at(label);
+    this->labelings[labelIndex].set(item, false);
+    if (this->uncompressedLabelings[labelIndex]) {
+        this->uncompressedLabelings[labelIndex]->set(item, false);
+    }
 }
 
 bool ItemLabeling::getItemHasLabel(std::string const& label, uint64_t item) const {
@@ -183,6 +233,17 @@ std::size_t ItemLabeling::getNumberOfItems() const {
 }
 
 storm::storage::BitVector const& ItemLabeling::getItems(std::string const& label) const {
+    STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
+                    "The label " << label << " is invalid for the labeling of the model.");
+    uint64_t labelIndex = nameToLabelingIndexMap.at(label);
+    std::lock_guard<std::mutex> lock(uncompressedLabelingsMutex);
+    if (!this->uncompressedLabelings[labelIndex]) {
+        this->uncompressedLabelings[labelIndex] = std::make_unique<storm::storage::BitVector>(this->labelings[labelIndex].toBitVector());
+    }
+    return *this->uncompressedLabelings[labelIndex];
+}
+
+storm::storage::CompressedBitVector const& ItemLabeling::getCompressedItems(std::string const& label) const {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     return this->labelings[nameToLabelingIndexMap.at(label)];
@@ -192,14 +253,22 @@ void ItemLabeling::setItems(std::string const& label, storage::BitVector const&
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    uint64_t labelIndex = nameToLabelingIndexMap.at(label);
+    this->labelings[labelIndex] = storm::storage::CompressedBitVector(labeling);
+    if (this->uncompressedLabelings[labelIndex]) {
+        *this->uncompressedLabelings[labelIndex] = labeling;
+    }
 }
 
 void ItemLabeling::setItems(std::string const& label, storage::BitVector&& labeling) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    uint64_t labelIndex = nameToLabelingIndexMap.at(label);
+    this->labelings[labelIndex] = storm::storage::CompressedBitVector(labeling);
+    if (this->uncompressedLabelings[labelIndex]) {
+        *this->uncompressedLabelings[labelIndex] = std::move(labeling);
+    }
 }
 
 void ItemLabeling::printLabelingInformationToStream(std::ostream& out) const {
@@ -224,11 +293,38 @@ std::size_t ItemLabeling::hash() const {
     return 0;
 }
 
+std::size_t ItemLabeling::getSizeInBytes() const {
+    std::size_t result = sizeof(*this);
+    for (auto const& labeling : labelings) {
+        result += labeling.getSizeInBytes();
+    }
+    for (auto const& uncompressedLabeling : uncompressedLabelings) {
+        if (uncompressedLabeling) {
+            result += uncompressedLabeling->getSizeInBytes();
+        }
+    }
+    for (auto const& nameIndexPair : nameToLabelingIndexMap) {
+        result += sizeof(nameIndexPair) + nameIndexPair.first.capacity();
+    }
+    return result;
+}
+
 std::ostream& operator<<(std::ostream& out, ItemLabeling const& labeling) {
     labeling.printLabelingInformationToStream(out);
     return out;
 }
 
+bool ItemLabeling::keepUncompressed(std::string const& label) const {
+    // The initial states are queried frequently and small labelings do not benefit much from compression.
+    return label == "init" || itemCount <= maximalItemCountOfUncompressedLabelings;
+}
+
+void ItemLabeling::updateUncompressedLabeling(uint64_t labelIndex) {
+    if (uncompressedLabelings[labelIndex]) {
+        *uncompressedLabelings[labelIndex] = labelings[labelIndex].toBitVector();
+    }
+}
+
 std::string ItemLabeling::generateUniqueLabel(const std::string& prefix) const {
     if (!containsLabel(prefix)) {
         return prefix;
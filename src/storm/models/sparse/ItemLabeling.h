@@ -1,11 +1,14 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/CompressedBitVector.h"
 #include "storm/utility/OsDetection.h"
 
 namespace storm {
@@ -27,8 +30,8 @@ class ItemLabeling {
      */
     explicit ItemLabeling(uint64_t itemCount = 0);
 
-    ItemLabeling(ItemLabeling const& other) = default;
-    ItemLabeling& operator=(ItemLabeling const& other) = default;
+    ItemLabeling(ItemLabeling const& other);
+    ItemLabeling& operator=(ItemLabeling const& other);
 
     virtual ~ItemLabeling() = default;
 
@@ -141,6 +144,11 @@ class ItemLabeling {
 
     virtual std::size_t hash() const;
 
+    /*!
+     * Returns (an approximation of) the size of the labeling measured in bytes.
+     */
+    std::size_t getSizeInBytes() const;
+
     /*!
      * Prints information about the labeling to the specified stream.
      *
@@ -183,13 +191,24 @@ class ItemLabeling {
     virtual bool getItemHasLabel(std::string const& label, uint64_t item) const;
 
     /*!
-     * Returns the labeling of items associated with the given label.
+     * Returns the labeling of items associated with the given label. Labelings are stored compressed, but the labeling of
+     * the "init" label and of small item sets are also kept uncompressed. For all other labels, the uncompressed bit vector
+     * is created upon the first request and kept up to date afterwards.
      *
      * @param label The name of the label.
      * @return A bit vector that represents the labeling of the items with the given label.
      */
     virtual storm::storage::BitVector const& getItems(std::string const& label) const;
 
+    /*!
+     * Returns the compressed labeling of items associated with the given label. In contrast to getItems, this never creates
+     * an uncompressed copy of the labeling.
+     *
+     * @param label The name of the label.
+     * @return A compressed bit vector that represents the labeling of the items with the given label.
+     */
+    storm::storage::CompressedBitVector const& getCompressedItems(std::string const& label) const;
+
     /*!
      * Sets the labeling of items associated with the given label.
      *
@@ -228,8 +247,25 @@ class ItemLabeling {
     // A mapping from labels to the index of the corresponding bit vector in the vector.
     std::unordered_map<std::string, uint64_t> nameToLabelingIndexMap;
 
-    // A vector that holds the labeling for all known labels.
-    std::vector<storm::storage::BitVector> labelings;
+    // A vector that holds the labeling for all known labels. As most labels only hold few items (or few intervals of
+    // items), they are stored compressed.
+    std::vector<storm::storage::CompressedBitVector> labelings;
+
+    // For each label, the uncompressed labeling if it is kept (see getItems).
+    mutable std::vector<std::unique_ptr<storm::storage::BitVector>> uncompressedLabelings;
+
+    // Guards the creation of uncompressed labelings in getItems.
+    mutable std::mutex uncompressedLabelingsMutex;
+
+    /*!
+     * Retrieves whether the labeling of the given label is kept uncompressed right away.
+     */
+    bool keepUncompressed(std::string const& label) const;
+
+    /*!
+     * Updates the uncompressed labeling (if any) with the given index after the compressed one was changed.
+     */
+    void updateUncompressedLabeling(uint64_t labelIndex);
 
     /*!
      * Generate a unique, previously unused label from the given prefix string.
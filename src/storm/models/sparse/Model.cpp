@@ -150,9 +150,81 @@ void Model<ValueType, RewardModelType>::assertValidityOfComponents(
 
 template<typename ValueType, typename RewardModelType>
 storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBackwardTransitions() const {
+    {
+        std::lock_guard<std::mutex> lock(backwardTransitionsCache.mutex);
+        if (backwardTransitionsCache.transitions) {
+            return *backwardTransitionsCache.transitions;
+        }
+    }
     return this->getTransitionMatrix().transpose(true);
 }
 
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> Model<ValueType, RewardModelType>::getSharedBackwardTransitions() const {
+    std::lock_guard<std::mutex> lock(backwardTransitionsCache.mutex);
+    if (backwardTransitionsCache.transitions) {
+        return backwardTransitionsCache.transitions;
+    }
+    auto result = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(this->getTransitionMatrix().transpose(true));
+    if (backwardTransitionsCache.enabled) {
+        // The backward transitions subsume their structure, so we do not keep both.
+        backwardTransitionsCache.transitions = result;
+        backwardTransitionsCache.structure.reset();
+    }
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType>
+void Model<ValueType, RewardModelType>::setBackwardTransitionsCaching(bool value) {
+    std::lock_guard<std::mutex> lock(backwardTransitionsCache.mutex);
+    backwardTransitionsCache.enabled = value;
+    if (!value) {
+        backwardTransitionsCache.clear();
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::storage::SparseAdjacency const> Model<ValueType, RewardModelType>::getBackwardTransitionStructure() const {
+    std::lock_guard<std::mutex> lock(backwardTransitionsCache.mutex);
+    if (backwardTransitionsCache.structure) {
+        return backwardTransitionsCache.structure;
+    }
+    auto result =
+        std::make_shared<storm::storage::SparseAdjacency const>(storm::storage::SparseAdjacency::createBackwardAdjacency(this->getTransitionMatrix()));
+    if (backwardTransitionsCache.enabled && !backwardTransitionsCache.transitions) {
+        backwardTransitionsCache.structure = result;
+    }
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType>
+bool Model<ValueType, RewardModelType>::useBackwardTransitionStructure() const {
+    std::lock_guard<std::mutex> lock(backwardTransitionsCache.mutex);
+    return !backwardTransitionsCache.transitions && storm::storage::SparseAdjacency::canRepresent(this->getNumberOfStates());
+}
+
+template<typename ValueType, typename RewardModelType>
+Model<ValueType, RewardModelType>::BackwardTransitionsCache::BackwardTransitionsCache(BackwardTransitionsCache const& other) : enabled(other.enabled) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename RewardModelType>
+typename Model<ValueType, RewardModelType>::BackwardTransitionsCache& Model<ValueType, RewardModelType>::BackwardTransitionsCache::operator=(
+    BackwardTransitionsCache const& other) {
+    if (this != &other) {
+        std::lock_guard<std::mutex> lock(mutex);
+        enabled = other.enabled;
+        clear();
+    }
+    return *this;
+}
+
+template<typename ValueType, typename RewardModelType>
+void Model<ValueType, RewardModelType>::BackwardTransitionsCache::clear() {
+    transitions.reset();
+    structure.reset();
+}
+
 template<typename ValueType, typename RewardModelType>
 typename storm::storage::SparseMatrix<ValueType>::const_rows Model<ValueType, RewardModelType>::getRows(storm::storage::sparse::state_type state) const {
     return this->getTransitionMatrix().getRowGroup(state);
@@ -200,6 +272,9 @@ storm::storage::SparseMatrix<ValueType> const& Model<ValueType, RewardModelType>
 
 template<typename ValueType, typename RewardModelType>
 storm::storage::SparseMatrix<ValueType>& Model<ValueType, RewardModelType>::getTransitionMatrix() {
+    // The caller may modify the matrix, so the cached backward transitions can no longer be trusted.
+    std::lock_guard<std::mutex> lock(backwardTransitionsCache.mutex);
+    backwardTransitionsCache.clear();
     return transitionMatrix;
 }
 
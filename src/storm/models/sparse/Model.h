@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -8,6 +9,7 @@
 #include "storm/models/ModelRepresentation.h"
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/SparseAdjacency.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/ChoiceOrigins.h"
 #include "storm/storage/sparse/ModelComponents.h"
@@ -58,6 +60,50 @@ class Model : public storm::models::Model<CValueType> {
      */
     storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
 
+    /*!
+     * Retrieves the backward transitions of the model without copying them. If the backward transitions are cached (see
+     * setBackwardTransitionsCaching), the transposition of the transition matrix is only performed once and all calls share the same matrix.
+     * Otherwise, every call transposes the transition matrix.
+     *
+     * @return The (possibly cached) backward transitions of this model.
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getSharedBackwardTransitions() const;
+
+    /*!
+     * Sets whether the backward transitions or their structure are cached, which is useful when checking many properties on the same model.
+     * Once the backward transitions with values are cached, they replace a cached structure. The cache is cleared whenever the transition matrix
+     * is retrieved for modification. Disabling the caching releases the cached objects.
+     *
+     * @param value The new value.
+     */
+    void setBackwardTransitionsCaching(bool value);
+
+    /*!
+     * Retrieves the structure of the backward transitions of the model, i.e. for each state the states that have a transition to it, without any values.
+     * This suffices for graph analyses and requires considerably less memory than getBackwardTransitions. If the backward transitions are cached (see
+     * setBackwardTransitionsCaching) and the backward transitions with values are not cached already, the structure is only computed once. The number
+     * of states must be representable by the structure (see storm::storage::SparseAdjacency::canRepresent).
+     *
+     * @return The structure of the backward transitions of this model.
+     */
+    std::shared_ptr<storm::storage::SparseAdjacency const> getBackwardTransitionStructure() const;
+
+    /*!
+     * Invokes the given function on the backward transitions of the model. Only their structure (see getBackwardTransitionStructure) is passed,
+     * unless the backward transitions with values are cached already or the structure cannot represent the model. Graph analyses should use this
+     * method so that the values are only transposed where they are actually needed.
+     *
+     * @param function The function to invoke. It has to accept the structure as well as the backward transitions with values.
+     * @return The result of the function.
+     */
+    template<typename Function>
+    auto applyToBackwardTransitions(Function const& function) const {
+        if (useBackwardTransitionStructure()) {
+            return function(*getBackwardTransitionStructure());
+        }
+        return function(*getSharedBackwardTransitions());
+    }
+
     /*!
      * Returns an object representing the matrix rows associated with the given state.
      *
@@ -468,6 +514,30 @@ class Model : public storm::models::Model<CValueType> {
 
     // if set, gives information about where each choice originates w.r.t. the input model description
     std::optional<std::shared_ptr<storm::storage::sparse::ChoiceOrigins>> choiceOrigins;
+
+    /*!
+     * Retrieves whether applyToBackwardTransitions passes the structure of the backward transitions.
+     */
+    bool useBackwardTransitionStructure() const;
+
+    /*!
+     * The cached backward transitions or their structure. At most one of both objects is held at a time. The objects are filled lazily by the const
+     * getters, which may be called concurrently, so all accesses are guarded by the mutex. Copies of a model only inherit whether caching is enabled,
+     * but not the cached objects.
+     */
+    struct BackwardTransitionsCache {
+        BackwardTransitionsCache() = default;
+        BackwardTransitionsCache(BackwardTransitionsCache const& other);
+        BackwardTransitionsCache& operator=(BackwardTransitionsCache const& other);
+
+        void clear();
+
+        bool enabled = false;
+        std::mutex mutex;
+        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> transitions;
+        std::shared_ptr<storm::storage::SparseAdjacency const> structure;
+    };
+    mutable BackwardTransitionsCache backwardTransitionsCache;
 };
 
 /*!
@@ -33,7 +33,7 @@ bool StateLabeling::operator==(StateLabeling const& other) const {
         if (!other.containsLabel(labelIndexPair.first)) {
             return false;
         }
-        if (labelings[labelIndexPair.second] != other.getStates(labelIndexPair.first)) {
+        if (labelings[labelIndexPair.second] != other.labelings[other.nameToLabelingIndexMap.at(labelIndexPair.first)]) {
             return false;
         }
     }
@@ -64,6 +64,10 @@ storm::storage::BitVector const& StateLabeling::getStates(std::string const& lab
     return ItemLabeling::getItems(label);
 }
 
+storm::storage::CompressedBitVector const& StateLabeling::getCompressedStates(std::string const& label) const {
+    return ItemLabeling::getCompressedItems(label);
+}
+
 void StateLabeling::setStates(std::string const& label, storage::BitVector const& labeling) {
     ItemLabeling::setItems(label, labeling);
 }
@@ -88,6 +88,14 @@ class StateLabeling : public ItemLabeling {
      */
     storm::storage::BitVector const& getStates(std::string const& label) const;
 
+    /*!
+     * Returns the compressed labeling of states associated with the given label without creating an uncompressed copy.
+     *
+     * @param label The name of the label.
+     * @return A compressed bit vector that represents the labeling of the states with the given label.
+     */
+    storm::storage::CompressedBitVector const& getCompressedStates(std::string const& label) const;
+
     /*!
      * Sets the labeling of states associated with the given label.
      *
@@ -0,0 +1,148 @@
+#include "storm/models/symbolic/ExplicitSubmatrixCache.h"
+
+#include <functional>
+#include <iterator>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace models {
+namespace symbolic {
+
+template<storm::dd::DdType Type, typename ValueType>
+ExplicitSubmatrixCache<Type, ValueType>::ExplicitSubmatrixCache(storm::dd::Bdd<Type> const& reachableStates, uint64_t maximalSizeInBytes)
+    : reachableStates(reachableStates), maximalSizeInBytes(maximalSizeInBytes), sizeInBytes(0), numberOfUses(0) {
+    // Intentionally left empty.
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Odd const& ExplicitSubmatrixCache<Type, ValueType>::getOdd(storm::dd::Bdd<Type> const& states) {
+    for (auto& cachedOdd : odds) {
+        if (cachedOdd.states == states) {
+            cachedOdd.lastUse = ++numberOfUses;
+            return cachedOdd.odd;
+        }
+    }
+    storm::dd::Odd odd = states.createOdd();
+    uint64_t oddSize = odd.getNodeCount() * sizeof(storm::dd::Odd);
+    odds.push_back({states, std::move(odd), oddSize, ++numberOfUses});
+    sizeInBytes += oddSize;
+    evict();
+    return odds.back().odd;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+storm::storage::SparseMatrix<ValueType> ExplicitSubmatrixCache<Type, ValueType>::getSubmatrix(storm::dd::Add<Type, ValueType> const& matrix,
+                                                                                              storm::dd::Bdd<Type> const& states, bool insertDiagonalEntries) {
+    STORM_LOG_ASSERT((states && !reachableStates).isZero(), "Expected the states to be a subset of the reachable states.");
+    if (!reachableStatesOdd) {
+        reachableStatesOdd = reachableStates.createOdd();
+    }
+    storm::dd::Odd const& odd = reachableStatesOdd.get();
+
+    auto entryIt = extractedRows.begin();
+    while (entryIt != extractedRows.end() && entryIt->matrix != matrix) {
+        ++entryIt;
+    }
+    if (entryIt == extractedRows.end()) {
+        extractedRows.push_back({matrix, reachableStates.getDdManager().getBddZero(), storm::storage::SparseMatrix<ValueType>(), 0, 0});
+        entryIt = std::prev(extractedRows.end());
+    }
+    entryIt->lastUse = ++numberOfUses;
+
+    // Only translate the rows of states that were not extracted before and merge them into the explicit matrix.
+    storm::dd::Bdd<Type> newStates = states && !entryIt->states;
+    if (!newStates.isZero()) {
+        storm::storage::SparseMatrix<ValueType> newRows = (matrix * newStates.template toAdd<ValueType>()).toMatrix(odd, odd);
+        if (entryIt->states.isZero()) {
+            entryIt->explicitMatrix = std::move(newRows);
+        } else {
+            STORM_LOG_TRACE("Extracting " << newStates.getNonZeroCount() << " additional rows of cached matrix.");
+            storm::storage::SparseMatrix<ValueType> const& oldRows = entryIt->explicitMatrix;
+            storm::storage::SparseMatrixBuilder<ValueType> builder(oldRows.getRowCount(), oldRows.getColumnCount(),
+                                                                   oldRows.getEntryCount() + newRows.getEntryCount());
+            // Since the extracted states are disjoint, each row is non-empty in at most one of the matrices.
+            for (uint64_t row = 0; row < oldRows.getRowCount(); ++row) {
+                for (auto const& entry : oldRows.getRow(row)) {
+                    builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                }
+                for (auto const& entry : newRows.getRow(row)) {
+                    builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                }
+            }
+            entryIt->explicitMatrix = builder.build();
+        }
+        entryIt->states |= newStates;
+        sizeInBytes -= entryIt->sizeInBytes;
+        entryIt->sizeInBytes = entryIt->explicitMatrix.getSizeInBytes();
+        sizeInBytes += entryIt->sizeInBytes;
+    }
+
+    storm::storage::BitVector explicitStates = states.toVector(odd);
+    storm::storage::SparseMatrix<ValueType> result = entryIt->explicitMatrix.getSubmatrix(false, explicitStates, explicitStates, insertDiagonalEntries);
+    evict();
+    return result;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& ExplicitSubmatrixCache<Type, ValueType>::getMatrix(storm::dd::Add<Type, ValueType> const& matrix,
+                                                                                                  std::set<storm::expressions::Variable> const& groupVariables,
+                                                                                                  storm::dd::Bdd<Type> const& states) {
+    for (auto& translatedMatrix : translatedMatrices) {
+        if (translatedMatrix.matrix == matrix && translatedMatrix.states == states) {
+            translatedMatrix.lastUse = ++numberOfUses;
+            return translatedMatrix.explicitMatrix;
+        }
+    }
+    storm::dd::Odd const& odd = getOdd(states);
+    storm::storage::SparseMatrix<ValueType> explicitMatrix = matrix.toMatrix(groupVariables, odd, odd);
+    uint64_t matrixSize = explicitMatrix.getSizeInBytes();
+    translatedMatrices.push_back({matrix, states, std::move(explicitMatrix), matrixSize, ++numberOfUses});
+    sizeInBytes += matrixSize;
+    evict();
+    return translatedMatrices.back().explicitMatrix;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+uint64_t ExplicitSubmatrixCache<Type, ValueType>::getSizeInBytes() const {
+    return sizeInBytes;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+void ExplicitSubmatrixCache<Type, ValueType>::evict() {
+    while (sizeInBytes > maximalSizeInBytes) {
+        // Find the least recently used entry among all kinds of entries.
+        uint64_t oldestUse = numberOfUses;
+        std::function<void()> eraseOldest;
+        auto findOldest = [&](auto& entries) {
+            for (auto entryIt = entries.begin(); entryIt != entries.end(); ++entryIt) {
+                if (entryIt->lastUse < oldestUse) {
+                    oldestUse = entryIt->lastUse;
+                    eraseOldest = [this, &entries, entryIt]() {
+                        sizeInBytes -= entryIt->sizeInBytes;
+                        entries.erase(entryIt);
+                    };
+                }
+            }
+        };
+        findOldest(odds);
+        findOldest(extractedRows);
+        findOldest(translatedMatrices);
+        if (!eraseOldest) {
+            break;
+        }
+        eraseOldest();
+    }
+}
+
+template class ExplicitSubmatrixCache<storm::dd::DdType::CUDD, double>;
+template class ExplicitSubmatrixCache<storm::dd::DdType::Sylvan, double>;
+
+template class ExplicitSubmatrixCache<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+template class ExplicitSubmatrixCache<storm::dd::DdType::Sylvan, storm::RationalFunction>;
+
+}  // namespace symbolic
+}  // namespace models
+}  // namespace storm
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <list>
+#include <set>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Odd.h"
+
+namespace storm {
+namespace models {
+namespace symbolic {
+
+/*!
+ * Caches explicit representations of (sub)matrices of a symbolic model, so that engines that repeatedly translate
+ * parts of the model to explicit matrices (e.g. the hybrid engine when checking several properties) can reuse them.
+ *
+ * ODDs are cached per set of states. For deterministic models, the rows of a symbolic matrix are translated
+ * incrementally: each row is only extracted from the DD once and submatrices are then obtained explicitly. For
+ * nondeterministic models, explicit matrices are only reused if exactly the same symbolic matrix is translated again.
+ * All sets of states must be subsets of the reachable states of the model. Once the (approximate) size of the cached
+ * ODDs and matrices exceeds a given bound, the least recently used ones are evicted.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+class ExplicitSubmatrixCache {
+   public:
+    /*!
+     * Creates an empty cache.
+     *
+     * @param reachableStates The reachable states of the model.
+     * @param maximalSizeInBytes The size up to which ODDs and matrices are cached. The most recently used entry is kept
+     * even if it exceeds this size on its own.
+     */
+    ExplicitSubmatrixCache(storm::dd::Bdd<Type> const& reachableStates, uint64_t maximalSizeInBytes = 1ull << 30);
+
+    /*!
+     * Retrieves the ODD of the given states. The returned reference remains valid until the ODD is evicted, which can
+     * only happen in subsequent calls.
+     */
+    storm::dd::Odd const& getOdd(storm::dd::Bdd<Type> const& states);
+
+    /*!
+     * Retrieves the explicit representation of the given (deterministic) matrix restricted to the rows and columns of
+     * the given states, i.e. the result is equal to (matrix * states * states').toMatrix(odd, odd) where odd is the ODD
+     * of the given states. Only rows that were not extracted for previous calls with the same matrix are translated.
+     *
+     * @param matrix The symbolic matrix over the row and column variables of the model.
+     * @param states The states whose rows and columns to keep.
+     * @param insertDiagonalEntries If set, the result has an entry on each diagonal position (which is zero if there was
+     * no transition), such that it can be converted to an equation system.
+     */
+    storm::storage::SparseMatrix<ValueType> getSubmatrix(storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Bdd<Type> const& states,
+                                                         bool insertDiagonalEntries = false);
+
+    /*!
+     * Retrieves the explicit representation of the given nondeterministic matrix using the ODD of the given states for
+     * both rows and columns, i.e. the result is equal to matrix.toMatrix(groupVariables, odd, odd). The returned
+     * reference remains valid until the matrix is evicted, which can only happen in subsequent calls.
+     *
+     * @param matrix The symbolic matrix whose rows and columns need to be within the given states.
+     * @param groupVariables The variables that encode the choices of the states.
+     * @param states The states that determine the ODD.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getMatrix(storm::dd::Add<Type, ValueType> const& matrix,
+                                                             std::set<storm::expressions::Variable> const& groupVariables, storm::dd::Bdd<Type> const& states);
+
+    /*!
+     * Retrieves the (approximate) size of the cached ODDs and matrices in bytes.
+     */
+    uint64_t getSizeInBytes() const;
+
+   private:
+    struct CachedOdd {
+        storm::dd::Bdd<Type> states;
+        storm::dd::Odd odd;
+        uint64_t sizeInBytes;
+        uint64_t lastUse;
+    };
+
+    struct ExtractedRows {
+        // The symbolic matrix whose rows were extracted.
+        storm::dd::Add<Type, ValueType> matrix;
+
+        // The states whose rows were already extracted.
+        storm::dd::Bdd<Type> states;
+
+        // The explicit matrix over all reachable states in which only the extracted rows are non-empty.
+        storm::storage::SparseMatrix<ValueType> explicitMatrix;
+
+        uint64_t sizeInBytes;
+        uint64_t lastUse;
+    };
+
+    struct TranslatedMatrix {
+        storm::dd::Add<Type, ValueType> matrix;
+        storm::dd::Bdd<Type> states;
+        storm::storage::SparseMatrix<ValueType> explicitMatrix;
+        uint64_t sizeInBytes;
+        uint64_t lastUse;
+    };
+
+    /*!
+     * Evicts the least recently used entries until the cache is within its maximal size. The entry that was used last
+     * is never evicted.
+     */
+    void evict();
+
+    // The reachable states of the model and (once it is needed) their ODD.
+    storm::dd::Bdd<Type> reachableStates;
+    boost::optional<storm::dd::Odd> reachableStatesOdd;
+
+    // The size up to which entries are cached, the current size of all entries and the number of uses so far.
+    uint64_t maximalSizeInBytes;
+    uint64_t sizeInBytes;
+    uint64_t numberOfUses;
+
+    // The cached ODDs together with the states they represent. Lists keep returned references valid when other entries are evicted.
+    std::list<CachedOdd> odds;
+
+    // The rows extracted from the deterministic matrices so far.
+    std::list<ExtractedRows> extractedRows;
+
+    // The translated nondeterministic matrices.
+    std::list<TranslatedMatrix> translatedMatrices;
+};
+
+}  // namespace symbolic
+}  // namespace models
+}  // namespace storm
@@ -4,6 +4,7 @@
 
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/ExplicitSubmatrixCache.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StochasticTwoPlayerGame.h"
@@ -103,6 +104,20 @@ storm::dd::Bdd<Type> const& Model<Type, ValueType>::getReachableStates() const {
     return reachableStates;
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+void Model<Type, ValueType>::setExplicitSubmatrixCaching(bool value) {
+    if (!value) {
+        explicitSubmatrixCache.reset();
+    } else if (!explicitSubmatrixCache) {
+        explicitSubmatrixCache = std::make_shared<ExplicitSubmatrixCache<Type, ValueType>>(reachableStates);
+    }
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+ExplicitSubmatrixCache<Type, ValueType>* Model<Type, ValueType>::getExplicitSubmatrixCache() const {
+    return explicitSubmatrixCache.get();
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> const& Model<Type, ValueType>::getInitialStates() const {
     return labelToBddMap.at("init");
@@ -39,6 +39,9 @@ namespace symbolic {
 template<storm::dd::DdType Type, typename ValueType>
 class StandardRewardModel;
 
+template<storm::dd::DdType Type, typename ValueType>
+class ExplicitSubmatrixCache;
+
 /*!
  * Base class for all symbolic models.
  */
@@ -135,6 +138,23 @@ class Model : public storm::models::Model<CValueType> {
      */
     storm::dd::Bdd<Type> const& getReachableStates() const;
 
+    /*!
+     * Sets whether explicit representations of (parts of) the transition matrix are cached. If enabled, engines that
+     * translate the model to explicit matrices (like the hybrid engine) share ODDs and extracted rows via the cache
+     * returned by getExplicitSubmatrixCache, which is useful when checking many properties on the same model.
+     * Disabling the caching releases the cache.
+     *
+     * @param value The new value.
+     */
+    void setExplicitSubmatrixCaching(bool value);
+
+    /*!
+     * Retrieves the cache for explicit representations of (parts of) the transition matrix.
+     *
+     * @return The cache or nullptr if caching is disabled.
+     */
+    ExplicitSubmatrixCache<Type, ValueType>* getExplicitSubmatrixCache() const;
+
     /*!
      * Retrieves the initial states of the model.
      *
@@ -436,6 +456,9 @@ class Model : public storm::models::Model<CValueType> {
 
     // An empty variable set that can be used when references to non-existing sets need to be returned.
     std::set<storm::expressions::Variable> emptyVariableSet;
+
+    // If set, caches explicit representations of (parts of) the transition matrix.
+    std::shared_ptr<ExplicitSubmatrixCache<Type, ValueType>> explicitSubmatrixCache;
 };
 
 }  // namespace symbolic
@@ -671,6 +671,10 @@ storm::settings::modules::BuildSettings& mutableBuildSettings() {
     return dynamic_cast<storm::settings::modules::BuildSettings&>(mutableManager().getModule(storm::settings::modules::BuildSettings::moduleName));
 }
 
+storm::settings::modules::CoreSettings& mutableCoreSettings() {
+    return dynamic_cast<storm::settings::modules::CoreSettings&>(mutableManager().getModule(storm::settings::modules::CoreSettings::moduleName));
+}
+
 storm::settings::modules::AbstractionSettings& mutableAbstractionSettings() {
     return dynamic_cast<storm::settings::modules::AbstractionSettings&>(mutableManager().getModule(storm::settings::modules::AbstractionSettings::moduleName));
 }
@@ -13,6 +13,7 @@ namespace storm {
 namespace settings {
 namespace modules {
 class BuildSettings;
+class CoreSettings;
 class ModuleSettings;
 class AbstractionSettings;
 }  // namespace modules
@@ -313,6 +314,14 @@ bool hasModule() {
  */
 storm::settings::modules::BuildSettings& mutableBuildSettings();
 
+/*!
+ * Retrieves the core settings in a mutable form. This is only meant to be used for debug purposes or very
+ * rare cases where it is necessary.
+ *
+ * @return An object that allows accessing and modifying the core settings.
+ */
+storm::settings::modules::CoreSettings& mutableCoreSettings();
+
 /*!
  * Retrieves the abstraction settings in a mutable form. This is only meant to be used for debug purposes or very
  * rare cases where it is necessary.
@@ -21,6 +21,7 @@ const std::string BisimulationSettings::signatureModeOptionName = "sigmode";
 const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
+const std::string BisimulationSettings::sparseRefinementMethodOptionName = "sparserefine";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
@@ -91,6 +92,17 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    std::vector<std::string> sparseRefinementMethods = {"splitter", "signature"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementMethodOptionName, true,
+                                                   "Sets how the partition is refined in sparse bisimulation. 'signature' splits all blocks in each round "
+                                                   "and may use multiple threads (with --enable-tbb).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("method", "The method to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementMethods))
+                                         .setDefaultValueString("splitter")
+                                         .build())
+                        .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -173,6 +185,15 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
     return RefinementMode::Full;
 }
 
+storm::storage::BisimulationRefinementMethod BisimulationSettings::getSparseRefinementMethod() const {
+    std::string methodAsString = this->getOption(sparseRefinementMethodOptionName).getArgumentByName("method").getValueAsString();
+    if (methodAsString == "signature") {
+        return storm::storage::BisimulationRefinementMethod::Signature;
+    }
+    STORM_LOG_ASSERT(methodAsString == "splitter", "Invalid sparse bisimulation refinement method: " << methodAsString << ".");
+    return storm::storage::BisimulationRefinementMethod::Splitter;
+}
+
 bool BisimulationSettings::check() const {
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
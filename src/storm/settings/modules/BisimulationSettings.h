@@ -3,6 +3,7 @@
 
 #include "storm/settings/modules/ModuleSettings.h"
 
+#include "storm/storage/bisimulation/BisimulationType.h"
 #include "storm/storage/dd/bisimulation/QuotientFormat.h"
 #include "storm/storage/dd/bisimulation/SignatureMode.h"
 
@@ -96,6 +97,12 @@ class BisimulationSettings : public ModuleSettings {
      */
     RefinementMode getRefinementMode() const;
 
+    /*!
+     * Retrieves the method to refine the partition in sparse bisimulation.
+     * NOTE: only applies to sparse bisimulation.
+     */
+    storm::storage::BisimulationRefinementMethod getSparseRefinementMethod() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -111,6 +118,7 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string reuseOptionName;
     static const std::string initialPartitionOptionName;
     static const std::string refinementModeOptionName;
+    static const std::string sparseRefinementMethodOptionName;
     static const std::string parallelismModeOptionName;
     static const std::string exactArithmeticDdOptionName;
 };
@@ -40,6 +40,10 @@ const std::string noSimplifyOptionName = "no-simplify";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
 const std::string explorationStateLimitOptionName = "state-limit";
+const std::string modelCacheOptionName = "modelcache";
+const std::string symmetryReductionOptionName = "symmetry";
+const std::string partialOrderReductionOptionName = "por";
+const std::string staticDdVariableOrderOptionName = "dd-static-order";
 
 BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, prismCompatibilityOptionName, false,
@@ -122,6 +126,28 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "states to explore before stopping.").build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, modelCacheOptionName, false,
+                                                   "If set, sparse models built from symbolic input are stored in and reused from the given directory.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory holding the cached models.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false,
+                                                   "If set, the sparse model of a PRISM program is only built up to permutations of symmetric modules (e.g. "
+                                                   "modules created by renaming). Only properties that are symmetric in these modules are preserved.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false,
+                                                   "If set, the sparse MDP of a PRISM program is built with a partial-order reduction that only expands a "
+                                                   "single independent and invisible command where possible. Only (unbounded) properties without next "
+                                                   "operator over the built labels are preserved and reward models are not supported.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, staticDdVariableOrderOptionName, false,
+                                                   "If set, the symbolic engines order the DD variables of the model variables with the FORCE heuristic such "
+                                                   "that variables accessed by the same commands/edges are close to each other (instead of using the "
+                                                   "declaration order).")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool BuildSettings::isExplorationOrderSet() const {
@@ -222,6 +248,26 @@ uint64_t BuildSettings::getExplorationStateLimit() const {
     return this->getOption(explorationStateLimitOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
 }
 
+bool BuildSettings::isSymmetryReductionSet() const {
+    return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isPartialOrderReductionSet() const {
+    return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isStaticDdVariableOrderSet() const {
+    return this->getOption(staticDdVariableOrderOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isModelCacheSet() const {
+    return this->getOption(modelCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getModelCacheDirectory() const {
+    return this->getOption(modelCacheOptionName).getArgumentByName("dir").getValueAsString();
+}
+
 }  // namespace modules
 
 }  // namespace settings
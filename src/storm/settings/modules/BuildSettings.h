@@ -149,6 +149,31 @@ class BuildSettings : public ModuleSettings {
      */
     uint64_t getExplorationStateLimit() const;
 
+    /*!
+     * Retrieves whether the state space is only explored up to permutations of symmetric modules.
+     */
+    bool isSymmetryReductionSet() const;
+
+    /*!
+     * Retrieves whether the state space is explored with a partial-order reduction.
+     */
+    bool isPartialOrderReductionSet() const;
+
+    /*!
+     * Retrieves whether the DD variables of the symbolic engines are ordered by a static heuristic.
+     */
+    bool isStaticDdVariableOrderSet() const;
+
+    /*!
+     * Retrieves whether a directory for caching built sparse models has been set.
+     */
+    bool isModelCacheSet() const;
+
+    /*!
+     * Retrieves the directory in which built sparse models are cached (if set).
+     */
+    std::string getModelCacheDirectory() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
@@ -46,7 +46,7 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
                                          .build())
                         .build());
 
-    std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination", "topological", "acyclic"};
+    std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination", "topological", "acyclic", "padic"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, eqSolverOptionName, false, "Sets which solver is preferred for solving systems of linear equations.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the solver to prefer.")
@@ -102,6 +102,8 @@ storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
         return storm::solver::EquationSolverType::Topological;
     } else if (equationSolverName == "acyclic") {
         return storm::solver::EquationSolverType::Acyclic;
+    } else if (equationSolverName == "padic") {
+        return storm::solver::EquationSolverType::PAdic;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown equation solver '" << equationSolverName << "'.");
 }
@@ -164,6 +166,10 @@ bool CoreSettings::isUseIntelTbbSet() const {
     return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
 }
 
+std::unique_ptr<storm::settings::SettingMemento> CoreSettings::overrideUseIntelTbbSet(bool stateToSet) {
+    return this->overrideOption(intelTbbOptionName, stateToSet);
+}
+
 storm::utility::Engine CoreSettings::getEngine() const {
     return engine;
 }
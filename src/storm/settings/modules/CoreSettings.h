@@ -102,6 +102,15 @@ class CoreSettings : public ModuleSettings {
      */
     bool isUseIntelTbbSet() const;
 
+    /*!
+     * Overrides the option to use Intel TBB by setting it to the specified value. As soon as the returned memento goes out of scope,
+     * the original value is restored.
+     *
+     * @param stateToSet The value that is to be set for the option to use Intel TBB.
+     * @return The memento that will eventually restore the original value.
+     */
+    std::unique_ptr<storm::settings::SettingMemento> overrideUseIntelTbbSet(bool stateToSet);
+
     /*!
      * Retrieves the selected engine.
      *
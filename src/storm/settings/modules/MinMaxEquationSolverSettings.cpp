@@ -19,12 +19,13 @@ const std::string precisionOptionName = "precision";
 const std::string absoluteOptionName = "absolute";
 const std::string valueIterationMultiplicationStyleOptionName = "vimult";
 const std::string forceUniqueSolutionRequirementOptionName = "force-require-unique";
+const std::string mixedPrecisionOptionName = "mixedprec";
 
 MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> minMaxSolvingTechniques = {
         "vi",     "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",          "ratsearch",
         "ii",     "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi",
-        "acyclic"};
+        "acyclic", "pvi",               "prioritized-value-iteration"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.")
             .setIsAdvanced()
@@ -69,6 +70,12 @@ MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(mo
                                                    "simplify solving but causes some overhead.")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false,
+                                                   "Sets whether value iteration first approximates the solution on a single precision copy of the matrix before "
+                                                   "refining it in double precision.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -93,6 +100,8 @@ storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvi
         return storm::solver::MinMaxMethod::ViToPi;
     } else if (minMaxEquationSolvingTechnique == "acyclic") {
         return storm::solver::MinMaxMethod::Acyclic;
+    } else if (minMaxEquationSolvingTechnique == "prioritized-value-iteration" || minMaxEquationSolvingTechnique == "pvi") {
+        return storm::solver::MinMaxMethod::PrioritizedValueIteration;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
@@ -147,6 +156,10 @@ bool MinMaxEquationSolverSettings::isForceUniqueSolutionRequirementSet() const {
     return this->getOption(forceUniqueSolutionRequirementOptionName).getHasOptionBeenSet();
 }
 
+bool MinMaxEquationSolverSettings::isMixedPrecisionSet() const {
+    return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
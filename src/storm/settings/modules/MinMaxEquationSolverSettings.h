@@ -95,6 +95,11 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
      */
     bool isForceUniqueSolutionRequirementSet() const;
 
+    /*!
+     * @return if value iteration should first approximate the solution in single precision before refining it in double precision.
+     */
+    bool isMixedPrecisionSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
@@ -24,11 +24,14 @@ const std::string NativeEquationSolverSettings::precisionOptionName = "precision
 const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
 const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
 const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+const std::string NativeEquationSolverSettings::preconditionOptionName = "precond";
+const std::string NativeEquationSolverSettings::restartOptionName = "restart";
 
 NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"jacobi", "gaussseidel",           "sor", "walkerchae",
                                         "power",  "sound-value-iteration", "svi", "optimistic-value-iteration",
-                                        "ovi",    "interval-iteration",    "ii",  "ratsearch"};
+                                        "ovi",    "interval-iteration",    "ii",  "ratsearch",
+                                        "gmres",  "bicgstab"};
     this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true,
                                                    "The method to be used for solving linear equation systems with the native engine.")
                         .setIsAdvanced()
@@ -38,6 +41,24 @@ NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(mo
                                          .build())
                         .build());
 
+    std::vector<std::string> preconditioner = {"ilu", "diagonal", "none"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, preconditionOptionName, false,
+                                                   "The preconditioning technique used by the Krylov methods (gmres, bicgstab).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the preconditioning method.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(preconditioner))
+                                         .setDefaultValueString("ilu")
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, restartOptionName, false, "The number of iterations after which GMRES is restarted.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of iterations.")
+                                         .setDefaultValueUnsignedInteger(50)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+
     this->addOption(storm::settings::OptionBuilder(moduleName, maximalIterationsOptionName, false,
                                                    "The maximal number of iterations to perform before iterative solving is aborted.")
                         .setIsAdvanced()
@@ -111,11 +132,32 @@ storm::solver::NativeLinearEquationSolverMethod NativeEquationSolverSettings::ge
         return storm::solver::NativeLinearEquationSolverMethod::IntervalIteration;
     } else if (linearEquationSystemTechniqueAsString == "ratsearch") {
         return storm::solver::NativeLinearEquationSolverMethod::RationalSearch;
+    } else if (linearEquationSystemTechniqueAsString == "gmres") {
+        return storm::solver::NativeLinearEquationSolverMethod::Gmres;
+    } else if (linearEquationSystemTechniqueAsString == "bicgstab") {
+        return storm::solver::NativeLinearEquationSolverMethod::Bicgstab;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
                     "Unknown solution technique '" << linearEquationSystemTechniqueAsString << "' selected.");
 }
 
+storm::solver::NativeLinearEquationSolverPreconditioner NativeEquationSolverSettings::getPreconditioningMethod() const {
+    std::string preconditioningMethodAsString = this->getOption(preconditionOptionName).getArgumentByName("name").getValueAsString();
+    if (preconditioningMethodAsString == "ilu") {
+        return storm::solver::NativeLinearEquationSolverPreconditioner::Ilu;
+    } else if (preconditioningMethodAsString == "diagonal") {
+        return storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal;
+    } else if (preconditioningMethodAsString == "none") {
+        return storm::solver::NativeLinearEquationSolverPreconditioner::None;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
+                    "Unknown preconditioning technique '" << preconditioningMethodAsString << "' selected.");
+}
+
+uint_fast64_t NativeEquationSolverSettings::getRestartIterationCount() const {
+    return this->getOption(restartOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool NativeEquationSolverSettings::isMaximalIterationCountSet() const {
     return this->getOption(maximalIterationsOptionName).getHasOptionBeenSet();
 }
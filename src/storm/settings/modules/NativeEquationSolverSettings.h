@@ -44,6 +44,20 @@ class NativeEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::NativeLinearEquationSolverMethod getLinearEquationSystemMethod() const;
 
+    /*!
+     * Retrieves the method that is to be used for preconditioning the Krylov methods.
+     *
+     * @return The method to use.
+     */
+    storm::solver::NativeLinearEquationSolverPreconditioner getPreconditioningMethod() const;
+
+    /*!
+     * Retrieves the number of iterations after which GMRES is to be restarted.
+     *
+     * @return The number of iterations after which to restart.
+     */
+    uint_fast64_t getRestartIterationCount() const;
+
     /*!
      * Retrieves whether the maximal iteration count has been set.
      *
@@ -126,6 +140,8 @@ class NativeEquationSolverSettings : public ModuleSettings {
     static const std::string intervalIterationSymmetricUpdatesOptionName;
     static const std::string powerMethodMultiplicationStyleOptionName;
     static const std::string forceBoundsOptionName;
+    static const std::string preconditionOptionName;
+    static const std::string restartOptionName;
 };
 
 }  // namespace modules
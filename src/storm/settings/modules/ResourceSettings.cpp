@@ -16,6 +16,9 @@ const std::string ResourceSettings::timeoutOptionShortName = "t";
 const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
 const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
 const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+const std::string ResourceSettings::profileOptionName = "profile";
+const std::string ResourceSettings::printMemoryStatisticsOptionName = "memstats";
+const std::string ResourceSettings::softMemoryLimitOptionName = "soft-memlimit";
 
 ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.")
@@ -35,6 +38,29 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(3)
                                          .build())
                         .build());
+    std::vector<std::string> profileFormats = {"json", "chrome"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, profileOptionName, false,
+                                                   "Collects the time spent in the main stages of the computation (and some counters) and exports it at the end.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The file to which the profiling data is written.").build())
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "format", "The output format: a hierarchical summary (json) or a trace viewable in chrome://tracing (chrome).")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(profileFormats))
+                                         .setDefaultValueString("json")
+                                         .makeOptional()
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, printMemoryStatisticsOptionName, false,
+                                                   "Prints the memory consumption of the individual stages (parsing, building, solving, ...) at the end.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, softMemoryLimitOptionName, false,
+                                                   "If given, the computation is aborted gracefully (with a memory report) once the resident memory exceeds the limit.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("megabytes", "The limit in megabytes.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool ResourceSettings::isTimeoutSet() const {
@@ -53,6 +79,30 @@ uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
     return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isProfileSet() const {
+    return this->getOption(profileOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getProfileFilename() const {
+    return this->getOption(profileOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool ResourceSettings::isProfileChromeTraceSet() const {
+    return this->getOption(profileOptionName).getArgumentByName("format").getValueAsString() == "chrome";
+}
+
+bool ResourceSettings::isPrintMemoryStatisticsSet() const {
+    return this->getOption(printMemoryStatisticsOptionName).getHasOptionBeenSet();
+}
+
+bool ResourceSettings::isSoftMemoryLimitSet() const {
+    return this->getOption(softMemoryLimitOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t ResourceSettings::getSoftMemoryLimitInMegabytes() const {
+    return this->getOption(softMemoryLimitOptionName).getArgumentByName("megabytes").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -47,6 +47,48 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getSignalWaitingTimeInSeconds() const;
 
+    /*!
+     * Retrieves whether profiling data shall be collected and exported at the end of a run.
+     *
+     * @return True iff the option was set.
+     */
+    bool isProfileSet() const;
+
+    /*!
+     * Retrieves the name of the file to which the profiling data is exported.
+     *
+     * @return The name of the file.
+     */
+    std::string getProfileFilename() const;
+
+    /*!
+     * Retrieves whether the profiling data shall be exported in the Chrome trace event format (instead of a hierarchical summary).
+     *
+     * @return True iff the chrome format was selected.
+     */
+    bool isProfileChromeTraceSet() const;
+
+    /*!
+     * Retrieves whether the memory consumption of the individual stages shall be printed at the end of a run.
+     *
+     * @return True iff the option was set.
+     */
+    bool isPrintMemoryStatisticsSet() const;
+
+    /*!
+     * Retrieves whether the soft memory limit option was set.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSoftMemoryLimitSet() const;
+
+    /*!
+     * Retrieves the resident memory after which the computation is aborted gracefully in case the soft memory limit option was set.
+     *
+     * @return The limit in megabytes.
+     */
+    uint_fast64_t getSoftMemoryLimitInMegabytes() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -57,6 +99,9 @@ class ResourceSettings : public ModuleSettings {
     static const std::string printTimeAndMemoryOptionName;
     static const std::string printTimeAndMemoryOptionShortName;
     static const std::string signalWaitingTimeOptionName;
+    static const std::string profileOptionName;
+    static const std::string printMemoryStatisticsOptionName;
+    static const std::string softMemoryLimitOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -25,7 +25,7 @@ const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOpt
 const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
 
 TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
+    std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination", "padic"};
     this->addOption(storm::settings::OptionBuilder(moduleName, underlyingEquationSolverOptionName, true,
                                                    "Sets which solver is considered for solving the underlying equation systems.")
                         .setIsAdvanced()
@@ -35,8 +35,9 @@ TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleS
                                          .build())
                         .build());
     std::vector<std::string> minMaxSolvingTechniques = {
-        "vi", "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",      "ratsearch",
-        "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "vi-to-pi"};
+        "vi", "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",       "ratsearch",
+        "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "vi-to-pi", "pvi",
+        "prioritized-value-iteration"};
     this->addOption(storm::settings::OptionBuilder(moduleName, underlyingMinMaxMethodOptionName, true,
                                                    "Sets which minmax method is considered for solving the underlying minmax equation systems.")
                         .setIsAdvanced()
@@ -66,6 +67,8 @@ storm::solver::EquationSolverType TopologicalEquationSolverSettings::getUnderlyi
         return storm::solver::EquationSolverType::Eigen;
     } else if (equationSolverName == "elimination") {
         return storm::solver::EquationSolverType::Elimination;
+    } else if (equationSolverName == "padic") {
+        return storm::solver::EquationSolverType::PAdic;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << equationSolverName << "'.");
 }
@@ -97,6 +100,8 @@ storm::solver::MinMaxMethod TopologicalEquationSolverSettings::getUnderlyingMinM
         return storm::solver::MinMaxMethod::OptimisticValueIteration;
     } else if (minMaxEquationSolvingTechnique == "vi-to-pi") {
         return storm::solver::MinMaxMethod::ViToPi;
+    } else if (minMaxEquationSolvingTechnique == "prioritized-value-iteration" || minMaxEquationSolvingTechnique == "pvi") {
+        return storm::solver::MinMaxMethod::PrioritizedValueIteration;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << minMaxEquationSolvingTechnique << "'.");
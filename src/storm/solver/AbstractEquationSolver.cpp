@@ -7,6 +7,7 @@
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/utility/MemoryAccounting.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -355,7 +356,7 @@ SolverStatus AbstractEquationSolver<ValueType>::updateStatus(SolverStatus status
             status = SolverStatus::TerminatedEarly;
         } else if (iterations >= maximalNumberOfIterations) {
             status = SolverStatus::MaximalIterationsExceeded;
-        } else if (storm::utility::resources::isTerminate()) {
+        } else if (storm::utility::memory::isSoftLimitExceeded() || storm::utility::resources::isTerminate()) {
             status = SolverStatus::Aborted;
         }
     }
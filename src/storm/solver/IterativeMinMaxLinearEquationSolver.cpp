@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <functional>
 #include <limits>
 
@@ -10,6 +11,7 @@
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/solver/helper/IntervalterationHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/PrioritizedValueIterationHelper.h"
 #include "storm/solver/helper/RationalSearchHelper.h"
 #include "storm/solver/helper/SchedulerTrackingHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
@@ -78,7 +80,8 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::getMe
     }
     STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
                         method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration ||
-                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi,
+                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi ||
+                        method == MinMaxMethod::PrioritizedValueIteration,
                     storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method '" << toString(method) << "'.");
     return method;
 }
@@ -109,6 +112,9 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSolve
         case MinMaxMethod::ViToPi:
             result = solveEquationsViToPi(env, dir, x, b);
             break;
+        case MinMaxMethod::PrioritizedValueIteration:
+            result = solveEquationsPrioritizedValueIteration(env, dir, x, b);
+            break;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
     }
@@ -187,6 +193,90 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveInducedE
     }
 }
 
+/*!
+ * Solves the equation system induced by the given scheduler, assuming that x already solves the system induced by a scheduler that only differs in the
+ * changed states. Only the values of states that can reach a changed state (in the induced system) can change, so we only re-solve for those.
+ * The remaining values are fixed and the current values serve as starting point.
+ */
+template<typename ValueType, typename SolutionType>
+bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveAffectedPartOfInducedEquationSystem(
+    Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver,
+    std::unique_ptr<LinearEquationSolver<ValueType>>& affectedPartSolver, std::vector<uint64_t> const& scheduler,
+    storm::storage::BitVector const& changedStates, std::vector<SolutionType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const {
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We did not implement solving induced equation systems for interval-based models.");
+        return false;
+    } else {
+        // Search backwards from the changed states, only following the choices selected by the scheduler.
+        if (!backwardTransitions) {
+            backwardTransitions = std::make_unique<storm::storage::SparseMatrix<ValueType>>(this->A->transpose(false));
+        }
+        auto const& rowGroupIndices = this->A->getRowGroupIndices();
+        storm::storage::BitVector affectedStates = changedStates;
+        std::vector<uint64_t> stack(changedStates.begin(), changedStates.end());
+        while (!stack.empty()) {
+            uint64_t state = stack.back();
+            stack.pop_back();
+            for (auto const& entry : backwardTransitions->getRow(state)) {
+                uint64_t row = entry.getColumn();
+                uint64_t predecessor = std::upper_bound(rowGroupIndices.begin(), rowGroupIndices.end(), row) - rowGroupIndices.begin() - 1;
+                if (!affectedStates.get(predecessor) && row == rowGroupIndices[predecessor] + scheduler[predecessor]) {
+                    affectedStates.set(predecessor);
+                    stack.push_back(predecessor);
+                }
+            }
+        }
+        uint64_t const numberOfStates = this->A->getRowGroupCount();
+        if (affectedStates.full()) {
+            return solveInducedEquationSystem(env, linearEquationSolver, scheduler, x, subB, originalB);
+        }
+        STORM_LOG_TRACE("Re-evaluating the policy on " << affectedStates.getNumberOfSetBits() << " of " << numberOfStates << " states.");
+
+        // Build the equation system over the affected states. Transitions to unaffected states are moved to the right-hand side.
+        bool convertToEquationSystem = this->linearEquationSolverFactory->getEquationProblemFormat(env) == LinearEquationSolverProblemFormat::EquationSystem;
+        storm::storage::SparseMatrix<ValueType> inducedMatrix = this->A->selectRowsFromRowGroups(scheduler, false);
+        storm::storage::SparseMatrix<ValueType> submatrix = inducedMatrix.getSubmatrix(false, affectedStates, affectedStates, convertToEquationSystem);
+        if (convertToEquationSystem) {
+            submatrix.convertToEquationSystem();
+        }
+        std::vector<ValueType> affectedB;
+        affectedB.reserve(affectedStates.getNumberOfSetBits());
+        for (auto state : affectedStates) {
+            ValueType value = originalB[rowGroupIndices[state] + scheduler[state]];
+            for (auto const& entry : inducedMatrix.getRow(state)) {
+                if (!affectedStates.get(entry.getColumn())) {
+                    value += entry.getValue() * x[entry.getColumn()];
+                }
+            }
+            affectedB.push_back(std::move(value));
+        }
+        std::vector<SolutionType> affectedX = storm::utility::vector::filterVector(x, affectedStates);
+
+        // The solver for the affected part is reused across rounds. Only its matrix and (local) bounds have to be updated.
+        if (!affectedPartSolver) {
+            affectedPartSolver = this->linearEquationSolverFactory->create(env, std::move(submatrix));
+            affectedPartSolver->setCachingEnabled(true);
+            if (this->hasLowerBound(AbstractEquationSolver<SolutionType>::BoundType::Global)) {
+                affectedPartSolver->setLowerBound(this->getLowerBound());
+            }
+            if (this->hasUpperBound(AbstractEquationSolver<SolutionType>::BoundType::Global)) {
+                affectedPartSolver->setUpperBound(this->getUpperBound());
+            }
+        } else {
+            affectedPartSolver->setMatrix(std::move(submatrix));
+        }
+        if (this->hasLowerBound(AbstractEquationSolver<SolutionType>::BoundType::Local)) {
+            affectedPartSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), affectedStates));
+        }
+        if (this->hasUpperBound(AbstractEquationSolver<SolutionType>::BoundType::Local)) {
+            affectedPartSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), affectedStates));
+        }
+        bool result = affectedPartSolver->solveEquations(env, affectedX, affectedB);
+        storm::utility::vector::setVectorValues(x, affectedStates, affectedX);
+        return result;
+    }
+}
+
 template<typename ValueType, typename SolutionType>
 bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir,
                                                                                                  std::vector<SolutionType>& x,
@@ -211,8 +301,9 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::performPolicy
         }
         std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
 
-        // The solver that we will use throughout the procedure.
+        // The solvers that we will use throughout the procedure. The latter one is only used for the states affected by the changes of the scheduler.
         std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver;
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> affectedPartSolver;
         // The linear equation solver should be at least as precise as this solver
         std::unique_ptr<storm::Environment> environmentOfSolverStorage;
         auto precOfSolver = env.solver().getPrecisionOfLinearEquationSolver(env.solver().getLinearEquationSolverType());
@@ -236,10 +327,18 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::performPolicy
 
         SolverStatus status = SolverStatus::InProgress;
         uint64_t iterations = 0;
+        // The states whose choice changed in the last improvement step. Empty until the first equation system was solved.
+        storm::storage::BitVector changedStates;
         this->startMeasureProgress();
         do {
-            // Solve the equation system for the 'DTMC'.
-            solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
+            // Solve the equation system for the 'DTMC'. After the first iteration, only the states affected by the changed choices need to be considered.
+            if (changedStates.size() == 0) {
+                solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
+                changedStates.resize(this->A->getRowGroupCount());
+            } else {
+                solveAffectedPartOfInducedEquationSystem(environmentOfSolver, solver, affectedPartSolver, scheduler, changedStates, x, subB, b);
+                changedStates.clear();
+            }
 
             // Go through the multiplication result and see whether we can improve any of the choices.
             bool schedulerImproved = false;
@@ -266,6 +365,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::performPolicy
                         // equal). only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
                         if (valueImproved(dir, x[group], choiceValue)) {
                             schedulerImproved = true;
+                            changedStates.set(group);
                             scheduler[group] = choice - this->A->getRowGroupIndices()[group];
                             x[group] = std::move(choiceValue);
                         }
@@ -335,7 +435,7 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
         // nothing to be done.
     }
 
-    if (method == MinMaxMethod::ValueIteration) {
+    if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PrioritizedValueIteration) {
         if (!this->hasUniqueSolution()) {  // Traditional value iteration has no requirements if the solution is unique.
             // Computing a scheduler is only possible if the solution is unique
             if (env.solver().minMax().isForceRequireUnique() || this->isTrackSchedulerSet()) {
@@ -529,8 +629,15 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         }
     }
 
-    storm::solver::helper::ValueIterationHelper<ValueType, false, SolutionType> viHelper(viOperator);
+    // The iterations of both precision phases count towards the iteration limit.
     uint64_t numIterations{0};
+
+    // Starting from a single precision approximation would invalidate the guarantee of the initial values.
+    if (guarantee == SolverGuarantee::None && env.solver().minMax().isMixedPrecision()) {
+        approximateInSinglePrecision(env, dir, x, b, numIterations);
+    }
+
+    storm::solver::helper::ValueIterationHelper<ValueType, false, SolutionType> viHelper(viOperator);
     auto viCallback = [&](SolverStatus const& current) {
         this->showProgressIterative(numIterations);
         return this->updateStatus(current, x, guarantee, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
@@ -553,6 +660,117 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
     return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
 }
 
+/*!
+ * Prioritized value iteration only updates the states whose values might still change significantly (see PrioritizedValueIterationHelper).
+ * This saves a lot of work if the values only change locally, e.g., on models with long chains.
+ */
+template<typename ValueType, typename SolutionType>
+bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquationsPrioritizedValueIteration(Environment const& env, OptimizationDirection dir,
+                                                                                                           std::vector<SolutionType>& x,
+                                                                                                           std::vector<ValueType> const& b) const {
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Prioritized value iteration does not handle interval-based models");
+        return false;
+    } else {
+        // As for standard value iteration, we approach the solution from below (above) if it is not unique.
+        SolverGuarantee guarantee = SolverGuarantee::None;
+        if (!this->hasUniqueSolution()) {
+            if (maximize(dir)) {
+                this->createLowerBoundsVector(x);
+                guarantee = SolverGuarantee::LessOrEqual;
+            } else {
+                this->createUpperBoundsVector(x);
+                guarantee = SolverGuarantee::GreaterOrEqual;
+            }
+        } else if (this->hasCustomTerminationCondition()) {
+            if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::LessOrEqual) && this->hasLowerBound()) {
+                this->createLowerBoundsVector(x);
+                guarantee = SolverGuarantee::LessOrEqual;
+            } else if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::GreaterOrEqual) && this->hasUpperBound()) {
+                this->createUpperBoundsVector(x);
+                guarantee = SolverGuarantee::GreaterOrEqual;
+            }
+        }
+
+        std::function<bool(uint64_t, uint64_t)> ignoredRowsCallback;
+        if (this->choiceFixedForRowGroup) {
+            // Ignore those rows that are not selected
+            assert(this->initialScheduler);
+            ignoredRowsCallback = [&](uint64_t groupIndex, uint64_t localRowIndex) {
+                return this->choiceFixedForRowGroup->get(groupIndex) && this->initialScheduler->at(groupIndex) != localRowIndex;
+            };
+        }
+        // The predecessor structure only depends on the matrix, so it is kept as long as caching is enabled.
+        if (!backwardAdjacency && storm::storage::SparseAdjacency::canRepresent(this->A->getRowGroupCount())) {
+            backwardAdjacency =
+                std::make_shared<storm::storage::SparseAdjacency const>(storm::storage::SparseAdjacency::createBackwardAdjacency(*this->A));
+        }
+        helper::PrioritizedValueIterationHelper<ValueType> pviHelper(*this->A, ignoredRowsCallback, backwardAdjacency);
+        uint64_t numIterations{0};
+        auto pviCallback = [&](SolverStatus const& current) {
+            this->showProgressIterative(numIterations);
+            return this->updateStatus(current, x, guarantee, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+        };
+        this->startMeasureProgress();
+        auto status = pviHelper.PVI(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
+                                    storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), dir, pviCallback);
+        this->reportStatus(status, numIterations);
+
+        // If requested, we store the scheduler for retrieval.
+        if (this->isTrackSchedulerSet()) {
+            setUpViOperator();
+            this->extractScheduler(x, b, dir, this->isUncertaintyRobust());
+        }
+
+        if (!this->isCachingEnabled()) {
+            clearCache();
+        }
+
+        return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+    }
+}
+
+/*!
+ * Approximates the solution on a single precision copy of the matrix. Since matrix-vector multiplication is memory bound, this roughly halves the
+ * time per iteration. The result is only used as starting point for value iteration in the original precision, which still decides about convergence.
+ */
+template<typename ValueType, typename SolutionType>
+void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::approximateInSinglePrecision(Environment const& env, OptimizationDirection dir,
+                                                                                                std::vector<SolutionType>& x,
+                                                                                                std::vector<ValueType> const& b, uint64_t& numIterations) const {
+    if constexpr (std::is_same_v<ValueType, double> && std::is_same_v<SolutionType, double>) {
+        // The single precision copy of the matrix is only needed in this phase, so it is released before the refinement in the original precision starts.
+        auto singlePrecisionViOperator = std::make_shared<helper::ValueIterationOperator<float, false>>();
+        singlePrecisionViOperator->template setMatrix<true>(*this->A);
+        if (this->choiceFixedForRowGroup) {
+            // Ignore those rows that are not selected
+            assert(this->initialScheduler);
+            singlePrecisionViOperator->setIgnoredRows(true, [&](uint64_t groupIndex, uint64_t localRowIndex) {
+                return this->choiceFixedForRowGroup->get(groupIndex) && this->initialScheduler->at(groupIndex) != localRowIndex;
+            });
+        }
+        std::vector<float> singleX = storm::utility::vector::convertNumericVector<float>(x);
+        std::vector<float> singleB = storm::utility::vector::convertNumericVector<float>(b);
+
+        // Single precision can not reliably detect convergence for very small thresholds, so we stop a bit earlier.
+        float const singlePrecision =
+            std::max(storm::utility::convertNumber<float>(storm::utility::convertNumber<double>(env.solver().minMax().getPrecision())), 1e-4f);
+        storm::solver::helper::ValueIterationHelper<float, false> viHelper(singlePrecisionViOperator);
+        auto viCallback = [&](SolverStatus const& current) {
+            this->showProgressIterative(numIterations);
+            return this->updateStatus(current, false, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+        };
+        auto status = viHelper.VI(singleX, singleB, numIterations, env.solver().minMax().getRelativeTerminationCriterion(), singlePrecision, dir, viCallback,
+                                  env.solver().minMax().getMultiplicationStyle());
+        STORM_LOG_INFO("Single precision value iteration terminated with status " << status << " after " << numIterations << " iterations.");
+        if (status != SolverStatus::Aborted) {
+            x = storm::utility::vector::convertNumericVector<double>(singleX);
+        }
+    } else {
+        STORM_LOG_WARN("Mixed precision value iteration is only supported for double precision. Skipping the single precision phase.");
+    }
+}
+
 template<typename ValueType, typename SolutionType>
 void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
     storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -755,6 +973,8 @@ template<typename ValueType, typename SolutionType>
 void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::clearCache() const {
     auxiliaryRowGroupVector.reset();
     viOperator.reset();
+    backwardAdjacency.reset();
+    backwardTransitions.reset();
     StandardMinMaxLinearEquationSolver<ValueType, SolutionType>::clearCache();
 }
 
@@ -8,6 +8,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
 #include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseAdjacency.h"
 
 #include "storm/solver/SolverStatus.h"
 
@@ -42,12 +43,19 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     bool solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver,
                                     std::vector<uint64_t> const& scheduler, std::vector<SolutionType>& x, std::vector<ValueType>& subB,
                                     std::vector<ValueType> const& originalB) const;
+    bool solveAffectedPartOfInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver,
+                                                  std::unique_ptr<LinearEquationSolver<ValueType>>& affectedPartSolver, std::vector<uint64_t> const& scheduler, storm::storage::BitVector const& changedStates,
+                                                  std::vector<SolutionType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const;
     bool solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
     bool performPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b,
                                 std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
     bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
 
     bool solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
+    bool solveEquationsPrioritizedValueIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x,
+                                                 std::vector<ValueType> const& b) const;
+    void approximateInSinglePrecision(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b,
+                                      uint64_t& numIterations) const;
     bool solveEquationsOptimisticValueIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x,
                                                 std::vector<ValueType> const& b) const;
     bool solveEquationsIntervalIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x,
@@ -70,6 +78,8 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     // possibly cached data
     mutable std::shared_ptr<storm::solver::helper::ValueIterationOperator<ValueType, false, SolutionType>> viOperator;
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
+    mutable std::shared_ptr<storm::storage::SparseAdjacency const> backwardAdjacency;  // only used for prioritized VI
+    mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> backwardTransitions;  // only used for incremental policy iteration
 };
 
 }  // namespace solver
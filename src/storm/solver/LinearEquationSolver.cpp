@@ -9,8 +9,11 @@
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/solver/GmmxxLinearEquationSolver.h"
 #include "storm/solver/NativeLinearEquationSolver.h"
+#include "storm/solver/PAdicLinearEquationSolver.h"
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include "storm/utility/MemoryAccounting.h"
+#include "storm/utility/Profiling.h"
 #include "storm/utility/vector.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
@@ -29,6 +32,8 @@ LinearEquationSolver<ValueType>::LinearEquationSolver() : cachingEnabled(false)
 
 template<typename ValueType>
 bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    STORM_PROFILE_SCOPE("solve");
+    storm::utility::memory::MemoryStage memoryStage("solving");
     return this->internalSolveEquations(env, x, b);
 }
 
@@ -106,6 +111,8 @@ std::unique_ptr<LinearEquationSolver<storm::RationalNumber>> GeneralLinearEquati
             return std::make_unique<EigenLinearEquationSolver<storm::RationalNumber>>();
         case EquationSolverType::Elimination:
             return std::make_unique<EliminationLinearEquationSolver<storm::RationalNumber>>();
+        case EquationSolverType::PAdic:
+            return std::make_unique<PAdicLinearEquationSolver<storm::RationalNumber>>();
         case EquationSolverType::Topological:
             return std::make_unique<TopologicalLinearEquationSolver<storm::RationalNumber>>();
         case EquationSolverType::Acyclic:
@@ -122,7 +129,7 @@ std::unique_ptr<LinearEquationSolver<storm::RationalFunction>> GeneralLinearEqua
     EquationSolverType type = env.solver().getLinearEquationSolverType();
 
     // Adjust the solver type if it is not supported by this value type
-    if (type == EquationSolverType::Gmmxx || type == EquationSolverType::Native) {
+    if (type == EquationSolverType::Gmmxx || type == EquationSolverType::Native || type == EquationSolverType::PAdic) {
         if (env.solver().isLinearEquationSolverTypeSetFromDefaultValue()) {
             STORM_LOG_INFO("Selecting '" + toString(EquationSolverType::Eigen) + "' as the linear equation solver since the previously selected one ("
                            << toString(type) << ") does not support parametric computations.");
@@ -193,6 +200,10 @@ std::unique_ptr<LinearEquationSolver<ValueType>> GeneralLinearEquationSolverFact
             return std::make_unique<TopologicalLinearEquationSolver<ValueType>>();
         case EquationSolverType::Acyclic:
             return std::make_unique<AcyclicLinearEquationSolver<ValueType>>();
+        case EquationSolverType::PAdic:
+            STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException,
+                            "The " << toString(type) << " linear equation solver only supports exact (rational) computations.");
+            return nullptr;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solver type.");
             return nullptr;
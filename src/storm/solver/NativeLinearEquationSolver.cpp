@@ -5,6 +5,9 @@
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/solver/helper/IntervalterationHelper.h"
@@ -572,6 +575,384 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearch(Environ
     return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
 }
 
+template<typename ValueType>
+NativeLinearEquationSolver<ValueType>::KrylovData::KrylovData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A)
+    : matrix(A),
+      preconditioner(env.solver().native().getPreconditioner()),
+      parallelize(storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!parallelize, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+    parallelize = false;
+#endif
+    if (preconditioner == NativeLinearEquationSolverPreconditioner::Ilu && !computeIluFactorization()) {
+        STORM_LOG_WARN("The ILU(0) factorization encountered a zero pivot. Falling back to diagonal preconditioning.");
+        iluMatrix = storm::storage::SparseMatrix<ValueType>();
+        preconditioner = NativeLinearEquationSolverPreconditioner::Diagonal;
+    }
+    if (preconditioner == NativeLinearEquationSolverPreconditioner::Diagonal) {
+        diagonal.assign(matrix.getRowCount(), storm::utility::one<ValueType>());
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            for (auto const& entry : matrix.getRow(row)) {
+                if (entry.getColumn() == row && !storm::utility::isZero(entry.getValue())) {
+                    diagonal[row] = storm::utility::one<ValueType>() / entry.getValue();
+                }
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::KrylovData::computeIluFactorization() {
+    uint64_t const numRows = matrix.getRowCount();
+    uint64_t const noPosition = std::numeric_limits<uint64_t>::max();
+    iluMatrix = matrix;
+    diagonal.assign(numRows, storm::utility::zero<ValueType>());
+    auto const entriesBegin = iluMatrix.begin();
+    // For the current row, this maps each column to the position of the corresponding entry (if there is one).
+    std::vector<uint64_t> positions(iluMatrix.getColumnCount(), noPosition);
+    for (uint64_t row = 0; row < numRows; ++row) {
+        for (auto entryIt = iluMatrix.begin(row), entryIte = iluMatrix.end(row); entryIt != entryIte; ++entryIt) {
+            positions[entryIt->getColumn()] = entryIt - entriesBegin;
+        }
+        for (auto entryIt = iluMatrix.begin(row), entryIte = iluMatrix.end(row); entryIt != entryIte && entryIt->getColumn() < row; ++entryIt) {
+            uint64_t const pivotRow = entryIt->getColumn();
+            entryIt->setValue(entryIt->getValue() / diagonal[pivotRow]);
+            // Only update entries that already exist (no fill-in).
+            for (auto const& pivotEntry : iluMatrix.getRow(pivotRow)) {
+                if (pivotEntry.getColumn() > pivotRow && positions[pivotEntry.getColumn()] != noPosition) {
+                    auto& updatedEntry = *(entriesBegin + positions[pivotEntry.getColumn()]);
+                    updatedEntry.setValue(updatedEntry.getValue() - entryIt->getValue() * pivotEntry.getValue());
+                }
+            }
+        }
+        if (positions[row] == noPosition || storm::utility::isZero((entriesBegin + positions[row])->getValue())) {
+            return false;
+        }
+        diagonal[row] = (entriesBegin + positions[row])->getValue();
+        for (auto const& entry : iluMatrix.getRow(row)) {
+            positions[entry.getColumn()] = noPosition;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+void NativeLinearEquationSolver<ValueType>::KrylovData::multiply(std::vector<ValueType> const& x, std::vector<ValueType>& result) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (parallelize) {
+        matrix.multiplyWithVectorParallel(x, result);
+        return;
+    }
+#endif
+    matrix.multiplyWithVector(x, result);
+}
+
+template<typename ValueType>
+void NativeLinearEquationSolver<ValueType>::KrylovData::computeResidual(std::vector<ValueType> const& x, std::vector<ValueType> const& b,
+                                                                        std::vector<ValueType>& residual) const {
+    multiply(x, residual);
+    applyPointwise(b, residual, residual, std::minus<>());
+}
+
+template<typename ValueType>
+ValueType NativeLinearEquationSolver<ValueType>::KrylovData::dotProduct(std::vector<ValueType> const& first, std::vector<ValueType> const& second) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (parallelize) {
+        return storm::utility::vector::dotProductParallel(first, second);
+    }
+#endif
+    return storm::utility::vector::dotProduct(first, second);
+}
+
+template<typename ValueType>
+ValueType NativeLinearEquationSolver<ValueType>::KrylovData::norm(std::vector<ValueType> const& vector) const {
+    return storm::utility::sqrt(dotProduct(vector, vector));
+}
+
+template<typename ValueType>
+template<typename Operation>
+void NativeLinearEquationSolver<ValueType>::KrylovData::applyPointwise(std::vector<ValueType> const& first, std::vector<ValueType> const& second,
+                                                                       std::vector<ValueType>& target, Operation f) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (parallelize) {
+        storm::utility::vector::applyPointwiseParallel(first, second, target, f);
+        return;
+    }
+#endif
+    storm::utility::vector::applyPointwise(first, second, target, f);
+}
+
+template<typename ValueType>
+template<typename Operation>
+void NativeLinearEquationSolver<ValueType>::KrylovData::applyPointwiseTernary(std::vector<ValueType> const& first, std::vector<ValueType> const& second,
+                                                                              std::vector<ValueType>& target, Operation f) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (parallelize) {
+        storm::utility::vector::applyPointwiseTernaryParallel(first, second, target, f);
+        return;
+    }
+#endif
+    storm::utility::vector::applyPointwiseTernary(first, second, target, f);
+}
+
+template<typename ValueType>
+void NativeLinearEquationSolver<ValueType>::KrylovData::precondition(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const {
+    switch (preconditioner) {
+        case NativeLinearEquationSolverPreconditioner::None:
+            result = vector;
+            break;
+        case NativeLinearEquationSolverPreconditioner::Diagonal:
+            applyPointwise(vector, diagonal, result, std::multiplies<>());
+            break;
+        case NativeLinearEquationSolverPreconditioner::Ilu:
+            // The triangular solves are inherently sequential.
+            result = vector;
+            for (uint64_t row = 0; row < result.size(); ++row) {
+                for (auto const& entry : iluMatrix.getRow(row)) {
+                    if (entry.getColumn() >= row) {
+                        break;
+                    }
+                    result[row] -= entry.getValue() * result[entry.getColumn()];
+                }
+            }
+            for (uint64_t row = result.size(); row > 0;) {
+                --row;
+                for (auto const& entry : iluMatrix.getRow(row)) {
+                    if (entry.getColumn() > row) {
+                        result[row] -= entry.getValue() * result[entry.getColumn()];
+                    }
+                }
+                result[row] /= diagonal[row];
+            }
+            break;
+    }
+}
+
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsGmres(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (GMRES, preconditioner = "
+                                                      << toString(env.solver().native().getPreconditioner()) << ")");
+    if (!krylovData || krylovData->preconditioner != env.solver().native().getPreconditioner()) {
+        krylovData = std::make_unique<KrylovData>(env, *A);
+    }
+
+    uint64_t const maxIter = env.solver().native().getMaximalNumberOfIterations();
+    uint64_t const restart = std::max<uint64_t>(env.solver().native().getRestartThreshold(), 1);
+    uint64_t const n = x.size();
+
+    // We stop as soon as the residual is small (relative to the norm of b, if requested).
+    ValueType target = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    if (env.solver().native().getRelativeTerminationCriterion()) {
+        target *= krylovData->norm(b);
+    }
+
+    // The Krylov basis, the Hessenberg matrix (column-wise) and the Givens rotations that make it upper triangular.
+    std::vector<std::vector<ValueType>> basis(restart + 1, std::vector<ValueType>(n));
+    std::vector<std::vector<ValueType>> hessenberg(restart, std::vector<ValueType>(restart + 1));
+    std::vector<ValueType> cosines(restart), sines(restart), g(restart + 1), y(restart);
+    std::vector<ValueType> residual(n), auxiliary(n);
+
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    krylovData->computeResidual(x, b, residual);
+    ValueType residualNorm = krylovData->norm(residual);
+    if (residualNorm <= target) {
+        status = SolverStatus::Converged;
+    }
+
+    this->startMeasureProgress();
+    while (status == SolverStatus::InProgress) {
+        std::fill(g.begin(), g.end(), storm::utility::zero<ValueType>());
+        g[0] = residualNorm;
+        krylovData->applyPointwise(residual, residual, basis[0], [&residualNorm](ValueType const& r, ValueType const&) { return r / residualNorm; });
+
+        // Arnoldi process with right preconditioning, i.e., on the matrix A * M^-1.
+        uint64_t k = 0;
+        for (; k < restart && iterations < maxIter; ++k) {
+            auto& column = hessenberg[k];
+            krylovData->precondition(basis[k], auxiliary);
+            krylovData->multiply(auxiliary, basis[k + 1]);
+            // Modified Gram-Schmidt
+            for (uint64_t i = 0; i <= k; ++i) {
+                column[i] = krylovData->dotProduct(basis[k + 1], basis[i]);
+                ValueType const& factor = column[i];
+                krylovData->applyPointwise(basis[k + 1], basis[i], basis[k + 1], [&factor](ValueType const& w, ValueType const& v) { return w - factor * v; });
+            }
+            column[k + 1] = krylovData->norm(basis[k + 1]);
+            bool const breakdown = storm::utility::isZero(column[k + 1]);
+            if (!breakdown) {
+                ValueType const& factor = column[k + 1];
+                krylovData->applyPointwise(basis[k + 1], basis[k + 1], basis[k + 1], [&factor](ValueType const& w, ValueType const&) { return w / factor; });
+            }
+
+            // Apply the previous rotations to the new column and compute a rotation that eliminates its subdiagonal entry.
+            for (uint64_t i = 0; i < k; ++i) {
+                ValueType tmp = cosines[i] * column[i] + sines[i] * column[i + 1];
+                column[i + 1] = cosines[i] * column[i + 1] - sines[i] * column[i];
+                column[i] = std::move(tmp);
+            }
+            ValueType denominator = storm::utility::sqrt(column[k] * column[k] + column[k + 1] * column[k + 1]);
+            if (storm::utility::isZero(denominator)) {
+                // The matrix is singular on the current Krylov subspace, so this column can not be used.
+                break;
+            }
+            cosines[k] = column[k] / denominator;
+            sines[k] = column[k + 1] / denominator;
+            column[k] = std::move(denominator);
+            column[k + 1] = storm::utility::zero<ValueType>();
+            g[k + 1] = -sines[k] * g[k];
+            g[k] = cosines[k] * g[k];
+            ++iterations;
+
+            // |g[k+1]| is the norm of the residual of the current (implicit) iterate.
+            if (breakdown || storm::utility::abs(g[k + 1]) <= target) {
+                ++k;
+                break;
+            }
+        }
+
+        // Solve the upper triangular system and update x += M^-1 * (V * y).
+        for (uint64_t i = k; i > 0;) {
+            --i;
+            y[i] = g[i];
+            for (uint64_t j = i + 1; j < k; ++j) {
+                y[i] -= hessenberg[j][i] * y[j];
+            }
+            y[i] /= hessenberg[i][i];
+        }
+        std::fill(residual.begin(), residual.end(), storm::utility::zero<ValueType>());
+        for (uint64_t i = 0; i < k; ++i) {
+            ValueType const& factor = y[i];
+            krylovData->applyPointwise(residual, basis[i], residual, [&factor](ValueType const& r, ValueType const& v) { return r + factor * v; });
+        }
+        krylovData->precondition(residual, auxiliary);
+        krylovData->applyPointwise(x, auxiliary, x, std::plus<>());
+
+        // Check the actual residual, which might differ from the estimate due to rounding errors.
+        krylovData->computeResidual(x, b, residual);
+        residualNorm = krylovData->norm(residual);
+        if (residualNorm <= target) {
+            status = SolverStatus::Converged;
+        } else if (k == 0 && iterations < maxIter) {
+            STORM_LOG_WARN("GMRES can not make further progress.");
+            status = SolverStatus::Aborted;
+        }
+
+        this->showProgressIterative(iterations);
+        status = this->updateStatus(status, x, SolverGuarantee::None, iterations, maxIter);
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    this->reportStatus(status, iterations);
+
+    return status == SolverStatus::Converged;
+}
+
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsBicgstab(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (BiCGSTAB, preconditioner = "
+                                                      << toString(env.solver().native().getPreconditioner()) << ")");
+    if (!krylovData || krylovData->preconditioner != env.solver().native().getPreconditioner()) {
+        krylovData = std::make_unique<KrylovData>(env, *A);
+    }
+
+    uint64_t const maxIter = env.solver().native().getMaximalNumberOfIterations();
+    uint64_t const n = x.size();
+
+    // We stop as soon as the residual is small (relative to the norm of b, if requested).
+    ValueType target = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    if (env.solver().native().getRelativeTerminationCriterion()) {
+        target *= krylovData->norm(b);
+    }
+
+    std::vector<ValueType> residual(n), shadowResidual(n), p(n), v(n), s(n), t(n), preconditionedP(n), preconditionedS(n);
+    ValueType rho, alpha, omega;
+
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    bool restart = true;
+    bool restartedInLastIteration = false;
+    krylovData->computeResidual(x, b, residual);
+    if (krylovData->norm(residual) <= target) {
+        status = SolverStatus::Converged;
+    }
+
+    this->startMeasureProgress();
+    while (status == SolverStatus::InProgress) {
+        if (restart) {
+            // (Re-)start with the current residual as shadow residual. This is also how we deal with breakdowns.
+            if (restartedInLastIteration) {
+                STORM_LOG_WARN("BiCGSTAB can not make further progress.");
+                status = SolverStatus::Aborted;
+                break;
+            }
+            shadowResidual = residual;
+            std::fill(p.begin(), p.end(), storm::utility::zero<ValueType>());
+            std::fill(v.begin(), v.end(), storm::utility::zero<ValueType>());
+            rho = alpha = omega = storm::utility::one<ValueType>();
+            restart = false;
+            restartedInLastIteration = true;
+        }
+
+        ValueType newRho = krylovData->dotProduct(shadowResidual, residual);
+        if (storm::utility::isZero(newRho)) {
+            restart = true;
+            continue;
+        }
+        ValueType const beta = (newRho / rho) * (alpha / omega);
+        rho = std::move(newRho);
+        krylovData->applyPointwiseTernary(residual, v, p, [&beta, &omega](ValueType const& rValue, ValueType const& vValue, ValueType const& pValue) {
+            return rValue + beta * (pValue - omega * vValue);
+        });
+        krylovData->precondition(p, preconditionedP);
+        krylovData->multiply(preconditionedP, v);
+        ValueType const denominator = krylovData->dotProduct(shadowResidual, v);
+        if (storm::utility::isZero(denominator)) {
+            restart = true;
+            continue;
+        }
+        alpha = rho / denominator;
+        krylovData->applyPointwise(residual, v, s, [&alpha](ValueType const& rValue, ValueType const& vValue) { return rValue - alpha * vValue; });
+        if (krylovData->norm(s) <= target) {
+            krylovData->applyPointwise(x, preconditionedP, x, [&alpha](ValueType const& xValue, ValueType const& pValue) { return xValue + alpha * pValue; });
+            ++iterations;
+            status = SolverStatus::Converged;
+            break;
+        }
+        krylovData->precondition(s, preconditionedS);
+        krylovData->multiply(preconditionedS, t);
+        ValueType const tSquaredNorm = krylovData->dotProduct(t, t);
+        omega = storm::utility::isZero(tSquaredNorm) ? storm::utility::zero<ValueType>() : krylovData->dotProduct(t, s) / tSquaredNorm;
+        krylovData->applyPointwiseTernary(preconditionedP, preconditionedS, x,
+                                          [&alpha, &omega](ValueType const& pValue, ValueType const& sValue, ValueType const& xValue) {
+                                              return xValue + alpha * pValue + omega * sValue;
+                                          });
+        krylovData->applyPointwise(s, t, residual, [&omega](ValueType const& sValue, ValueType const& tValue) { return sValue - omega * tValue; });
+        // If omega is zero, the next iteration would divide by zero.
+        restart = storm::utility::isZero(omega);
+        restartedInLastIteration = false;
+        ++iterations;
+
+        if (krylovData->norm(residual) <= target) {
+            status = SolverStatus::Converged;
+        }
+
+        this->showProgressIterative(iterations);
+        status = this->updateStatus(status, x, SolverGuarantee::None, iterations, maxIter);
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    this->reportStatus(status, iterations);
+
+    return status == SolverStatus::Converged;
+}
+
 template<typename ValueType>
 NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMethod(Environment const& env, bool isExactMode) const {
     // Adjust the method if none was specified and we want exact or sound computations
@@ -622,6 +1003,10 @@ bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment c
             return this->solveEquationsIntervalIteration(env, x, b);
         case NativeLinearEquationSolverMethod::RationalSearch:
             return this->solveEquationsRationalSearch(env, x, b);
+        case NativeLinearEquationSolverMethod::Gmres:
+            return this->solveEquationsGmres(env, x, b);
+        case NativeLinearEquationSolverMethod::Bicgstab:
+            return this->solveEquationsBicgstab(env, x, b);
     }
     STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solving technique.");
     return false;
@@ -657,6 +1042,7 @@ template<typename ValueType>
 void NativeLinearEquationSolver<ValueType>::clearCache() const {
     jacobiDecomposition.reset();
     walkerChaeData.reset();
+    krylovData.reset();
     multiplier.reset();
     viOperator.reset();
     LinearEquationSolver<ValueType>::clearCache();
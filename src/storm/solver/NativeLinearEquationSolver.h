@@ -72,6 +72,8 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    virtual bool solveEquationsGmres(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    virtual bool solveEquationsBicgstab(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
     void setUpViOperator() const;
 
@@ -114,6 +116,45 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
         std::vector<ValueType> newX;
     };
     mutable std::unique_ptr<WalkerChaeData> walkerChaeData;
+
+    /*!
+     * The kernels of the Krylov methods. These operate directly on the matrix of the solver and are parallelized if requested.
+     * Only the ILU preconditioner needs a copy of the matrix (holding the incomplete factorization).
+     */
+    struct KrylovData {
+        KrylovData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A);
+
+        void multiply(std::vector<ValueType> const& x, std::vector<ValueType>& result) const;
+        void computeResidual(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& residual) const;
+        ValueType dotProduct(std::vector<ValueType> const& first, std::vector<ValueType> const& second) const;
+        ValueType norm(std::vector<ValueType> const& vector) const;
+        template<typename Operation>
+        void applyPointwise(std::vector<ValueType> const& first, std::vector<ValueType> const& second, std::vector<ValueType>& target, Operation f) const;
+        template<typename Operation>
+        void applyPointwiseTernary(std::vector<ValueType> const& first, std::vector<ValueType> const& second, std::vector<ValueType>& target,
+                                   Operation f) const;
+
+        /*!
+         * Applies the inverse of the preconditioner to the given vector.
+         */
+        void precondition(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const;
+
+        /*!
+         * Computes the ILU(0) factorization of the matrix, i.e., an incomplete LU factorization without fill-in.
+         * @return false if a zero pivot was encountered.
+         */
+        bool computeIluFactorization();
+
+        storm::storage::SparseMatrix<ValueType> const& matrix;
+        NativeLinearEquationSolverPreconditioner preconditioner;
+        bool parallelize;
+
+        // The strictly lower part (L) and the strictly upper part (U) of the ILU(0) factorization. The diagonal of U is stored in 'diagonal'.
+        storm::storage::SparseMatrix<ValueType> iluMatrix;
+        // Either the diagonal of U (for ILU) or the inverted diagonal of the matrix (for diagonal preconditioning).
+        std::vector<ValueType> diagonal;
+    };
+    mutable std::unique_ptr<KrylovData> krylovData;
 };
 
 template<typename ValueType>
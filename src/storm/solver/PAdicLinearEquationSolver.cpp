@@ -0,0 +1,386 @@
+#include "storm/solver/PAdicLinearEquationSolver.h"
+
+#include <cmath>
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/UnexpectedException.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+namespace detail {
+// Primes below 2^31 so that the product of two residues fits into 64 bits.
+static const std::vector<uint64_t> padicPrimes = {2147483647ull, 2147483629ull, 2147483587ull, 2147483579ull, 2147483563ull};
+
+uint64_t modularPower(uint64_t base, uint64_t exponent, uint64_t modulus) {
+    uint64_t result = 1;
+    base %= modulus;
+    while (exponent > 0) {
+        if (exponent & 1ull) {
+            result = result * base % modulus;
+        }
+        base = base * base % modulus;
+        exponent >>= 1;
+    }
+    return result;
+}
+
+uint64_t modularInverse(uint64_t value, uint64_t prime) {
+    // Fermat's little theorem
+    return modularPower(value, prime - 2, prime);
+}
+}  // namespace detail
+
+template<typename ValueType>
+PAdicLinearEquationSolver<ValueType>::PAdicLinearEquationSolver() : localA(nullptr), A(nullptr) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+PAdicLinearEquationSolver<ValueType>::PAdicLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) : localA(nullptr), A(nullptr) {
+    this->setMatrix(A);
+}
+
+template<typename ValueType>
+PAdicLinearEquationSolver<ValueType>::PAdicLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) : localA(nullptr), A(nullptr) {
+    this->setMatrix(std::move(A));
+}
+
+template<typename ValueType>
+void PAdicLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
+    this->A = &A;
+    localA.reset();
+    this->clearCache();
+}
+
+template<typename ValueType>
+void PAdicLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
+    localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
+    this->A = localA.get();
+    this->clearCache();
+}
+
+template<typename ValueType>
+void PAdicLinearEquationSolver<ValueType>::factorize() const {
+    rowFactors.clear();
+    integerEntries.clear();
+    rowFactors.reserve(A->getRowCount());
+    integerEntries.reserve(A->getEntryCount());
+    for (uint64_t row = 0; row < A->getRowCount(); ++row) {
+        IntegerType factor = storm::utility::one<IntegerType>();
+        for (auto const& entry : A->getRow(row)) {
+            factor = carl::lcm(factor, storm::utility::denominator(entry.getValue()));
+        }
+        ValueType factorAsValue = storm::utility::convertNumber<ValueType>(factor);
+        for (auto const& entry : A->getRow(row)) {
+            integerEntries.push_back(storm::utility::numerator(entry.getValue() * factorAsValue));
+        }
+        rowFactors.push_back(std::move(factor));
+    }
+
+    for (uint64_t candidate : detail::padicPrimes) {
+        if (factorizeModulo(candidate)) {
+            prime = candidate;
+            return;
+        }
+        STORM_LOG_INFO("Matrix is singular modulo " << candidate << ". Trying a different prime.");
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unable to factorize the matrix of the linear equation system. Is it singular?");
+}
+
+template<typename ValueType>
+bool PAdicLinearEquationSolver<ValueType>::factorizeModulo(uint64_t p) const {
+    uint64_t const n = A->getRowCount();
+    IntegerType const primeAsInteger = storm::utility::convertNumber<IntegerType>(p);
+
+    // Reduce the integral matrix modulo the prime. For each column, we also keep track of the rows that have an entry in that column.
+    std::vector<std::vector<std::pair<uint64_t, uint64_t>>> rows(n);
+    std::vector<std::vector<uint64_t>> rowsWithColumn(n);
+    auto integerEntryIt = integerEntries.begin();
+    for (uint64_t row = 0; row < n; ++row) {
+        for (auto const& entry : A->getRow(row)) {
+            uint64_t value = storm::utility::convertNumber<uint64_t>(
+                storm::utility::convertNumber<ValueType>(storm::utility::mod<IntegerType>(*integerEntryIt, primeAsInteger)));
+            ++integerEntryIt;
+            if (value != 0) {
+                rows[row].emplace_back(entry.getColumn(), value);
+                rowsWithColumn[entry.getColumn()].push_back(row);
+            }
+        }
+    }
+
+    pivotRows.assign(n, 0);
+    inversePivots.assign(n, 0);
+    upperEntries.assign(n, {});
+    lowerEntries.assign(n, {});
+    storm::storage::BitVector usedRows(n, false);
+    // After eliminating the first k unknowns, the remaining rows have no entries in columns smaller than k.
+    auto hasEntryInColumn = [&rows, &usedRows](uint64_t row, uint64_t column) {
+        return !usedRows.get(row) && !rows[row].empty() && rows[row].front().first == column;
+    };
+    std::vector<std::pair<uint64_t, uint64_t>> eliminatedRow;
+    for (uint64_t k = 0; k < n; ++k) {
+        // Keep the natural order if possible. Otherwise, pick the sparsest candidate as pivot to reduce fill-in.
+        uint64_t pivot = n;
+        if (hasEntryInColumn(k, k)) {
+            pivot = k;
+        } else {
+            for (auto row : rowsWithColumn[k]) {
+                if (hasEntryInColumn(row, k) && (pivot == n || rows[row].size() < rows[pivot].size())) {
+                    pivot = row;
+                }
+            }
+        }
+        if (pivot == n) {
+            return false;
+        }
+        usedRows.set(pivot);
+        pivotRows[k] = pivot;
+        auto const& pivotRow = rows[pivot];
+        inversePivots[k] = detail::modularInverse(pivotRow.front().second, p);
+
+        // Eliminate the k'th unknown from all remaining rows. A row can appear multiple times in rowsWithColumn[k], but only the first occurrence
+        // still has an entry in column k.
+        for (auto row : rowsWithColumn[k]) {
+            if (!hasEntryInColumn(row, k)) {
+                continue;
+            }
+            uint64_t const factor = rows[row].front().second * inversePivots[k] % p;
+            lowerEntries[k].emplace_back(row, factor);
+            eliminatedRow.clear();
+            auto rowIt = rows[row].begin() + 1;
+            auto rowIte = rows[row].end();
+            auto pivotIt = pivotRow.begin() + 1;
+            auto pivotIte = pivotRow.end();
+            while (rowIt != rowIte || pivotIt != pivotIte) {
+                if (pivotIt == pivotIte || (rowIt != rowIte && rowIt->first < pivotIt->first)) {
+                    eliminatedRow.push_back(*rowIt);
+                    ++rowIt;
+                } else {
+                    uint64_t const subtrahend = factor * pivotIt->second % p;
+                    if (rowIt != rowIte && rowIt->first == pivotIt->first) {
+                        uint64_t value = (rowIt->second + p - subtrahend) % p;
+                        if (value != 0) {
+                            eliminatedRow.emplace_back(rowIt->first, value);
+                        }
+                        ++rowIt;
+                    } else {
+                        // Fill-in
+                        eliminatedRow.emplace_back(pivotIt->first, p - subtrahend);
+                        rowsWithColumn[pivotIt->first].push_back(row);
+                    }
+                    ++pivotIt;
+                }
+            }
+            rows[row].swap(eliminatedRow);
+        }
+        upperEntries[k].assign(pivotRow.begin() + 1, pivotRow.end());
+        std::vector<std::pair<uint64_t, uint64_t>>().swap(rows[pivot]);
+        std::vector<uint64_t>().swap(rowsWithColumn[k]);
+    }
+    return true;
+}
+
+template<typename ValueType>
+void PAdicLinearEquationSolver<ValueType>::solveModulo(std::vector<uint64_t>& rhs, std::vector<uint64_t>& solution) const {
+    uint64_t const p = prime.value();
+    uint64_t const n = rhs.size();
+    // Apply the row operations of the elimination.
+    for (uint64_t k = 0; k < n; ++k) {
+        uint64_t const pivotValue = rhs[pivotRows[k]];
+        if (pivotValue != 0) {
+            for (auto const& [row, factor] : lowerEntries[k]) {
+                rhs[row] = (rhs[row] + p - factor * pivotValue % p) % p;
+            }
+        }
+    }
+    // Back substitution.
+    for (uint64_t k = n; k > 0;) {
+        --k;
+        uint64_t value = rhs[pivotRows[k]];
+        for (auto const& [column, entry] : upperEntries[k]) {
+            value = (value + p - entry * solution[column] % p) % p;
+        }
+        solution[k] = value * inversePivots[k] % p;
+    }
+}
+
+template<typename ValueType>
+bool PAdicLinearEquationSolver<ValueType>::reconstructRational(IntegerType const& value, IntegerType const& modulus, ValueType& result) {
+    // Extended euclidean algorithm that stops as soon as the remainder r satisfies 2*r^2 < modulus (Wang's rational reconstruction).
+    IntegerType const two = storm::utility::convertNumber<IntegerType>(2ull);
+    IntegerType r0 = modulus;
+    IntegerType r1 = value;
+    IntegerType t0 = storm::utility::convertNumber<IntegerType>(0ull);
+    IntegerType t1 = storm::utility::one<IntegerType>();
+    while (two * r1 * r1 >= modulus) {
+        auto quotientAndRemainder = storm::utility::divide<IntegerType>(r0, r1);
+        r0 = std::move(r1);
+        r1 = std::move(quotientAndRemainder.second);
+        IntegerType t2 = t0 - quotientAndRemainder.first * t1;
+        t0 = std::move(t1);
+        t1 = std::move(t2);
+    }
+    if (storm::utility::isZero(t1) || two * t1 * t1 >= modulus || !storm::utility::isOne(carl::gcd(r1, t1))) {
+        return false;
+    }
+    result = storm::utility::convertNumber<ValueType>(r1) / storm::utility::convertNumber<ValueType>(t1);
+    return true;
+}
+
+template<typename ValueType>
+bool PAdicLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with p-adic lifting");
+    if (!prime) {
+        factorize();
+    }
+    uint64_t const n = x.size();
+    uint64_t const p = prime.value();
+    IntegerType const primeAsInteger = storm::utility::convertNumber<IntegerType>(p);
+    auto toDouble = [](IntegerType const& value) { return storm::utility::convertNumber<double>(storm::utility::convertNumber<ValueType>(value)); };
+
+    // Scale the right-hand side so that the system M*y = c over the integers has the solution y = rhsFactor * x.
+    std::vector<ValueType> scaledB;
+    scaledB.reserve(n);
+    IntegerType rhsFactor = storm::utility::one<IntegerType>();
+    for (uint64_t row = 0; row < n; ++row) {
+        scaledB.push_back(b[row] * storm::utility::convertNumber<ValueType>(rowFactors[row]));
+        rhsFactor = carl::lcm(rhsFactor, storm::utility::denominator(scaledB.back()));
+    }
+    ValueType const rhsFactorAsValue = storm::utility::convertNumber<ValueType>(rhsFactor);
+    std::vector<IntegerType> residual;
+    residual.reserve(n);
+    for (auto const& value : scaledB) {
+        residual.push_back(storm::utility::numerator(value * rhsFactorAsValue));
+    }
+
+    // By Hadamard's bound and Cramer's rule, the numerators and denominators of the solution are bounded by H = prod_i ||(M_i, c_i)||.
+    // Rational reconstruction is guaranteed to succeed once the modulus exceeds 2*H^2.
+    double log2Bound = 1.0;
+    auto integerEntryIt = integerEntries.begin();
+    for (uint64_t row = 0; row < n; ++row) {
+        double squaredNorm = std::pow(toDouble(residual[row]), 2);
+        for (uint64_t entry = 0; entry < A->getRow(row).getNumberOfEntries(); ++entry, ++integerEntryIt) {
+            squaredNorm += std::pow(toDouble(*integerEntryIt), 2);
+        }
+        log2Bound += std::log2(std::max(squaredNorm, 1.0));
+    }
+    uint64_t const maxSteps = std::isfinite(log2Bound) ? static_cast<uint64_t>(std::ceil(log2Bound / std::log2(static_cast<double>(p)))) + 1
+                                                       : std::numeric_limits<uint64_t>::max();
+
+    // Invariant: c = M * accumulated + modulus * residual
+    std::vector<IntegerType> accumulated(n, storm::utility::convertNumber<IntegerType>(0ull));
+    IntegerType modulus = storm::utility::one<IntegerType>();
+    std::vector<uint64_t> modularRhs(n), modularSolution(n);
+    std::vector<IntegerType> step(n);
+    for (uint64_t numSteps = 1;; ++numSteps) {
+        for (uint64_t row = 0; row < n; ++row) {
+            modularRhs[row] =
+                storm::utility::convertNumber<uint64_t>(storm::utility::convertNumber<ValueType>(storm::utility::mod<IntegerType>(residual[row], primeAsInteger)));
+        }
+        solveModulo(modularRhs, modularSolution);
+        for (uint64_t i = 0; i < n; ++i) {
+            step[i] = storm::utility::convertNumber<IntegerType>(modularSolution[i]);
+            accumulated[i] += step[i] * modulus;
+        }
+        bool residualIsZero = true;
+        integerEntryIt = integerEntries.begin();
+        for (uint64_t row = 0; row < n; ++row) {
+            IntegerType value = residual[row];
+            for (auto const& entry : A->getRow(row)) {
+                value -= *integerEntryIt * step[entry.getColumn()];
+                ++integerEntryIt;
+            }
+            auto quotientAndRemainder = storm::utility::divide<IntegerType>(value, primeAsInteger);
+            STORM_LOG_ASSERT(storm::utility::isZero(quotientAndRemainder.second), "Residual is not divisible by the prime.");
+            residual[row] = std::move(quotientAndRemainder.first);
+            residualIsZero &= storm::utility::isZero(residual[row]);
+        }
+        modulus *= primeAsInteger;
+
+        if (residualIsZero) {
+            // The accumulated values are the exact (integral) solution.
+            for (uint64_t i = 0; i < n; ++i) {
+                x[i] = storm::utility::convertNumber<ValueType>(accumulated[i]) / rhsFactorAsValue;
+            }
+            STORM_LOG_INFO("Solved linear equation system after " << numSteps << " lifting steps.");
+            return true;
+        }
+
+        // Reconstruction is comparatively expensive, so we only attempt it after exponentially growing numbers of steps.
+        if ((numSteps & (numSteps - 1)) == 0 || numSteps >= maxSteps) {
+            bool success = true;
+            for (uint64_t i = 0; success && i < n; ++i) {
+                success = reconstructRational(accumulated[i], modulus, x[i]);
+                x[i] /= rhsFactorAsValue;
+            }
+            // Since we do not wait until the modulus exceeds the bound, we need to verify the candidate solution.
+            for (uint64_t row = 0; success && row < n; ++row) {
+                ValueType value = storm::utility::zero<ValueType>();
+                for (auto const& entry : A->getRow(row)) {
+                    value += entry.getValue() * x[entry.getColumn()];
+                }
+                success = value == b[row];
+            }
+            if (success) {
+                STORM_LOG_INFO("Solved linear equation system after " << numSteps << " lifting steps.");
+                return true;
+            }
+            STORM_LOG_THROW(numSteps < maxSteps, storm::exceptions::UnexpectedException, "Rational reconstruction failed although the modulus is large enough.");
+        }
+        if (storm::utility::resources::isTerminate()) {
+            return false;
+        }
+    }
+}
+
+template<typename ValueType>
+LinearEquationSolverProblemFormat PAdicLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const&) const {
+    return LinearEquationSolverProblemFormat::EquationSystem;
+}
+
+template<typename ValueType>
+void PAdicLinearEquationSolver<ValueType>::clearCache() const {
+    rowFactors.clear();
+    integerEntries.clear();
+    prime = std::nullopt;
+    pivotRows.clear();
+    inversePivots.clear();
+    upperEntries.clear();
+    lowerEntries.clear();
+    LinearEquationSolver<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+uint64_t PAdicLinearEquationSolver<ValueType>::getMatrixRowCount() const {
+    return this->A->getRowCount();
+}
+
+template<typename ValueType>
+uint64_t PAdicLinearEquationSolver<ValueType>::getMatrixColumnCount() const {
+    return this->A->getColumnCount();
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> PAdicLinearEquationSolverFactory<ValueType>::create(Environment const&) const {
+    return std::make_unique<storm::solver::PAdicLinearEquationSolver<ValueType>>();
+}
+
+template<typename ValueType>
+std::unique_ptr<LinearEquationSolverFactory<ValueType>> PAdicLinearEquationSolverFactory<ValueType>::clone() const {
+    return std::make_unique<PAdicLinearEquationSolverFactory<ValueType>>(*this);
+}
+
+#ifdef STORM_HAVE_CARL
+template class PAdicLinearEquationSolver<storm::RationalNumber>;
+template class PAdicLinearEquationSolverFactory<storm::RationalNumber>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <optional>
+
+#include "storm/solver/LinearEquationSolver.h"
+#include "storm/utility/NumberTraits.h"
+
+namespace storm {
+namespace solver {
+
+/*!
+ * A class that solves linear equation systems exactly using Dixon's p-adic lifting.
+ * The (integer scaled) matrix is factorized once modulo a machine-word prime. Each lifting step solves a system modulo this prime and divides the
+ * residual by the prime. Once the accumulated p-adic approximation is precise enough, the rational solution is obtained via rational reconstruction.
+ * Contrary to elimination over the rationals, the size of intermediate numbers only grows linearly in the number of lifting steps.
+ */
+template<typename ValueType>
+class PAdicLinearEquationSolver : public LinearEquationSolver<ValueType> {
+   public:
+    PAdicLinearEquationSolver();
+    PAdicLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A);
+    PAdicLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A);
+
+    virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) override;
+    virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
+
+    virtual LinearEquationSolverProblemFormat getEquationProblemFormat(Environment const& env) const override;
+
+    virtual void clearCache() const override;
+
+   protected:
+    virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+
+   private:
+    typedef typename storm::NumberTraits<ValueType>::IntegerType IntegerType;
+
+    virtual uint64_t getMatrixRowCount() const override;
+    virtual uint64_t getMatrixColumnCount() const override;
+
+    /*!
+     * Scales each row of the matrix to integer entries and factorizes the result modulo a suitable prime.
+     */
+    void factorize() const;
+
+    /*!
+     * Tries to compute an LU factorization of the scaled matrix modulo the given prime.
+     * @return false if the matrix is singular modulo the prime.
+     */
+    bool factorizeModulo(uint64_t prime) const;
+
+    /*!
+     * Solves the factorized system modulo the prime, i.e., computes the solution for the given right-hand side (whose entries are modified).
+     */
+    void solveModulo(std::vector<uint64_t>& rhs, std::vector<uint64_t>& solution) const;
+
+    /*!
+     * Finds the fraction with small numerator and denominator that is congruent to the given value modulo the given modulus (if it exists).
+     */
+    static bool reconstructRational(IntegerType const& value, IntegerType const& modulus, ValueType& result);
+
+    // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
+    // when the solver is destructed.
+    std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+
+    // A pointer to the original sparse matrix given to this solver. If the solver takes posession of the matrix
+    // the pointer refers to localA.
+    storm::storage::SparseMatrix<ValueType> const* A;
+
+    // The factor of each row that makes all its entries integral and the resulting (integral) matrix entries in the order of the original entries.
+    mutable std::vector<IntegerType> rowFactors;
+    mutable std::vector<IntegerType> integerEntries;
+
+    // The factorization modulo the prime. For each elimination step k (which eliminates the k'th unknown), we store the row used as pivot, the inverse
+    // of the pivot, the remaining entries of the pivot row (upper part) and the factors used to eliminate the k'th unknown from other rows (lower part).
+    mutable std::optional<uint64_t> prime;
+    mutable std::vector<uint64_t> pivotRows;
+    mutable std::vector<uint64_t> inversePivots;
+    mutable std::vector<std::vector<std::pair<uint64_t, uint64_t>>> upperEntries;
+    mutable std::vector<std::vector<std::pair<uint64_t, uint64_t>>> lowerEntries;
+};
+
+template<typename ValueType>
+class PAdicLinearEquationSolverFactory : public LinearEquationSolverFactory<ValueType> {
+   public:
+    using LinearEquationSolverFactory<ValueType>::create;
+
+    virtual std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> create(Environment const& env) const override;
+
+    virtual std::unique_ptr<LinearEquationSolverFactory<ValueType>> clone() const override;
+};
+
+}  // namespace solver
+}  // namespace storm
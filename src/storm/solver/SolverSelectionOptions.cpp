@@ -24,6 +24,8 @@ std::string toString(MinMaxMethod m) {
             return "vi-to-pi";
         case MinMaxMethod::Acyclic:
             return "vi-to-pi";
+        case MinMaxMethod::PrioritizedValueIteration:
+            return "prioritizedvalueiteration";
     }
     return "invalid";
 }
@@ -100,6 +102,8 @@ std::string toString(EquationSolverType t) {
             return "Topological";
         case EquationSolverType::Acyclic:
             return "Acyclic";
+        case EquationSolverType::PAdic:
+            return "PAdic";
     }
     return "invalid";
 }
@@ -134,6 +138,22 @@ std::string toString(NativeLinearEquationSolverMethod t) {
             return "IntervalIteration";
         case NativeLinearEquationSolverMethod::RationalSearch:
             return "RationalSearch";
+        case NativeLinearEquationSolverMethod::Gmres:
+            return "GMRES";
+        case NativeLinearEquationSolverMethod::Bicgstab:
+            return "BiCGSTAB";
+    }
+    return "invalid";
+}
+
+std::string toString(NativeLinearEquationSolverPreconditioner t) {
+    switch (t) {
+        case NativeLinearEquationSolverPreconditioner::Diagonal:
+            return "diagonal";
+        case NativeLinearEquationSolverPreconditioner::Ilu:
+            return "ilu";
+        case NativeLinearEquationSolverPreconditioner::None:
+            return "none";
     }
     return "invalid";
 }
@@ -6,21 +6,22 @@
 namespace storm {
 namespace solver {
 ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, LinearProgramming, Topological, RationalSearch, IntervalIteration,
-                              SoundValueIteration, OptimisticValueIteration, ViToPi, Acyclic) ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx)
+                              SoundValueIteration, OptimisticValueIteration, ViToPi, Acyclic, PrioritizedValueIteration) ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx)
     ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration)
         ExtendEnumsWithSelectionField(LraMethod, LinearProgramming, ValueIteration, GainBiasEquations, LraDistributionEquations)
             ExtendEnumsWithSelectionField(MaBoundedReachabilityMethod, Imca, UnifPlus)
 
                 ExtendEnumsWithSelectionField(LpSolverType, Gurobi, Glpk, Z3, Soplex)
-                    ExtendEnumsWithSelectionField(EquationSolverType, Native, Gmmxx, Eigen, Elimination, Topological, Acyclic)
+                    ExtendEnumsWithSelectionField(EquationSolverType, Native, Gmmxx, Eigen, Elimination, Topological, Acyclic, PAdic)
                         ExtendEnumsWithSelectionField(SmtSolverType, Z3, Mathsat)
 
                             ExtendEnumsWithSelectionField(NativeLinearEquationSolverMethod, Jacobi, GaussSeidel, SOR, WalkerChae, Power, SoundValueIteration,
-                                                          OptimisticValueIteration, IntervalIteration, RationalSearch)
-                                ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverMethod, Bicgstab, Qmr, Gmres)
-                                    ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
-                                        ExtendEnumsWithSelectionField(EigenLinearEquationSolverMethod, SparseLU, Bicgstab, DGmres, Gmres)
-                                            ExtendEnumsWithSelectionField(EigenLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
+                                                          OptimisticValueIteration, IntervalIteration, RationalSearch, Gmres, Bicgstab)
+                                ExtendEnumsWithSelectionField(NativeLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
+                                    ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverMethod, Bicgstab, Qmr, Gmres)
+                                        ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
+                                            ExtendEnumsWithSelectionField(EigenLinearEquationSolverMethod, SparseLU, Bicgstab, DGmres, Gmres)
+                                                ExtendEnumsWithSelectionField(EigenLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
 }
 }  // namespace storm
 
@@ -102,21 +102,16 @@ SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(sto
     // Set up local variables.
     storm::dd::Add<DdType, ValueType> localX = x;
     uint64_t iterations = 0;
+    bool minimize = dir == storm::solver::OptimizationDirection::Minimize;
+    storm::dd::Add<DdType, ValueType> offset = minimize ? b + illegalMaskAdd : b;
 
     // Value iteration loop.
     SolverStatus status = SolverStatus::InProgress;
     while (status == SolverStatus::InProgress && iterations < maximalIterations) {
-        // Compute tmp = A * x + b
+        // Compute tmp = min/max(A * x + b) in one fused operation.
         storm::dd::Add<DdType, ValueType> localXAsColumn = localX.swapVariables(this->rowColumnMetaVariablePairs);
-        storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(localXAsColumn, this->columnMetaVariables);
-        tmp += b;
-
-        if (dir == storm::solver::OptimizationDirection::Minimize) {
-            tmp += illegalMaskAdd;
-            tmp = tmp.minAbstract(this->choiceVariables);
-        } else {
-            tmp = tmp.maxAbstract(this->choiceVariables);
-        }
+        storm::dd::Add<DdType, ValueType> tmp =
+            this->A.multiplyMatrixAndMinMaxAbstract(localXAsColumn, this->columnMetaVariables, offset, this->choiceVariables, minimize);
 
         // Now check if the process already converged within our precision.
         if (localX.equalModuloPrecision(tmp, precision, relativeTerminationCriterion)) {
@@ -142,15 +137,9 @@ template<storm::dd::DdType DdType, typename ValueType>
 bool SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::isSolution(OptimizationDirection dir, storm::dd::Add<DdType, ValueType> const& x,
                                                                        storm::dd::Add<DdType, ValueType> const& b) const {
     storm::dd::Add<DdType, ValueType> xAsColumn = x.swapVariables(this->rowColumnMetaVariablePairs);
-    storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(xAsColumn, this->columnMetaVariables);
-    tmp += b;
-
-    if (dir == storm::solver::OptimizationDirection::Minimize) {
-        tmp += illegalMaskAdd;
-        tmp = tmp.minAbstract(this->choiceVariables);
-    } else {
-        tmp = tmp.maxAbstract(this->choiceVariables);
-    }
+    bool minimize = dir == storm::solver::OptimizationDirection::Minimize;
+    storm::dd::Add<DdType, ValueType> tmp =
+        this->A.multiplyMatrixAndMinMaxAbstract(xAsColumn, this->columnMetaVariables, minimize ? b + illegalMaskAdd : b, this->choiceVariables, minimize);
 
     return x == tmp;
 }
@@ -477,22 +466,18 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
                                                                                                   uint_fast64_t n) const {
     storm::dd::Add<DdType, ValueType> xCopy = x;
 
+    bool minimize = dir == storm::solver::OptimizationDirection::Minimize;
+    storm::dd::Add<DdType, ValueType> offset = b != nullptr ? *b : this->A.getDdManager().template getAddZero<ValueType>();
+    if (minimize) {
+        // This is a hack and only here because of the lack of a suitable minAbstract/maxAbstract function
+        // that can properly deal with a restriction of the choices.
+        offset += illegalMaskAdd;
+    }
+
     // Perform matrix-vector multiplication while the bound is met.
     for (uint_fast64_t i = 0; i < n; ++i) {
         xCopy = xCopy.swapVariables(this->rowColumnMetaVariablePairs);
-        xCopy = this->A.multiplyMatrix(xCopy, this->columnMetaVariables);
-        if (b != nullptr) {
-            xCopy += *b;
-        }
-
-        if (dir == storm::solver::OptimizationDirection::Minimize) {
-            // This is a hack and only here because of the lack of a suitable minAbstract/maxAbstract function
-            // that can properly deal with a restriction of the choices.
-            xCopy += illegalMaskAdd;
-            xCopy = xCopy.minAbstract(this->choiceVariables);
-        } else {
-            xCopy = xCopy.maxAbstract(this->choiceVariables);
-        }
+        xCopy = this->A.multiplyMatrixAndMinMaxAbstract(xCopy, this->columnMetaVariables, offset, this->choiceVariables, minimize);
     }
 
     return xCopy;
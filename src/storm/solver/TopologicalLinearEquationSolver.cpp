@@ -6,6 +6,7 @@
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/utility/Profiling.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
@@ -102,6 +103,7 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         storm::utility::ProgressMeasurement progress("states");
         progress.setMaxCount(x.size());
         progress.startNewMeasurement(0);
+        STORM_PROFILE_SCOPE("SCCs");
         for (auto const& scc : *this->sortedSccDecomposition) {
             if (scc.size() == 1) {
                 returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
@@ -119,6 +121,7 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
                 break;
             }
         }
+        STORM_PROFILE_COUNT("SCCs", sccIndex);
     }
 
     if (!this->isCachingEnabled()) {
@@ -7,6 +7,7 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/utility/Profiling.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
@@ -105,6 +106,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
         storm::utility::ProgressMeasurement progress("states");
         progress.setMaxCount(x.size());
         progress.startNewMeasurement(0);
+        STORM_PROFILE_SCOPE("SCCs");
         for (auto const& scc : *this->sortedSccDecomposition) {
             if (scc.size() == 1) {
                 returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
@@ -134,6 +136,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
                 break;
             }
         }
+        STORM_PROFILE_COUNT("SCCs", sccIndex);
 
         // If requested, we store the scheduler for retrieval.
         if (this->isTrackSchedulerSet()) {
@@ -0,0 +1,154 @@
+#include "storm/solver/helper/PrioritizedValueIterationHelper.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/ConsecutiveUint64DynamicPriorityQueue.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+namespace detail {
+template<typename ValueType>
+struct ResidualBoundLess {
+    ResidualBoundLess(std::vector<ValueType> const& residualBounds) : residualBounds(residualBounds) {
+        // Intentionally left empty
+    }
+
+    bool operator()(uint64_t const& a, uint64_t const& b) const {
+        return residualBounds[a] < residualBounds[b];
+    }
+
+    std::vector<ValueType> const& residualBounds;
+};
+}  // namespace detail
+
+template<typename ValueType>
+PrioritizedValueIterationHelper<ValueType>::PrioritizedValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                                            std::function<bool(uint64_t, uint64_t)> const& ignore,
+                                                                            std::shared_ptr<storm::storage::SparseAdjacency const> backwardAdjacency)
+    : matrix(matrix), backwardAdjacency(std::move(backwardAdjacency)), ignoredRows(matrix.getRowCount(), false) {
+    if (!this->backwardAdjacency) {
+        if (storm::storage::SparseAdjacency::canRepresent(matrix.getRowGroupCount())) {
+            this->backwardAdjacency = std::make_shared<storm::storage::SparseAdjacency const>(storm::storage::SparseAdjacency::createBackwardAdjacency(matrix));
+        } else {
+            backwardTransitions = matrix.transpose(true);
+        }
+    }
+    if (ignore) {
+        auto const& groupIndices = matrix.getRowGroupIndices();
+        for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+            for (uint64_t row = groupIndices[group]; row < groupIndices[group + 1]; ++row) {
+                if (ignore(group, row - groupIndices[group])) {
+                    ignoredRows.set(row);
+                }
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+ValueType PrioritizedValueIterationHelper<ValueType>::computeValue(uint64_t rowGroup, std::vector<ValueType> const& operand,
+                                                                   std::vector<ValueType> const& offsets, bool minimize) const {
+    bool first = true;
+    ValueType result = storm::utility::zero<ValueType>();
+    for (uint64_t row = matrix.getRowGroupIndices()[rowGroup]; row < matrix.getRowGroupIndices()[rowGroup + 1]; ++row) {
+        if (ignoredRows.get(row)) {
+            continue;
+        }
+        ValueType rowValue = offsets[row];
+        for (auto const& entry : matrix.getRow(row)) {
+            rowValue += entry.getValue() * operand[entry.getColumn()];
+        }
+        if (first || (minimize ? rowValue < result : rowValue > result)) {
+            result = std::move(rowValue);
+            first = false;
+        }
+    }
+    STORM_LOG_ASSERT(!first, "All rows of row group " << rowGroup << " are ignored.");
+    return result;
+}
+
+template<typename ValueType>
+SolverStatus PrioritizedValueIterationHelper<ValueType>::PVI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                                                             bool relative, ValueType const& precision, storm::OptimizationDirection dir,
+                                                             std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    bool const minimize = storm::solver::minimize(dir);
+    uint64_t const numberOfRowGroups = matrix.getRowGroupCount();
+    auto isSignificant = [&relative, &precision](ValueType const& residualBound, ValueType const& value) {
+        if (relative) {
+            return residualBound > storm::utility::abs<ValueType>(precision * value);
+        } else {
+            return residualBound > precision;
+        }
+    };
+
+    // Initially, the residual bounds are the exact residuals, which requires one sweep over all row groups.
+    std::vector<ValueType> residualBounds(numberOfRowGroups);
+    for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+        residualBounds[group] = storm::utility::abs<ValueType>(computeValue(group, operand, offsets, minimize) - operand[group]);
+    }
+    ++numIterations;
+    storm::storage::ConsecutiveUint64DynamicPriorityQueue<detail::ResidualBoundLess<ValueType>> queue(numberOfRowGroups,
+                                                                                                     detail::ResidualBoundLess<ValueType>(residualBounds));
+
+    SolverStatus status{SolverStatus::InProgress};
+    uint64_t numUpdatesInIteration{0};
+    while (status == SolverStatus::InProgress) {
+        if (queue.empty()) {
+            status = SolverStatus::Converged;
+            break;
+        }
+        uint64_t const group = queue.popTop();
+        if (!isSignificant(residualBounds[group], operand[group])) {
+            if (!relative) {
+                // The popped bound is maximal, so all remaining row groups are converged as well.
+                status = SolverStatus::Converged;
+            }
+            continue;
+        }
+
+        ValueType newValue = computeValue(group, operand, offsets, minimize);
+        ValueType change = storm::utility::abs<ValueType>(newValue - operand[group]);
+        operand[group] = std::move(newValue);
+        residualBounds[group] = storm::utility::zero<ValueType>();
+        if (!storm::utility::isZero(change)) {
+            // The residual of each predecessor grows by at most the change of this value (transition probabilities are at most one).
+            auto updatePredecessor = [&](uint64_t predecessor) {
+                residualBounds[predecessor] += change;
+                if (isSignificant(residualBounds[predecessor], operand[predecessor])) {
+                    if (queue.contains(predecessor)) {
+                        queue.increase(predecessor);
+                    } else {
+                        queue.push(predecessor);
+                    }
+                }
+            };
+            if (backwardAdjacency) {
+                for (auto const predecessor : backwardAdjacency->getRow(group)) {
+                    updatePredecessor(predecessor);
+                }
+            } else {
+                for (auto const& entry : backwardTransitions->getRow(group)) {
+                    updatePredecessor(entry.getColumn());
+                }
+            }
+        }
+
+        if (++numUpdatesInIteration == numberOfRowGroups) {
+            numUpdatesInIteration = 0;
+            ++numIterations;
+            if (iterationCallback) {
+                status = iterationCallback(status);
+            }
+        }
+    }
+    if (numUpdatesInIteration > 0) {
+        ++numIterations;
+    }
+    return status;
+}
+
+template class PrioritizedValueIterationHelper<double>;
+template class PrioritizedValueIterationHelper<storm::RationalNumber>;
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseAdjacency.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Implements prioritized (asynchronous) value iteration, also known as prioritized sweeping.
+ * Instead of sweeping over all row groups, we always update the row group whose value might change the most.
+ * After an update, the predecessors of the updated row group are re-queued with an increased priority.
+ * Priorities are upper bounds on the Bellman residuals, so we terminate under the same criterion as standard value iteration.
+ */
+template<typename ValueType>
+class PrioritizedValueIterationHelper {
+   public:
+    /*!
+     * Initializes this helper.
+     * @param matrix the transition matrix. The reference must not be invalidated as long as this helper is used.
+     * @param ignore if given, rows for which this returns true (given the row group and the row index local to that group) are not considered.
+     * @param backwardAdjacency if given, the backward adjacency of the matrix (see storm::storage::SparseAdjacency::createBackwardAdjacency). Otherwise,
+     * it is computed by this helper.
+     */
+    PrioritizedValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, std::function<bool(uint64_t, uint64_t)> const& ignore = {},
+                                    std::shared_ptr<storm::storage::SparseAdjacency const> backwardAdjacency = nullptr);
+
+    /*!
+     * Performs prioritized value iteration.
+     * @param operand the initial values. Will hold the result afterwards.
+     * @param offsets the offsets that are added to each row.
+     * @param numIterations will be increased by the number of performed iterations, where one iteration corresponds to as many row group updates as
+     * there are row groups.
+     * @param iterationCallback invoked after each iteration. Can be used to abort the computation.
+     */
+    SolverStatus PVI(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative,
+                     ValueType const& precision, storm::OptimizationDirection dir,
+                     std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+   private:
+    ValueType computeValue(uint64_t rowGroup, std::vector<ValueType> const& operand, std::vector<ValueType> const& offsets, bool minimize) const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+
+    // The predecessors of each row group. Only if there are too many row groups for an adjacency, the backward transitions are used instead.
+    std::shared_ptr<storm::storage::SparseAdjacency const> backwardAdjacency;
+    std::optional<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
+
+    storm::storage::BitVector ignoredRows;
+};
+
+}  // namespace storm::solver::helper
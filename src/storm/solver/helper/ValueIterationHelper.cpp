@@ -3,6 +3,7 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/utility/Extremum.h"
+#include "storm/utility/Profiling.h"
 
 namespace storm::solver::helper {
 
@@ -75,6 +76,8 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
     }
     bool resultInAuxVector{false};
     SolverStatus status{SolverStatus::InProgress};
+    STORM_PROFILE_SCOPE("value iteration");
+    uint64_t const numIterationsBefore = numIterations;
     while (status == SolverStatus::InProgress) {
         ++numIterations;
         bool applyResult = viOperator->template applyRobust<RobustDir>(*operand1, *operand2, offsets, backend);
@@ -88,6 +91,7 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
             resultInAuxVector = !resultInAuxVector;
         }
     }
+    STORM_PROFILE_COUNT("value iteration sweeps", numIterations - numIterationsBefore);
     if (mult == MultiplicationStyle::Regular) {
         if (resultInAuxVector) {
             STORM_LOG_ASSERT(&operand == operand2, "Unexpected operand address");
@@ -149,5 +153,6 @@ template class ValueIterationHelper<storm::RationalNumber, true>;
 template class ValueIterationHelper<storm::RationalNumber, false>;
 template class ValueIterationHelper<storm::Interval, true, double>;
 template class ValueIterationHelper<storm::Interval, false, double>;
+template class ValueIterationHelper<float, false>;
 
 }  // namespace storm::solver::helper
@@ -1,16 +1,25 @@
 #include "storm/solver/helper/ValueIterationOperator.h"
 
 #include <optional>
+#include <type_traits>
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
 
 namespace storm::solver::helper {
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-template<bool Backward>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix,
+template<bool Backward, typename MatrixValueType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrix(storm::storage::SparseMatrix<MatrixValueType> const& matrix,
                                                                                     std::vector<IndexType> const* rowGroupIndices) {
+    auto convertValue = [](MatrixValueType const& value) -> ValueType {
+        if constexpr (std::is_same_v<MatrixValueType, ValueType>) {
+            return value;
+        } else {
+            return storm::utility::convertNumber<ValueType>(value);
+        }
+    };
     if constexpr (TrivialRowGrouping) {
         STORM_LOG_ASSERT(matrix.hasTrivialRowGrouping(), "Expected a matrix with trivial row grouping");
         STORM_LOG_ASSERT(rowGroupIndices == nullptr, "Row groups given, but grouping is supposed to be trivial.");
@@ -36,7 +45,7 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
                              "There is an empty row group. This is not expected.");
             for (auto rowIndex : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1])) {
                 for (auto const& entry : matrix.getRow(rowIndex)) {
-                    matrixValues.push_back(entry.getValue());
+                    matrixValues.push_back(convertValue(entry.getValue()));
                     matrixColumns.push_back(entry.getColumn());
                 }
                 matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
@@ -47,7 +56,7 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
         matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of first row
         for (auto rowIndex : indexRange<Backward>(0, numRows)) {
             for (auto const& entry : matrix.getRow(rowIndex)) {
-                matrixValues.push_back(entry.getValue());
+                matrixValues.push_back(convertValue(entry.getValue()));
                 matrixColumns.push_back(entry.getColumn());
             }
             matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
@@ -181,4 +190,18 @@ template class ValueIterationOperator<storm::RationalNumber, false>;
 template class ValueIterationOperator<storm::Interval, true, double>;
 template class ValueIterationOperator<storm::Interval, false, double>;
 
+// The single precision operator is only used as a cheap approximation of an operator with double entries (see mixed precision value iteration).
+// Since there are no single precision matrices, we only instantiate the members that do not depend on SparseMatrix<float>.
+template void ValueIterationOperator<float, false>::setMatrix<true, double>(storm::storage::SparseMatrix<double> const& matrix,
+                                                                            std::vector<IndexType> const* rowGroupIndices);
+template void ValueIterationOperator<float, false>::unsetIgnoredRows();
+template void ValueIterationOperator<float, false>::setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore);
+template std::vector<ValueIterationOperator<float, false>::IndexType> const& ValueIterationOperator<float, false>::getRowGroupIndices() const;
+template std::vector<float>& ValueIterationOperator<float, false>::allocateAuxiliaryVector(uint64_t size, std::optional<float> const& initialValue);
+template void ValueIterationOperator<float, false>::freeAuxiliaryVector();
+template bool ValueIterationOperator<float, false>::skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt,
+                                                                      std::vector<float>::const_iterator& matrixValueIt) const;
+template uint64_t ValueIterationOperator<float, false>::skipMultipleIgnoredRows(std::vector<IndexType>::const_iterator& matrixColumnIt,
+                                                                                 std::vector<float>::const_iterator& matrixValueIt) const;
+
 }  // namespace storm::solver::helper
@@ -38,12 +38,14 @@ class ValueIterationOperator {
     /*!
      * Initializes this operator with the given data
      * @tparam backwards if true, we iterate backwards starting with the largest rowgroup. This often makes in place (Gauss-Seidel) iterations more efficient
+     * @tparam MatrixValueType the type of the matrix entries. If this is not ValueType, the entries are converted (e.g. to obtain a more compact but less
+     * precise operator)
      * @param matrix the transition matrix
      * @param rowGroupIndices if given, overwrites the rowGroupIndices of the matrix. Must be nullptr if TrivialRowGrouping is true
      * @note The reference to the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
      */
-    template<bool Backward = true>
-    void setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+    template<bool Backward = true, typename MatrixValueType = ValueType>
+    void setMatrix(storm::storage::SparseMatrix<MatrixValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
 
     /*!
      * Initializes this operator with the given data for forward iterations (starting with the smallest row group
@@ -10,16 +10,23 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/utility/Profiling.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
 namespace solver {
 
 template<typename ValueType>
-NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
+NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : Multiplier<ValueType>(matrix), numberOfMultiplications(0) {
     // Intentionally left empty.
 }
 
+template<typename ValueType>
+NativeMultiplier<ValueType>::~NativeMultiplier() {
+    STORM_PROFILE_COUNT("matrix-vector multiplications", numberOfMultiplications);
+}
+
 template<typename ValueType>
 bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
     return false;
@@ -37,6 +44,7 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
         }
         target = this->cachedVector.get();
     }
+    ++numberOfMultiplications;
     if (parallelize(env)) {
         multAddParallel(x, b, *target);
     } else {
@@ -70,6 +78,7 @@ void NativeMultiplier<ValueType>::multiplyAndReduce(Environment const& env, Opti
         }
         target = this->cachedVector.get();
     }
+    ++numberOfMultiplications;
     if (parallelize(env)) {
         multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
     } else {
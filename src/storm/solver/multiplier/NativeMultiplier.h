@@ -16,7 +16,7 @@ template<typename ValueType>
 class NativeMultiplier : public Multiplier<ValueType> {
    public:
     NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
-    virtual ~NativeMultiplier() = default;
+    virtual ~NativeMultiplier();
 
     virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
                           std::vector<ValueType>& result) const override;
@@ -34,6 +34,9 @@ class NativeMultiplier : public Multiplier<ValueType> {
    private:
     bool parallelize(Environment const& env) const;
 
+    // The number of matrix-vector multiplications performed so far. They are reported to the profiler at once upon destruction.
+    mutable uint64_t numberOfMultiplications;
+
     void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
 
     void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
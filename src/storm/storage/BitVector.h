@@ -685,6 +685,7 @@ class BitVector {
 
     friend struct std::hash<storm::storage::BitVector>;
     friend struct FNV1aBitVectorHash;
+    friend class CompressedBitVector;
 
     template<typename StateType>
     friend struct Murmur3BitVectorHash;
@@ -72,6 +72,11 @@ uint64_t BitVectorHashMap<ValueType, Hash>::capacity() const {
     return 1ull << currentSize;
 }
 
+template<class ValueType, class Hash>
+std::size_t BitVectorHashMap<ValueType, Hash>::getSizeInBytes() const {
+    return sizeof(*this) + buckets.getSizeInBytes() + occupied.getSizeInBytes() + sizeof(ValueType) * values.capacity();
+}
+
 template<class ValueType, class Hash>
 void BitVectorHashMap<ValueType, Hash>::increaseSize() {
     ++currentSize;
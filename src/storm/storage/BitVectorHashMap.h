@@ -145,6 +145,13 @@ class BitVectorHashMap {
      */
     uint64_t capacity() const;
 
+    /*!
+     * Returns (an approximation of) the size of the map measured in bytes.
+     *
+     * @return The size of the map measured in bytes.
+     */
+    std::size_t getSizeInBytes() const;
+
     /*!
      * Performs a remapping of all values stored by applying the given remapping.
      *
@@ -0,0 +1,616 @@
+#include "storm/storage/CompressedBitVector.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+uint64_t const bitsPerChunk = 1ull << 16;
+uint64_t const bucketsPerChunk = bitsPerChunk >> 6;
+
+// Chunks with at most this many set bits are stored as arrays (if no sequence of intervals is smaller), as a bitmap
+// would not be smaller. Bitmaps are only turned into arrays again once half of this number is reached.
+uint64_t const maximalArraySize = 4096;
+
+template<bool Value>
+uint64_t getNextOffsetWithValue(uint64_t const* buckets, uint64_t offset) {
+    while (offset < bitsPerChunk) {
+        uint64_t bucket = Value ? buckets[offset >> 6] : ~buckets[offset >> 6];
+        bucket &= -1ull >> (offset & 63);
+        if (bucket != 0) {
+            return (offset >> 6 << 6) + __builtin_clzll(bucket);
+        }
+        offset = (offset >> 6 << 6) + 64;
+    }
+    return bitsPerChunk;
+}
+
+uint64_t getMask(uint64_t offset) {
+    return 1ull << (63 - (offset & 63));
+}
+
+void setRange(uint64_t* buckets, uint64_t first, uint64_t last) {
+    uint64_t firstMask = -1ull >> (first & 63);
+    uint64_t lastMask = -1ull << (63 - (last & 63));
+    if ((first >> 6) == (last >> 6)) {
+        buckets[first >> 6] |= firstMask & lastMask;
+    } else {
+        buckets[first >> 6] |= firstMask;
+        std::fill(buckets + (first >> 6) + 1, buckets + (last >> 6), -1ull);
+        buckets[last >> 6] |= lastMask;
+    }
+}
+}  // namespace
+
+CompressedBitVector::const_iterator::const_iterator(CompressedBitVector const& bitVector, uint64_t startIndex)
+    : bitVector(&bitVector), currentIndex(bitVector.getNextSetIndex(startIndex)) {
+    // Intentionally left empty.
+}
+
+CompressedBitVector::const_iterator& CompressedBitVector::const_iterator::operator++() {
+    currentIndex = bitVector->getNextSetIndex(currentIndex + 1);
+    return *this;
+}
+
+uint64_t CompressedBitVector::const_iterator::operator*() const {
+    return currentIndex;
+}
+
+bool CompressedBitVector::const_iterator::operator!=(const_iterator const& other) const {
+    return currentIndex != other.currentIndex;
+}
+
+bool CompressedBitVector::const_iterator::operator==(const_iterator const& other) const {
+    return currentIndex == other.currentIndex;
+}
+
+CompressedBitVector::CompressedBitVector() : bitCount(0) {
+    // Intentionally left empty.
+}
+
+CompressedBitVector::CompressedBitVector(uint64_t length) : bitCount(length) {
+    // Intentionally left empty.
+}
+
+CompressedBitVector::CompressedBitVector(BitVector const& bitVector) : bitCount(bitVector.size()) {
+    uint64_t const bucketCount = bitVector.bucketCount();
+    std::vector<uint64_t> lastChunk;
+    for (uint64_t key = 0; key * bucketsPerChunk < bucketCount; ++key) {
+        uint64_t const* chunk = bitVector.buckets + key * bucketsPerChunk;
+        if (bucketCount - key * bucketsPerChunk < bucketsPerChunk) {
+            // The last chunk may be incomplete, so we pad it with zeros.
+            lastChunk.resize(bucketsPerChunk);
+            std::copy_n(chunk, bucketCount - key * bucketsPerChunk, lastChunk.begin());
+            chunk = lastChunk.data();
+        }
+        Container container = createContainer(chunk);
+        if (container.numberOfSetBits > 0) {
+            keys.push_back(key);
+            containers.push_back(std::move(container));
+        }
+    }
+}
+
+BitVector CompressedBitVector::toBitVector() const {
+    BitVector result(bitCount);
+    uint64_t const bucketCount = result.bucketCount();
+    std::vector<uint64_t> lastChunk;
+    for (uint64_t position = 0; position < keys.size(); ++position) {
+        uint64_t firstBucket = keys[position] * bucketsPerChunk;
+        if (bucketCount - firstBucket < bucketsPerChunk) {
+            // As no bit beyond the size is set, only the buckets that exist in the result are non-zero.
+            getBuckets(containers[position], lastChunk);
+            std::copy(lastChunk.begin(), lastChunk.begin() + (bucketCount - firstBucket), result.buckets + firstBucket);
+        } else {
+            addToBuckets(containers[position], result.buckets + firstBucket);
+        }
+    }
+    return result;
+}
+
+bool CompressedBitVector::operator==(CompressedBitVector const& other) const {
+    if (bitCount != other.bitCount || keys != other.keys) {
+        return false;
+    }
+    std::vector<uint64_t> buckets;
+    std::vector<uint64_t> otherBuckets;
+    for (uint64_t position = 0; position < keys.size(); ++position) {
+        Container const& container = containers[position];
+        Container const& otherContainer = other.containers[position];
+        if (container.numberOfSetBits != otherContainer.numberOfSetBits) {
+            return false;
+        }
+        if (container.type == otherContainer.type) {
+            // Arrays and (maximal) intervals are unique representations.
+            if (container.offsets != otherContainer.offsets || container.buckets != otherContainer.buckets) {
+                return false;
+            }
+        } else {
+            getBuckets(container, buckets);
+            getBuckets(otherContainer, otherBuckets);
+            if (buckets != otherBuckets) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool CompressedBitVector::operator!=(CompressedBitVector const& other) const {
+    return !(*this == other);
+}
+
+void CompressedBitVector::set(uint64_t index, bool value) {
+    STORM_LOG_ASSERT(index < bitCount, "Invalid call to CompressedBitVector::set: write index " << index << " out of bounds.");
+    uint64_t const key = index / bitsPerChunk;
+    uint64_t const offset = index % bitsPerChunk;
+    uint64_t const position = findChunk(key);
+    if (position == keys.size() || keys[position] != key) {
+        if (value) {
+            Container container;
+            container.type = ContainerType::Array;
+            container.numberOfSetBits = 1;
+            container.offsets.push_back(offset);
+            keys.insert(keys.begin() + position, key);
+            containers.insert(containers.begin() + position, std::move(container));
+        }
+        return;
+    }
+
+    Container& container = containers[position];
+    if (getBit(container, offset) == value) {
+        return;
+    }
+    switch (container.type) {
+        case ContainerType::Array: {
+            auto offsetIt = std::lower_bound(container.offsets.begin(), container.offsets.end(), offset);
+            if (!value) {
+                container.offsets.erase(offsetIt);
+                --container.numberOfSetBits;
+            } else if (container.numberOfSetBits < maximalArraySize) {
+                container.offsets.insert(offsetIt, offset);
+                ++container.numberOfSetBits;
+            } else {
+                getBuckets(container, container.buckets);
+                container.buckets[offset >> 6] |= getMask(offset);
+                container.offsets = std::vector<uint16_t>();
+                container.type = ContainerType::Bitmap;
+                ++container.numberOfSetBits;
+            }
+            break;
+        }
+        case ContainerType::Bitmap:
+            if (value) {
+                container.buckets[offset >> 6] |= getMask(offset);
+                ++container.numberOfSetBits;
+            } else {
+                container.buckets[offset >> 6] &= ~getMask(offset);
+                --container.numberOfSetBits;
+                if (container.numberOfSetBits <= maximalArraySize / 2) {
+                    container = createContainer(container.buckets.data());
+                }
+            }
+            break;
+        case ContainerType::Runs: {
+            // Find the first interval that starts after the offset. As the bit changes, the offset is contained in the preceding interval iff
+            // the bit is currently set.
+            uint64_t interval = 0;
+            for (uint64_t count = container.offsets.size() / 2; count > 0;) {
+                uint64_t step = count / 2;
+                if (container.offsets[2 * (interval + step)] <= offset) {
+                    interval += step + 1;
+                    count -= step + 1;
+                } else {
+                    count = step;
+                }
+            }
+            if (value) {
+                bool extendsPrevious = interval > 0 && container.offsets[2 * interval - 1] + 1ull == offset;
+                bool extendsNext = 2 * interval < container.offsets.size() && container.offsets[2 * interval] == offset + 1;
+                if (extendsPrevious && extendsNext) {
+                    container.offsets[2 * interval - 1] = container.offsets[2 * interval + 1];
+                    container.offsets.erase(container.offsets.begin() + 2 * interval, container.offsets.begin() + 2 * interval + 2);
+                } else if (extendsPrevious) {
+                    container.offsets[2 * interval - 1] = offset;
+                } else if (extendsNext) {
+                    container.offsets[2 * interval] = offset;
+                } else {
+                    container.offsets.insert(container.offsets.begin() + 2 * interval, {static_cast<uint16_t>(offset), static_cast<uint16_t>(offset)});
+                }
+                ++container.numberOfSetBits;
+            } else {
+                uint16_t& first = container.offsets[2 * interval - 2];
+                uint16_t& last = container.offsets[2 * interval - 1];
+                if (first == last) {
+                    container.offsets.erase(container.offsets.begin() + 2 * interval - 2, container.offsets.begin() + 2 * interval);
+                } else if (first == offset) {
+                    ++first;
+                } else if (last == offset) {
+                    --last;
+                } else {
+                    // Split the interval.
+                    uint16_t const oldLast = last;
+                    last = offset - 1;
+                    container.offsets.insert(container.offsets.begin() + 2 * interval, {static_cast<uint16_t>(offset + 1), oldLast});
+                }
+                --container.numberOfSetBits;
+            }
+            // Switch to another representation once the intervals are no longer the smallest one.
+            if (container.numberOfSetBits > 0 && container.offsets.size() >= std::min<uint64_t>(container.numberOfSetBits, 4 * bucketsPerChunk)) {
+                std::vector<uint64_t> buckets;
+                getBuckets(container, buckets);
+                container = createContainer(buckets.data());
+            }
+            break;
+        }
+    }
+
+    if (container.numberOfSetBits == 0) {
+        keys.erase(keys.begin() + position);
+        containers.erase(containers.begin() + position);
+    }
+}
+
+bool CompressedBitVector::get(uint64_t index) const {
+    STORM_LOG_ASSERT(index < bitCount, "Invalid call to CompressedBitVector::get: read index " << index << " out of bounds.");
+    uint64_t const key = index / bitsPerChunk;
+    uint64_t const position = findChunk(key);
+    return position < keys.size() && keys[position] == key && getBit(containers[position], index % bitsPerChunk);
+}
+
+CompressedBitVector CompressedBitVector::operator&(CompressedBitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    CompressedBitVector result(bitCount);
+    std::vector<uint64_t> buckets;
+    std::vector<uint64_t> otherBuckets;
+    uint64_t otherPosition = 0;
+    for (uint64_t position = 0; position < keys.size(); ++position) {
+        while (otherPosition < other.keys.size() && other.keys[otherPosition] < keys[position]) {
+            ++otherPosition;
+        }
+        if (otherPosition == other.keys.size()) {
+            break;
+        }
+        if (other.keys[otherPosition] != keys[position]) {
+            continue;
+        }
+
+        Container const& container = containers[position];
+        Container const& otherContainer = other.containers[otherPosition];
+        Container resultContainer;
+        if (container.type == ContainerType::Array || otherContainer.type == ContainerType::Array) {
+            // Keep the entries of the array that are also contained in the other container.
+            Container const& array = container.type == ContainerType::Array ? container : otherContainer;
+            Container const& filter = container.type == ContainerType::Array ? otherContainer : container;
+            resultContainer.type = ContainerType::Array;
+            std::copy_if(array.offsets.begin(), array.offsets.end(), std::back_inserter(resultContainer.offsets),
+                         [&filter](uint16_t offset) { return getBit(filter, offset); });
+            resultContainer.numberOfSetBits = resultContainer.offsets.size();
+        } else {
+            getBuckets(container, buckets);
+            getBuckets(otherContainer, otherBuckets);
+            for (uint64_t bucket = 0; bucket < bucketsPerChunk; ++bucket) {
+                buckets[bucket] &= otherBuckets[bucket];
+            }
+            resultContainer = createContainer(buckets.data());
+        }
+        if (resultContainer.numberOfSetBits > 0) {
+            result.keys.push_back(keys[position]);
+            result.containers.push_back(std::move(resultContainer));
+        }
+    }
+    return result;
+}
+
+CompressedBitVector CompressedBitVector::operator|(CompressedBitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    CompressedBitVector result(bitCount);
+    std::vector<uint64_t> buckets;
+    std::vector<uint64_t> otherBuckets;
+    uint64_t position = 0;
+    uint64_t otherPosition = 0;
+    while (position < keys.size() || otherPosition < other.keys.size()) {
+        if (otherPosition == other.keys.size() || (position < keys.size() && keys[position] < other.keys[otherPosition])) {
+            result.keys.push_back(keys[position]);
+            result.containers.push_back(containers[position]);
+            ++position;
+        } else if (position == keys.size() || other.keys[otherPosition] < keys[position]) {
+            result.keys.push_back(other.keys[otherPosition]);
+            result.containers.push_back(other.containers[otherPosition]);
+            ++otherPosition;
+        } else {
+            Container const& container = containers[position];
+            Container const& otherContainer = other.containers[otherPosition];
+            Container resultContainer;
+            if (container.type == ContainerType::Array && otherContainer.type == ContainerType::Array &&
+                container.numberOfSetBits + otherContainer.numberOfSetBits <= maximalArraySize) {
+                resultContainer.type = ContainerType::Array;
+                std::set_union(container.offsets.begin(), container.offsets.end(), otherContainer.offsets.begin(), otherContainer.offsets.end(),
+                               std::back_inserter(resultContainer.offsets));
+                resultContainer.numberOfSetBits = resultContainer.offsets.size();
+            } else {
+                getBuckets(container, buckets);
+                addToBuckets(otherContainer, buckets.data());
+                resultContainer = createContainer(buckets.data());
+            }
+            result.keys.push_back(keys[position]);
+            result.containers.push_back(std::move(resultContainer));
+            ++position;
+            ++otherPosition;
+        }
+    }
+    return result;
+}
+
+CompressedBitVector CompressedBitVector::operator~() const {
+    CompressedBitVector result(bitCount);
+    std::vector<uint64_t> buckets;
+    uint64_t position = 0;
+    for (uint64_t key = 0; key * bitsPerChunk < bitCount; ++key) {
+        uint64_t const bitsInChunk = std::min(bitsPerChunk, bitCount - key * bitsPerChunk);
+        Container resultContainer;
+        if (position < keys.size() && keys[position] == key) {
+            getBuckets(containers[position], buckets);
+            for (auto& bucket : buckets) {
+                bucket = ~bucket;
+            }
+            // Clear the bits beyond the end of the bit vector.
+            if (bitsInChunk < bitsPerChunk) {
+                if (bitsInChunk % 64 != 0) {
+                    buckets[bitsInChunk >> 6] &= ~(-1ull >> (bitsInChunk & 63));
+                }
+                std::fill(buckets.begin() + (bitsInChunk + 63) / 64, buckets.end(), 0ull);
+            }
+            resultContainer = createContainer(buckets.data());
+            ++position;
+        } else {
+            resultContainer.type = ContainerType::Runs;
+            resultContainer.numberOfSetBits = bitsInChunk;
+            resultContainer.offsets = {0, static_cast<uint16_t>(bitsInChunk - 1)};
+        }
+        if (resultContainer.numberOfSetBits > 0) {
+            result.keys.push_back(key);
+            result.containers.push_back(std::move(resultContainer));
+        }
+    }
+    return result;
+}
+
+bool CompressedBitVector::isSubsetOf(CompressedBitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    std::vector<uint64_t> buckets;
+    std::vector<uint64_t> otherBuckets;
+    uint64_t otherPosition = 0;
+    for (uint64_t position = 0; position < keys.size(); ++position) {
+        while (otherPosition < other.keys.size() && other.keys[otherPosition] < keys[position]) {
+            ++otherPosition;
+        }
+        if (otherPosition == other.keys.size() || other.keys[otherPosition] != keys[position]) {
+            return false;
+        }
+        Container const& container = containers[position];
+        Container const& otherContainer = other.containers[otherPosition];
+        if (container.numberOfSetBits > otherContainer.numberOfSetBits) {
+            return false;
+        }
+        if (container.type == ContainerType::Array) {
+            for (auto offset : container.offsets) {
+                if (!getBit(otherContainer, offset)) {
+                    return false;
+                }
+            }
+        } else {
+            getBuckets(container, buckets);
+            getBuckets(otherContainer, otherBuckets);
+            for (uint64_t bucket = 0; bucket < bucketsPerChunk; ++bucket) {
+                if ((buckets[bucket] & ~otherBuckets[bucket]) != 0) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool CompressedBitVector::isDisjointFrom(CompressedBitVector const& other) const {
+    STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
+    std::vector<uint64_t> buckets;
+    std::vector<uint64_t> otherBuckets;
+    uint64_t otherPosition = 0;
+    for (uint64_t position = 0; position < keys.size(); ++position) {
+        while (otherPosition < other.keys.size() && other.keys[otherPosition] < keys[position]) {
+            ++otherPosition;
+        }
+        if (otherPosition == other.keys.size()) {
+            break;
+        }
+        if (other.keys[otherPosition] != keys[position]) {
+            continue;
+        }
+        Container const& container = containers[position];
+        Container const& otherContainer = other.containers[otherPosition];
+        if (container.type == ContainerType::Array || otherContainer.type == ContainerType::Array) {
+            Container const& array = container.type == ContainerType::Array ? container : otherContainer;
+            Container const& filter = container.type == ContainerType::Array ? otherContainer : container;
+            for (auto offset : array.offsets) {
+                if (getBit(filter, offset)) {
+                    return false;
+                }
+            }
+        } else {
+            getBuckets(container, buckets);
+            getBuckets(otherContainer, otherBuckets);
+            for (uint64_t bucket = 0; bucket < bucketsPerChunk; ++bucket) {
+                if ((buckets[bucket] & otherBuckets[bucket]) != 0) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool CompressedBitVector::empty() const {
+    return containers.empty();
+}
+
+bool CompressedBitVector::full() const {
+    return getNumberOfSetBits() == bitCount;
+}
+
+uint64_t CompressedBitVector::getNumberOfSetBits() const {
+    uint64_t result = 0;
+    for (auto const& container : containers) {
+        result += container.numberOfSetBits;
+    }
+    return result;
+}
+
+uint64_t CompressedBitVector::size() const {
+    return bitCount;
+}
+
+std::size_t CompressedBitVector::getSizeInBytes() const {
+    std::size_t result = sizeof(*this) + keys.capacity() * sizeof(uint64_t) + containers.capacity() * sizeof(Container);
+    for (auto const& container : containers) {
+        result += container.offsets.capacity() * sizeof(uint16_t) + container.buckets.capacity() * sizeof(uint64_t);
+    }
+    return result;
+}
+
+uint64_t CompressedBitVector::getNextSetIndex(uint64_t startingIndex) const {
+    if (startingIndex >= bitCount) {
+        return bitCount;
+    }
+    uint64_t const key = startingIndex / bitsPerChunk;
+    for (uint64_t position = findChunk(key); position < keys.size(); ++position) {
+        uint64_t offset = getNextSetOffset(containers[position], keys[position] == key ? startingIndex % bitsPerChunk : 0);
+        if (offset < bitsPerChunk) {
+            return keys[position] * bitsPerChunk + offset;
+        }
+    }
+    return bitCount;
+}
+
+CompressedBitVector::const_iterator CompressedBitVector::begin() const {
+    return const_iterator(*this, 0);
+}
+
+CompressedBitVector::const_iterator CompressedBitVector::end() const {
+    return const_iterator(*this, bitCount);
+}
+
+CompressedBitVector::Container CompressedBitVector::createContainer(uint64_t const* buckets) {
+    Container result;
+    result.type = ContainerType::Array;
+    result.numberOfSetBits = 0;
+    uint64_t numberOfIntervals = 0;
+    uint64_t previousBit = 0;
+    for (uint64_t bucket = 0; bucket < bucketsPerChunk; ++bucket) {
+        result.numberOfSetBits += __builtin_popcountll(buckets[bucket]);
+        // An interval starts at every set bit whose predecessor is not set.
+        numberOfIntervals += __builtin_popcountll(buckets[bucket] & ~((buckets[bucket] >> 1) | (previousBit << 63)));
+        previousBit = buckets[bucket] & 1ull;
+    }
+    if (result.numberOfSetBits == 0) {
+        return result;
+    }
+
+    // Pick the smallest representation, where the size is measured in 16-bit words.
+    if (2 * numberOfIntervals < std::min<uint64_t>(result.numberOfSetBits, 4 * bucketsPerChunk)) {
+        result.type = ContainerType::Runs;
+        result.offsets.reserve(2 * numberOfIntervals);
+        for (uint64_t first = getNextOffsetWithValue<true>(buckets, 0); first < bitsPerChunk;) {
+            uint64_t end = getNextOffsetWithValue<false>(buckets, first);
+            result.offsets.push_back(first);
+            result.offsets.push_back(end - 1);
+            first = getNextOffsetWithValue<true>(buckets, end);
+        }
+    } else if (result.numberOfSetBits <= maximalArraySize) {
+        result.offsets.reserve(result.numberOfSetBits);
+        for (uint64_t offset = getNextOffsetWithValue<true>(buckets, 0); offset < bitsPerChunk; offset = getNextOffsetWithValue<true>(buckets, offset + 1)) {
+            result.offsets.push_back(offset);
+        }
+    } else {
+        result.type = ContainerType::Bitmap;
+        result.buckets.assign(buckets, buckets + bucketsPerChunk);
+    }
+    return result;
+}
+
+void CompressedBitVector::addToBuckets(Container const& container, uint64_t* buckets) {
+    switch (container.type) {
+        case ContainerType::Array:
+            for (auto offset : container.offsets) {
+                buckets[offset >> 6] |= getMask(offset);
+            }
+            break;
+        case ContainerType::Runs:
+            for (uint64_t interval = 0; interval < container.offsets.size(); interval += 2) {
+                setRange(buckets, container.offsets[interval], container.offsets[interval + 1]);
+            }
+            break;
+        case ContainerType::Bitmap:
+            for (uint64_t bucket = 0; bucket < bucketsPerChunk; ++bucket) {
+                buckets[bucket] |= container.buckets[bucket];
+            }
+            break;
+    }
+}
+
+void CompressedBitVector::getBuckets(Container const& container, std::vector<uint64_t>& buckets) {
+    buckets.assign(bucketsPerChunk, 0ull);
+    addToBuckets(container, buckets.data());
+}
+
+uint64_t CompressedBitVector::getNextSetOffset(Container const& container, uint64_t offset) {
+    switch (container.type) {
+        case ContainerType::Array: {
+            auto offsetIt = std::lower_bound(container.offsets.begin(), container.offsets.end(), offset);
+            return offsetIt == container.offsets.end() ? bitsPerChunk : *offsetIt;
+        }
+        case ContainerType::Runs: {
+            // Search for the first interval whose last bit is not before the given offset.
+            uint64_t lower = 0;
+            uint64_t upper = container.offsets.size() / 2;
+            while (lower < upper) {
+                uint64_t middle = (lower + upper) / 2;
+                if (container.offsets[2 * middle + 1] < offset) {
+                    lower = middle + 1;
+                } else {
+                    upper = middle;
+                }
+            }
+            return 2 * lower == container.offsets.size() ? bitsPerChunk : std::max<uint64_t>(container.offsets[2 * lower], offset);
+        }
+        case ContainerType::Bitmap:
+            return getNextOffsetWithValue<true>(container.buckets.data(), offset);
+    }
+    return bitsPerChunk;
+}
+
+bool CompressedBitVector::getBit(Container const& container, uint64_t offset) {
+    if (container.type == ContainerType::Bitmap) {
+        return (container.buckets[offset >> 6] & getMask(offset)) != 0;
+    }
+    return getNextSetOffset(container, offset) == offset;
+}
+
+uint64_t CompressedBitVector::findChunk(uint64_t key) const {
+    return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+}
+
+std::ostream& operator<<(std::ostream& out, CompressedBitVector const& bitVector) {
+    out << "compressed bit vector(" << bitVector.getNumberOfSetBits() << "/" << bitVector.size() << ") [";
+    for (auto index : bitVector) {
+        out << index << " ";
+    }
+    out << "]";
+    return out;
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A compressed bit vector for sets that are sparse or consist of few long intervals. The bits are split into chunks of
+ * 2^16 bits. Chunks without set bits are not stored at all, all other chunks are stored as a sorted array of the set bits,
+ * as a sequence of intervals of set bits or as a plain bitmap, depending on which of these representations is smallest.
+ */
+class CompressedBitVector {
+   public:
+    /*!
+     * A class that enables iterating over the indices of the set bits in ascending order.
+     */
+    class const_iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = uint64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = uint64_t*;
+        using reference = uint64_t&;
+
+        /*!
+         * Constructs an iterator that points to the first set bit with index at least the given one.
+         *
+         * @param bitVector The underlying bit vector.
+         * @param startIndex The index where to begin looking for set bits.
+         */
+        const_iterator(CompressedBitVector const& bitVector, uint64_t startIndex);
+
+        const_iterator& operator++();
+        uint64_t operator*() const;
+        bool operator!=(const_iterator const& other) const;
+        bool operator==(const_iterator const& other) const;
+
+       private:
+        // The underlying bit vector of this iterator.
+        CompressedBitVector const* bitVector;
+
+        // The index of the bit this iterator currently points to.
+        uint64_t currentIndex;
+    };
+
+    /*!
+     * Constructs an empty compressed bit vector of length 0.
+     */
+    CompressedBitVector();
+
+    /*!
+     * Constructs a compressed bit vector of the given length in which no bit is set.
+     *
+     * @param length The number of bits of the bit vector.
+     */
+    explicit CompressedBitVector(uint64_t length);
+
+    /*!
+     * Constructs a compressed bit vector that represents the same bits as the given bit vector.
+     *
+     * @param bitVector The bit vector to compress.
+     */
+    explicit CompressedBitVector(BitVector const& bitVector);
+
+    /*!
+     * Retrieves the (uncompressed) bit vector that represents the same bits.
+     */
+    BitVector toBitVector() const;
+
+    /*!
+     * Compares the given bit vector with the current one. Two bit vectors are equal if they have the same length and the
+     * same bits are set, independent of how their chunks are represented.
+     */
+    bool operator==(CompressedBitVector const& other) const;
+    bool operator!=(CompressedBitVector const& other) const;
+
+    /*!
+     * Sets the given truth value at the given index.
+     *
+     * @param index The index where to set the truth value.
+     * @param value The truth value to set.
+     */
+    void set(uint64_t index, bool value = true);
+
+    /*!
+     * Retrieves the truth value of the bit at the given index.
+     *
+     * @param index The index of the bit to access.
+     * @return True iff the bit at the given index is set.
+     */
+    bool get(uint64_t index) const;
+
+    /*!
+     * Performs a logical "and", "or" and "not", respectively. The bit vectors of binary operations need to have the
+     * same length.
+     */
+    CompressedBitVector operator&(CompressedBitVector const& other) const;
+    CompressedBitVector operator|(CompressedBitVector const& other) const;
+    CompressedBitVector operator~() const;
+
+    /*!
+     * Checks whether all bits that are set in the current bit vector are also set in the given one.
+     */
+    bool isSubsetOf(CompressedBitVector const& other) const;
+
+    /*!
+     * Checks whether none of the bits that are set in the current bit vector are also set in the given one.
+     */
+    bool isDisjointFrom(CompressedBitVector const& other) const;
+
+    /*!
+     * Retrieves whether no bit is set.
+     */
+    bool empty() const;
+
+    /*!
+     * Retrieves whether all bits are set.
+     */
+    bool full() const;
+
+    /*!
+     * Retrieves the number of set bits.
+     */
+    uint64_t getNumberOfSetBits() const;
+
+    /*!
+     * Retrieves the number of bits of this bit vector.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Returns (an approximation of) the size of the bit vector measured in bytes.
+     */
+    std::size_t getSizeInBytes() const;
+
+    /*!
+     * Retrieves the index of the first set bit whose index is at least the given one, or the size of the bit vector if
+     * there is no such bit.
+     *
+     * @param startingIndex The index at which to start the search.
+     */
+    uint64_t getNextSetIndex(uint64_t startingIndex) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    friend std::ostream& operator<<(std::ostream& out, CompressedBitVector const& bitVector);
+
+   private:
+    enum class ContainerType : uint8_t { Array, Runs, Bitmap };
+
+    /*!
+     * The set bits of a single chunk. Offsets are relative to the first bit of the chunk.
+     */
+    struct Container {
+        ContainerType type;
+
+        // The number of set bits of the chunk, which is never zero.
+        uint32_t numberOfSetBits;
+
+        // For arrays, the sorted offsets of the set bits. For runs, the offsets of the first and last bit of each interval.
+        std::vector<uint16_t> offsets;
+
+        // For bitmaps, the buckets of the chunk, laid out as in a BitVector.
+        std::vector<uint64_t> buckets;
+    };
+
+    /*!
+     * Creates the smallest container for the given buckets of a chunk or a container without set bits if all buckets
+     * are zero.
+     */
+    static Container createContainer(uint64_t const* buckets);
+
+    /*!
+     * Sets the bits of the given container in the given buckets of a chunk.
+     */
+    static void addToBuckets(Container const& container, uint64_t* buckets);
+
+    /*!
+     * Overwrites the given buckets (of the size of a chunk) with the bits of the given container.
+     */
+    static void getBuckets(Container const& container, std::vector<uint64_t>& buckets);
+
+    /*!
+     * Retrieves the first offset of a set bit of the container that is at least the given offset, or the number of bits
+     * of a chunk if there is no such bit.
+     */
+    static uint64_t getNextSetOffset(Container const& container, uint64_t offset);
+
+    static bool getBit(Container const& container, uint64_t offset);
+
+    /*!
+     * Retrieves the position of the first chunk whose key is at least the given one.
+     */
+    uint64_t findChunk(uint64_t key) const;
+
+    // The number of bits of this bit vector.
+    uint64_t bitCount;
+
+    // The keys (i.e. the indices of the chunks) of all stored chunks in ascending order and their containers.
+    std::vector<uint64_t> keys;
+    std::vector<Container> containers;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <vector>
 
@@ -66,11 +67,15 @@ class ConsecutiveUint64DynamicPriorityQueue {
     }
 
     void push(uint64_t const& item) {
+        STORM_LOG_ASSERT(!contains(item), "Element " << item << " is already contained in the queue.");
+        positions[item] = container.size();
         container.emplace_back(item);
-        std::push_heap(container.begin(), container.end(), compare);
+        increase(item);
     }
 
     void pop() {
+        // Remember the popped element so that it is no longer considered to be contained, even if the queue grows again.
+        T item = container.front();
         if (container.size() > 1) {
             // Swap max element to back.
             std::swap(positions[container.front()], positions[container.back()]);
@@ -110,6 +115,7 @@ class ConsecutiveUint64DynamicPriorityQueue {
         } else {
             container.pop_back();
         }
+        positions[item] = std::numeric_limits<uint64_t>::max();
 
         STORM_LOG_ASSERT(std::is_heap(container.begin(), container.end(), compare), "Heap structure lost.");
     }
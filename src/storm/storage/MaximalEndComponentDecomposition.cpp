@@ -20,7 +20,8 @@ template<typename ValueType>
 template<typename RewardModelType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(
     storm::models::sparse::NondeterministicModel<ValueType, RewardModelType> const& model) {
-    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions());
+    model.applyToBackwardTransitions(
+        [&](auto const& backwardTransitions) { this->performMaximalEndComponentDecomposition(model.getTransitionMatrix(), backwardTransitions); });
 }
 
 template<typename ValueType>
@@ -44,10 +45,32 @@ MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(st
     performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states, choices);
 }
 
+template<typename ValueType>
+MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                              storm::storage::SparseAdjacency const& backwardTransitions) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions);
+}
+
+template<typename ValueType>
+MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                              storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                              storm::storage::BitVector const& states) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states);
+}
+
+template<typename ValueType>
+MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                              storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                              storm::storage::BitVector const& states,
+                                                                              storm::storage::BitVector const& choices) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states, choices);
+}
+
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType> const& model,
                                                                               storm::storage::BitVector const& states) {
-    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions(), states);
+    model.applyToBackwardTransitions(
+        [&](auto const& backwardTransitions) { this->performMaximalEndComponentDecomposition(model.getTransitionMatrix(), backwardTransitions, states); });
 }
 
 template<typename ValueType>
@@ -107,8 +130,9 @@ std::string MaximalEndComponentDecomposition<ValueType>::statistics(uint64_t tot
 }
 
 template<typename ValueType>
+template<typename BackwardTransitionsType>
 void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                          storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                          BackwardTransitionsType const& backwardTransitions,
                                                                                           storm::OptionalRef<storm::storage::BitVector const> states,
                                                                                           storm::OptionalRef<storm::storage::BitVector const> choices) {
     // Get some data for convenient access.
@@ -5,6 +5,7 @@
 #include "storm/models/sparse/NondeterministicModel.h"
 #include "storm/storage/Decomposition.h"
 #include "storm/storage/MaximalEndComponent.h"
+#include "storm/storage/SparseAdjacency.h"
 #include "storm/utility/OptionalRef.h"
 
 namespace storm::storage {
@@ -62,6 +63,39 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
                                      storm::storage::BitVector const& choices);
 
+    /*
+     * Creates an MEC decomposition of the given model (represented by a row-grouped matrix) using only the structure of the reversed transition relation.
+     *
+     * @param transitionMatrix The transition relation of model to decompose into MECs.
+     * @param backwardTransition The structure of the reversed transition relation.
+     */
+    MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                     storm::storage::SparseAdjacency const& backwardTransitions);
+
+    /*
+     * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix) using only the structure of the reversed
+     * transition relation.
+     *
+     * @param transitionMatrix The transition relation of model to decompose into MECs.
+     * @param backwardTransition The structure of the reversed transition relation.
+     * @param states The states of the subsystem to decompose.
+     */
+    MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                     storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& states);
+
+    /*
+     * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix) using only the structure of the reversed
+     * transition relation.
+     *
+     * @param transitionMatrix The transition relation of model to decompose into MECs.
+     * @param backwardTransition The structure of the reversed transition relation.
+     * @param states The states of the subsystem to decompose.
+     * @param choices The choices of the subsystem to decompose.
+     */
+    MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                     storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& states,
+                                     storm::storage::BitVector const& choices);
+
     /*!
      * Creates an MEC decomposition of the given subsystem in the given model.
      *
@@ -110,13 +144,14 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * Performs the actual decomposition of the given subsystem in the given model into MECs. Stores the MECs found in the current decomposition.
      *
      * @param transitionMatrix The transition matrix representing the system whose subsystem to decompose into MECs.
-     * @param backwardTransitions The reversed transition relation.
+     * @param backwardTransitions The reversed transition relation (or its structure).
      * @param states The states of the subsystem to decompose. If not given, all states are considered.
      * @param choices The choices of the subsystem to decompose. If not given, all choices are considered.
      *
      */
+    template<typename BackwardTransitionsType>
     void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                 storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                 BackwardTransitionsType const& backwardTransitions,
                                                  storm::OptionalRef<storm::storage::BitVector const> states = storm::NullRef,
                                                  storm::OptionalRef<storm::storage::BitVector const> choices = storm::NullRef);
 };
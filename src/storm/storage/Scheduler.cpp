@@ -16,7 +16,7 @@ Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::option
     : memoryStructure(memoryStructure) {
     uint_fast64_t numOfMemoryStates = memoryStructure ? memoryStructure->getNumberOfStates() : 1;
     schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
-    dontCareStates = std::vector<storm::storage::BitVector>(numOfMemoryStates, storm::storage::BitVector(numberOfModelStates, false));
+    dontCareStates = std::vector<storm::storage::CompressedBitVector>(numOfMemoryStates, storm::storage::CompressedBitVector(numberOfModelStates));
     numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
     numOfDeterministicChoices = 0;
     numOfDontCareStates = 0;
@@ -27,7 +27,7 @@ Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::option
     : memoryStructure(std::move(memoryStructure)) {
     uint_fast64_t numOfMemoryStates = this->memoryStructure ? this->memoryStructure->getNumberOfStates() : 1;
     schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
-    dontCareStates = std::vector<storm::storage::BitVector>(numOfMemoryStates, storm::storage::BitVector(numberOfModelStates, false));
+    dontCareStates = std::vector<storm::storage::CompressedBitVector>(numOfMemoryStates, storm::storage::CompressedBitVector(numberOfModelStates));
     numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
     numOfDeterministicChoices = 0;
     numOfDontCareStates = 0;
@@ -0,0 +1,147 @@
+#include "storm/storage/SparseAdjacency.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace storage {
+
+SparseAdjacency::const_rows::const_rows(index_type const* beginIterator, index_type const* endIterator)
+    : beginIterator(beginIterator), endIterator(endIterator) {
+    // Intentionally left empty.
+}
+
+SparseAdjacency::index_type const* SparseAdjacency::const_rows::begin() const {
+    return beginIterator;
+}
+
+SparseAdjacency::index_type const* SparseAdjacency::const_rows::end() const {
+    return endIterator;
+}
+
+uint64_t SparseAdjacency::const_rows::getNumberOfEntries() const {
+    return std::distance(beginIterator, endIterator);
+}
+
+SparseAdjacency::SparseAdjacency(std::vector<uint64_t>&& rowIndications, std::vector<index_type>&& columns)
+    : rowIndications(std::move(rowIndications)), columns(std::move(columns)) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+SparseAdjacency SparseAdjacency::createBackwardAdjacency(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    uint64_t const numberOfGroups = transitionMatrix.getRowGroupCount();
+    uint64_t const numberOfRows = transitionMatrix.getColumnCount();
+    STORM_LOG_THROW(canRepresent(numberOfGroups), storm::exceptions::NotSupportedException,
+                    "Cannot represent the backward adjacency of a matrix with " << numberOfGroups << " row groups.");
+    std::vector<uint64_t> rowIndications(numberOfRows + 1);
+    std::vector<index_type> columns;
+
+    bool parallelize = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#ifdef STORM_HAVE_INTELTBB
+    if (parallelize) {
+        // Count the entries of each row with atomic counters, place the entries and restore the order within each row afterwards.
+        std::vector<std::atomic<uint64_t>> counters(numberOfRows);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfGroups), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t group = range.begin(); group < range.end(); ++group) {
+                for (auto const& entry : transitionMatrix.getRowGroup(group)) {
+                    if (entry.getValue() != storm::utility::zero<ValueType>()) {
+                        counters[entry.getColumn()].fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            rowIndications[row + 1] = rowIndications[row] + counters[row].load(std::memory_order_relaxed);
+            counters[row].store(rowIndications[row], std::memory_order_relaxed);
+        }
+        columns.resize(rowIndications.back());
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfGroups), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t group = range.begin(); group < range.end(); ++group) {
+                for (auto const& entry : transitionMatrix.getRowGroup(group)) {
+                    if (entry.getValue() != storm::utility::zero<ValueType>()) {
+                        columns[counters[entry.getColumn()].fetch_add(1, std::memory_order_relaxed)] = static_cast<index_type>(group);
+                    }
+                }
+            }
+        });
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfRows), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t row = range.begin(); row < range.end(); ++row) {
+                std::sort(columns.begin() + rowIndications[row], columns.begin() + rowIndications[row + 1]);
+            }
+        });
+    }
+#else
+    STORM_LOG_WARN_COND(!parallelize, "Parallel construction of the backward adjacency requires Intel TBB.");
+    parallelize = false;
+#endif
+    if (!parallelize) {
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            for (auto const& entry : transitionMatrix.getRowGroup(group)) {
+                if (entry.getValue() != storm::utility::zero<ValueType>()) {
+                    ++rowIndications[entry.getColumn() + 1];
+                }
+            }
+        }
+        for (uint64_t row = 1; row <= numberOfRows; ++row) {
+            rowIndications[row] += rowIndications[row - 1];
+        }
+
+        // Since the groups are processed in ascending order, the columns of each row are sorted.
+        std::vector<uint64_t> nextIndices(rowIndications.begin(), rowIndications.end() - 1);
+        columns.resize(rowIndications.back());
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            for (auto const& entry : transitionMatrix.getRowGroup(group)) {
+                if (entry.getValue() != storm::utility::zero<ValueType>()) {
+                    columns[nextIndices[entry.getColumn()]++] = static_cast<index_type>(group);
+                }
+            }
+        }
+    }
+
+    return SparseAdjacency(std::move(rowIndications), std::move(columns));
+}
+
+bool SparseAdjacency::canRepresent(uint64_t numberOfRowGroups) {
+    return numberOfRowGroups <= static_cast<uint64_t>(std::numeric_limits<index_type>::max()) + 1;
+}
+
+SparseAdjacency::const_rows SparseAdjacency::getRow(uint64_t row) const {
+    STORM_LOG_ASSERT(row < getRowCount(), "Row " << row << " is out of bounds.");
+    return const_rows(columns.data() + rowIndications[row], columns.data() + rowIndications[row + 1]);
+}
+
+uint64_t SparseAdjacency::getRowCount() const {
+    return rowIndications.empty() ? 0 : rowIndications.size() - 1;
+}
+
+uint64_t SparseAdjacency::getEntryCount() const {
+    return columns.size();
+}
+
+uint64_t SparseAdjacency::getSizeInBytes() const {
+    return sizeof(uint64_t) * rowIndications.size() + sizeof(index_type) * columns.size();
+}
+
+bool SparseAdjacency::operator==(SparseAdjacency const& other) const {
+    return rowIndications == other.rowIndications && columns == other.columns;
+}
+
+template SparseAdjacency SparseAdjacency::createBackwardAdjacency(storm::storage::SparseMatrix<double> const& transitionMatrix);
+template SparseAdjacency SparseAdjacency::createBackwardAdjacency(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix);
+template SparseAdjacency SparseAdjacency::createBackwardAdjacency(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix);
+template SparseAdjacency SparseAdjacency::createBackwardAdjacency(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix);
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+class SparseMatrix;
+
+/*!
+ * Stores the graph structure of a sparse matrix without its values, i.e. for each row the columns of its (non-zero) entries. Columns are stored with 32 bits,
+ * so this is considerably smaller than a sparse matrix and suffices for graph algorithms that only search the matrix.
+ */
+class SparseAdjacency {
+   public:
+    typedef uint32_t index_type;
+
+    /*!
+     * Creates an empty adjacency.
+     */
+    SparseAdjacency() = default;
+
+    /*!
+     * A range over the columns of a row.
+     */
+    class const_rows {
+       public:
+        const_rows(index_type const* beginIterator, index_type const* endIterator);
+
+        index_type const* begin() const;
+        index_type const* end() const;
+        uint64_t getNumberOfEntries() const;
+
+       private:
+        index_type const* beginIterator;
+        index_type const* endIterator;
+    };
+
+    /*!
+     * Creates the backward adjacency of the given transition matrix, i.e. the structure of transitionMatrix.transpose(true). Row i contains the row groups
+     * (states) that have a choice with a non-zero entry in column i. If a state has several such choices, it occurs several times. The columns of each row
+     * are sorted. If parallelization with Intel TBB is enabled, the counting sort is performed in parallel.
+     *
+     * @param transitionMatrix The transition matrix whose backward adjacency to create. The number of row groups must be representable with 32 bits.
+     */
+    template<typename ValueType>
+    static SparseAdjacency createBackwardAdjacency(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Retrieves whether the backward adjacency of a matrix with the given number of row groups can be represented.
+     */
+    static bool canRepresent(uint64_t numberOfRowGroups);
+
+    /*!
+     * Retrieves the columns of the given row.
+     */
+    const_rows getRow(uint64_t row) const;
+
+    uint64_t getRowCount() const;
+    uint64_t getEntryCount() const;
+
+    /*!
+     * Retrieves the (approximate) number of bytes occupied by this adjacency.
+     */
+    uint64_t getSizeInBytes() const;
+
+    bool operator==(SparseAdjacency const& other) const;
+
+   private:
+    SparseAdjacency(std::vector<uint64_t>&& rowIndications, std::vector<index_type>&& columns);
+
+    // The i-th entry holds the index of the first column of row i. The last entry holds the number of entries.
+    std::vector<uint64_t> rowIndications;
+
+    // The columns of all rows.
+    std::vector<index_type> columns;
+};
+
+}  // namespace storage
+}  // namespace storm
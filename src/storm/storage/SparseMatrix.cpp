@@ -6,6 +6,7 @@
 
 #include "storm/storage/BitVector.h"
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/Profiling.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/permutation.h"
 #include "storm/utility/vector.h"
@@ -16,13 +17,28 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/macros.h"
 
+#include <atomic>
 #include <iterator>
 
 namespace storm {
 namespace storage {
 
+#ifdef STORM_HAVE_INTELTBB
+namespace {
+// Matrices with fewer entries are transformed sequentially as the overhead of the parallelization would dominate.
+uint64_t const minimalEntryCountForParallelization = 1ull << 16;
+
+bool useParallelConstruction(uint64_t entryCount) {
+    return entryCount >= minimalEntryCountForParallelization && storm::settings::hasModule<storm::settings::modules::CoreSettings>() &&
+           storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+}
+}  // namespace
+#endif
+
 template<typename IndexType, typename ValueType>
 MatrixEntry<IndexType, ValueType>::MatrixEntry(IndexType column, ValueType value) : entry(column, value) {
     // Intentionally left empty.
@@ -349,6 +365,8 @@ SparseMatrix<ValueType> SparseMatrixBuilder<ValueType>::build(index_type overrid
         }
     }
 
+    STORM_PROFILE_COUNT("bytes allocated (sparse matrices)", columnsAndValues.capacity() * sizeof(MatrixEntry<index_type, ValueType>) +
+                                                                  (rowIndications.capacity() + (rowGroupIndices ? rowGroupIndices->capacity() : 0)) * sizeof(index_type));
     return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
 }
 
@@ -1164,6 +1182,12 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(storm::storage::Bi
                                                               storm::storage::BitVector const& columnConstraint, std::vector<index_type> const& rowGroupIndices,
                                                               bool insertDiagonalEntries, storm::storage::BitVector const& makeZeroColumns) const {
     STORM_LOG_THROW(!rowGroupConstraint.empty() && !columnConstraint.empty(), storm::exceptions::InvalidArgumentException, "Cannot build empty submatrix.");
+#ifdef STORM_HAVE_INTELTBB
+    // Diagonal entries are only guaranteed to be inserted in column order if the row groups coincide with the columns.
+    if (useParallelConstruction(this->getEntryCount()) && (!insertDiagonalEntries || rowGroupConstraint == columnConstraint)) {
+        return getSubmatrixParallel(rowGroupConstraint, columnConstraint, rowGroupIndices, insertDiagonalEntries, makeZeroColumns);
+    }
+#endif
     index_type submatrixColumnCount = columnConstraint.getNumberOfSetBits();
 
     // Start by creating a temporary vector that stores for each index whose bit is set to true the number of
@@ -1430,6 +1454,11 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::selectRowsFromRowIndexSequence(
 
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRows(std::vector<index_type> const& inversePermutation) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (useParallelConstruction(entryCount)) {
+        return permuteRowsParallel(inversePermutation);
+    }
+#endif
     // Now create the matrix to be returned with the appropriate size.
     // The entry size is only adequate if this is indeed a permutation.
     SparseMatrixBuilder<ValueType> matrixBuilder(inversePermutation.size(), columnCount, entryCount);
@@ -1477,6 +1506,11 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRowGroupsAndColumns(std:
 
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool keepZeros) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (useParallelConstruction(this->getEntryCount())) {
+        return transposeParallel(joinGroups, keepZeros);
+    }
+#endif
     index_type rowCount = this->getColumnCount();
     index_type columnCount = joinGroups ? this->getRowGroupCount() : this->getRowCount();
     index_type entryCount;
@@ -1524,6 +1558,169 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool
     return transposedMatrix;
 }
 
+#ifdef STORM_HAVE_INTELTBB
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::transposeParallel(bool joinGroups, bool keepZeros) const {
+    index_type const transposedRowCount = this->getColumnCount();
+    index_type const transposedColumnCount = joinGroups ? this->getRowGroupCount() : this->getRowCount();
+
+    // First, count the entries of each column with atomic counters.
+    std::vector<std::atomic<index_type>> nextIndices(transposedRowCount);
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, this->getRowCount()), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type row = range.begin(); row < range.end(); ++row) {
+            for (auto const& entry : this->getRow(row)) {
+                if (entry.getValue() != storm::utility::zero<ValueType>() || keepZeros) {
+                    nextIndices[entry.getColumn()].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+    });
+
+    // Now compute the accumulated offsets, which are also the positions of the first entries of the rows.
+    std::vector<index_type> rowIndications(transposedRowCount + 1);
+    for (index_type row = 0; row < transposedRowCount; ++row) {
+        rowIndications[row + 1] = rowIndications[row] + nextIndices[row].load(std::memory_order_relaxed);
+        nextIndices[row].store(rowIndications[row], std::memory_order_relaxed);
+    }
+
+    // Place the entries, where the column of each entry is the row it originates from for now.
+    std::vector<MatrixEntry<index_type, ValueType>> columnsAndValues(rowIndications.back());
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, this->getRowCount()), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type row = range.begin(); row < range.end(); ++row) {
+            for (auto const& entry : this->getRow(row)) {
+                if (entry.getValue() != storm::utility::zero<ValueType>() || keepZeros) {
+                    columnsAndValues[nextIndices[entry.getColumn()].fetch_add(1, std::memory_order_relaxed)] =
+                        MatrixEntry<index_type, ValueType>(row, entry.getValue());
+                }
+            }
+        }
+    });
+
+    std::vector<index_type> rowToGroup;
+    if (joinGroups && !this->hasTrivialRowGrouping()) {
+        rowToGroup.resize(this->getRowCount());
+        tbb::parallel_for(tbb::blocked_range<index_type>(0, this->getRowGroupCount()), [&](tbb::blocked_range<index_type> const& range) {
+            for (index_type group = range.begin(); group < range.end(); ++group) {
+                std::fill(rowToGroup.begin() + this->getRowGroupIndices()[group], rowToGroup.begin() + this->getRowGroupIndices()[group + 1], group);
+            }
+        });
+    }
+
+    // Since each row has at most one entry per column, sorting the rows restores the order of the sequential construction.
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, transposedRowCount), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type row = range.begin(); row < range.end(); ++row) {
+            auto rowStart = columnsAndValues.begin() + rowIndications[row];
+            auto rowEnd = columnsAndValues.begin() + rowIndications[row + 1];
+            std::sort(rowStart, rowEnd, [](MatrixEntry<index_type, ValueType> const& a, MatrixEntry<index_type, ValueType> const& b) {
+                return a.getColumn() < b.getColumn();
+            });
+            if (!rowToGroup.empty()) {
+                for (auto it = rowStart; it != rowEnd; ++it) {
+                    it->setColumn(rowToGroup[it->getColumn()]);
+                }
+            }
+        }
+    });
+
+    return SparseMatrix<ValueType>(transposedColumnCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrixParallel(storm::storage::BitVector const& rowGroupConstraint,
+                                                                      storm::storage::BitVector const& columnConstraint,
+                                                                      std::vector<index_type> const& rowGroupIndices, bool insertDiagonalEntries,
+                                                                      storm::storage::BitVector const& makeZeroColumns) const {
+    index_type submatrixColumnCount = columnConstraint.getNumberOfSetBits();
+    std::vector<index_type> columnBitsSetBeforeIndex = columnConstraint.getNumberOfSetBitsBeforeIndices();
+
+    // Determine the selected row groups and the first row of each of them in the submatrix.
+    std::vector<index_type> selectedGroups(rowGroupConstraint.begin(), rowGroupConstraint.end());
+    std::vector<index_type> newRowGroupIndices(selectedGroups.size() + 1);
+    for (index_type newGroup = 0; newGroup < selectedGroups.size(); ++newGroup) {
+        newRowGroupIndices[newGroup + 1] =
+            newRowGroupIndices[newGroup] + rowGroupIndices[selectedGroups[newGroup] + 1] - rowGroupIndices[selectedGroups[newGroup]];
+    }
+    index_type subRows = newRowGroupIndices.back();
+
+    // Passes the entries of the given row of the submatrix to the given function. As the row groups coincide with the
+    // columns if diagonal entries are inserted, the entries are passed in the order of their columns.
+    auto forEachEntry = [&](index_type row, index_type newGroup, auto&& addEntry) {
+        bool insertedDiagonalElement = false;
+        for (auto const& entry : this->getRow(row)) {
+            if (columnConstraint.get(entry.getColumn()) && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(entry.getColumn()))) {
+                index_type newColumn = columnBitsSetBeforeIndex[entry.getColumn()];
+                if (newColumn == newGroup) {
+                    insertedDiagonalElement = true;
+                } else if (insertDiagonalEntries && !insertedDiagonalElement && newColumn > newGroup) {
+                    addEntry(newGroup, storm::utility::zero<ValueType>());
+                    insertedDiagonalElement = true;
+                }
+                addEntry(newColumn, entry.getValue());
+            }
+        }
+        if (insertDiagonalEntries && !insertedDiagonalElement && newGroup < submatrixColumnCount) {
+            addEntry(newGroup, storm::utility::zero<ValueType>());
+        }
+    };
+
+    // Count the entries of each row and accumulate them to obtain the row indications.
+    std::vector<index_type> rowIndications(subRows + 1);
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, selectedGroups.size()), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type newGroup = range.begin(); newGroup < range.end(); ++newGroup) {
+            index_type newRow = newRowGroupIndices[newGroup];
+            for (index_type row = rowGroupIndices[selectedGroups[newGroup]]; row < rowGroupIndices[selectedGroups[newGroup] + 1]; ++row, ++newRow) {
+                forEachEntry(row, newGroup, [&](index_type, ValueType const&) { ++rowIndications[newRow + 1]; });
+            }
+        }
+    });
+    for (index_type newRow = 1; newRow <= subRows; ++newRow) {
+        rowIndications[newRow] += rowIndications[newRow - 1];
+    }
+
+    // Copy over the selected entries.
+    std::vector<MatrixEntry<index_type, ValueType>> columnsAndValues(rowIndications.back());
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, selectedGroups.size()), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type newGroup = range.begin(); newGroup < range.end(); ++newGroup) {
+            index_type newRow = newRowGroupIndices[newGroup];
+            for (index_type row = rowGroupIndices[selectedGroups[newGroup]]; row < rowGroupIndices[selectedGroups[newGroup] + 1]; ++row, ++newRow) {
+                index_type position = rowIndications[newRow];
+                forEachEntry(row, newGroup, [&](index_type column, ValueType const& value) {
+                    columnsAndValues[position++] = MatrixEntry<index_type, ValueType>(column, value);
+                });
+            }
+        }
+    });
+
+    boost::optional<std::vector<index_type>> resultRowGroupIndices;
+    if (!this->hasTrivialRowGrouping()) {
+        resultRowGroupIndices = std::move(newRowGroupIndices);
+    }
+    return SparseMatrix<ValueType>(submatrixColumnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(resultRowGroupIndices));
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRowsParallel(std::vector<index_type> const& inversePermutation) const {
+    std::vector<index_type> rowIndications(inversePermutation.size() + 1);
+    for (index_type writeTo = 0; writeTo < inversePermutation.size(); ++writeTo) {
+        rowIndications[writeTo + 1] = rowIndications[writeTo] + this->getRow(inversePermutation[writeTo]).getNumberOfEntries();
+    }
+
+    std::vector<MatrixEntry<index_type, ValueType>> columnsAndValues(rowIndications.back());
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, inversePermutation.size()), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type writeTo = range.begin(); writeTo < range.end(); ++writeTo) {
+            auto row = this->getRow(inversePermutation[writeTo]);
+            std::copy(row.begin(), row.end(), columnsAndValues.begin() + rowIndications[writeTo]);
+        }
+    });
+
+    SparseMatrix<ValueType> result(columnCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+    if (this->rowGroupIndices) {
+        result.setRowGroupIndices(this->rowGroupIndices.get());
+    }
+    return result;
+}
+#endif
+
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::transposeSelectedRowsFromRowGroups(std::vector<uint64_t> const& rowGroupChoices, bool keepZeros) const {
     index_type rowCount = this->getColumnCount();
@@ -2634,6 +2831,16 @@ std::size_t SparseMatrix<ValueType>::hash() const {
     return result;
 }
 
+template<typename ValueType>
+std::size_t SparseMatrix<ValueType>::getSizeInBytes() const {
+    std::size_t result =
+        sizeof(*this) + sizeof(MatrixEntry<index_type, value_type>) * columnsAndValues.capacity() + sizeof(index_type) * rowIndications.capacity();
+    if (rowGroupIndices) {
+        result += sizeof(index_type) * rowGroupIndices->capacity();
+    }
+    return result;
+}
+
 // Explicitly instantiate the entry, builder and the matrix.
 // double
 template class MatrixEntry<typename SparseMatrix<double>::index_type, double>;
@@ -1077,6 +1077,13 @@ class SparseMatrix {
      */
     std::size_t hash() const;
 
+    /*!
+     * Returns (an approximation of) the size of the matrix measured in bytes.
+     *
+     * @return The size of the matrix measured in bytes.
+     */
+    std::size_t getSizeInBytes() const;
+
     /*!
      * Returns an object representing the consecutive rows given by the parameters.
      *
@@ -1224,6 +1231,18 @@ class SparseMatrix {
                               std::vector<index_type> const& rowGroupIndices, bool insertDiagonalEntries = false,
                               storm::storage::BitVector const& makeZeroColumns = storm::storage::BitVector()) const;
 
+#ifdef STORM_HAVE_INTELTBB
+    /*!
+     * Parallel counterparts of transpose, getSubmatrix and permuteRows. Rows are counted and filled concurrently
+     * after a prefix sum over the row sizes, so the resulting matrices are identical to the sequentially built ones.
+     */
+    SparseMatrix transposeParallel(bool joinGroups, bool keepZeros) const;
+    SparseMatrix getSubmatrixParallel(storm::storage::BitVector const& rowGroupConstraint, storm::storage::BitVector const& columnConstraint,
+                                      std::vector<index_type> const& rowGroupIndices, bool insertDiagonalEntries,
+                                      storm::storage::BitVector const& makeZeroColumns) const;
+    SparseMatrix permuteRowsParallel(std::vector<index_type> const& inversePermutation) const;
+#endif
+
     // The number of rows of the matrix.
     index_type rowCount;
 
@@ -2,10 +2,12 @@
 
 #include <chrono>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidOptionException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/logic/FormulaInformation.h"
 #include "storm/logic/FragmentSpecification.h"
@@ -62,7 +64,8 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       buildQuotient(true),
       keepRewards(false),
       type(BisimulationType::Strong),
-      bounded(false) {
+      bounded(false),
+      refinementMethod(BisimulationRefinementMethod::Splitter) {
     // Intentionally left empty.
 }
 
@@ -188,7 +191,13 @@ template<typename ModelType, typename BlockDataType>
 BisimulationDecomposition<ModelType, BlockDataType>::BisimulationDecomposition(ModelType const& model,
                                                                                storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                Options const& options)
-    : model(model), backwardTransitions(backwardTransitions), options(options), partition(), comparator(), quotient(nullptr) {
+    : model(model),
+      backwardTransitions(backwardTransitions),
+      options(options),
+      partition(),
+      comparator(),
+      parallelize(storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()),
+      quotient(nullptr) {
     STORM_LOG_THROW(!options.getKeepRewards() || !model.hasRewardModel() || model.hasUniqueRewardModel(), storm::exceptions::IllegalFunctionCallException,
                     "Bisimulation currently only supports models with at most one reward model.");
     STORM_LOG_THROW(!options.getKeepRewards() || !model.hasRewardModel() || !model.getUniqueRewardModel().hasTransitionRewards(),
@@ -256,6 +265,14 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
 
 template<typename ModelType, typename BlockDataType>
 void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
+    if (options.getRefinementMethod() == BisimulationRefinementMethod::Signature) {
+        if (options.getType() == BisimulationType::Strong) {
+            this->performSignatureRefinement();
+            return;
+        }
+        STORM_LOG_WARN("Signature-based refinement is only supported for strong bisimulation. Falling back to splitter-based refinement.");
+    }
+
     // Insert all blocks into the splitter queue as a (potential) splitter.
     std::vector<Block<BlockDataType>*> splitterQueue;
     std::for_each(partition.getBlocks().begin(), partition.getBlocks().end(), [&](std::unique_ptr<Block<BlockDataType>> const& block) {
@@ -288,6 +305,97 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+    // Refine all blocks simultaneously until no block is split anymore. In contrast to the splitter-based
+    // refinement, every round considers the complete partition, which makes the rounds independent of the
+    // order in which blocks are processed and therefore amenable to parallelization.
+    uint_fast64_t iterations = 0;
+    bool changed = true;
+    while (changed) {
+        ++iterations;
+        changed = this->refinePartitionBasedOnSignatures();
+        STORM_LOG_TRACE("Signature-based refinement round " << iterations << " yielded " << partition.size() << " blocks.");
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " rounds of signature-based partition refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+            break;
+        }
+    }
+    STORM_LOG_DEBUG("Signature-based refinement converged after " << iterations << " rounds with " << partition.size() << " blocks.");
+}
+
+template<typename ModelType, typename BlockDataType>
+bool BisimulationDecomposition<ModelType, BlockDataType>::refinePartitionBasedOnSignatures() {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Signature-based refinement is not supported for this model type.");
+    return false;
+}
+
+template<typename ModelType, typename BlockDataType>
+bool BisimulationDecomposition<ModelType, BlockDataType>::refineAllBlocksBasedOnSignatures(
+    std::function<void(storm::storage::sparse::state_type)> const& computeSignature,
+    std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& signatureLess,
+    std::function<void(Block<BlockDataType>&)> const& newBlockCallback) {
+    // We only consider the blocks that exist before this round. New blocks are appended to the end of the block
+    // vector, so their indices do not interfere with the ones processed here.
+    std::size_t numberOfBlocks = partition.size();
+    std::vector<std::vector<uint_fast64_t>> splitPositions(numberOfBlocks);
+
+    // For every block, compute the signatures of its states, sort the states by signature and determine the
+    // positions at which the signature changes. This only touches data associated with the states of the block
+    // itself, so different blocks can be treated in parallel.
+    auto processBlock = [&](uint_fast64_t blockIndex) {
+        Block<BlockDataType>& block = *partition.getBlocks()[blockIndex];
+        if (block.getNumberOfStates() <= 1 || block.data().absorbing()) {
+            return;
+        }
+        for (auto stateIt = partition.begin(block), stateIte = partition.end(block); stateIt != stateIte; ++stateIt) {
+            computeSignature(*stateIt);
+        }
+        partition.sortBlock(block, signatureLess);
+        splitPositions[blockIndex] = partition.computeRangesOfEqualValue(block.getBeginIndex(), block.getEndIndex(), signatureLess);
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    if (parallelize) {
+        tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, numberOfBlocks, 1), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+            for (uint_fast64_t blockIndex = range.begin(); blockIndex != range.end(); ++blockIndex) {
+                processBlock(blockIndex);
+            }
+        });
+    } else {
+        for (uint_fast64_t blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+            processBlock(blockIndex);
+        }
+    }
+#else
+    for (uint_fast64_t blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+        processBlock(blockIndex);
+    }
+#endif
+
+    // Now perform the actual splits. The ranges are given as [begin, p_1, ..., p_k, end] and splitting a block
+    // at some position moves the states before that position to a new block, so we can simply split at all inner
+    // positions in ascending order.
+    bool split = false;
+    for (uint_fast64_t blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+        std::vector<uint_fast64_t> const& positions = splitPositions[blockIndex];
+        if (positions.size() <= 2) {
+            continue;
+        }
+
+        split = true;
+        Block<BlockDataType>& block = *partition.getBlocks()[blockIndex];
+        for (auto positionIt = positions.begin() + 1, positionIte = positions.end() - 1; positionIt != positionIte; ++positionIt) {
+            auto result = partition.splitBlock(block, *positionIt);
+            newBlockCallback(**result.first);
+        }
+    }
+
+    return split;
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
@@ -95,6 +95,18 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
             return this->type;
         }
 
+        /*!
+         * Sets the method used to refine the partition. Signature-based refinement is only available for strong
+         * bisimulation; for weak bisimulation, the splitter-based refinement is used regardless of this setting.
+         */
+        void setRefinementMethod(BisimulationRefinementMethod method) {
+            refinementMethod = method;
+        }
+
+        BisimulationRefinementMethod getRefinementMethod() const {
+            return this->refinementMethod;
+        }
+
         bool getBounded() const {
             return this->bounded;
         }
@@ -140,6 +152,9 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// when computing strong bisimulation equivalence.
         bool bounded;
 
+        /// The method that is used to refine the partition.
+        BisimulationRefinementMethod refinementMethod;
+
         /*!
          * Sets the options under the assumption that the given formula is the only one that is to be checked.
          *
@@ -218,6 +233,38 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
     virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter,
                                                 std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) = 0;
 
+    /*!
+     * Performs the partition refinement by repeatedly splitting all blocks of the partition at once according to
+     * the signatures of their states until the partition is stable.
+     */
+    void performSignatureRefinement();
+
+    /*!
+     * Performs one round of signature-based refinement, i.e. computes the signatures of all states wrt. the
+     * current partition and splits all blocks such that afterwards all states of a block share the same signature.
+     * Blocks may be processed in parallel, so implementations must only modify the partition in ways that do not
+     * interfere across blocks before the actual splits are performed.
+     *
+     * @return True iff at least one block was split.
+     */
+    virtual bool refinePartitionBasedOnSignatures();
+
+    /*!
+     * Refines all blocks of the current partition at once. For every block that may be refined, the signatures
+     * of its states are computed, the states are sorted according to their signatures and the block is split such
+     * that all resulting blocks consist of states with equal signatures. The blocks are sorted (possibly in
+     * parallel) before any of them is split, so the signatures must only depend on the partition at the time of
+     * the call.
+     *
+     * @param computeSignature A function that computes (and stores) the signature of the given state.
+     * @param signatureLess An order on states wrt. their (previously computed) signatures.
+     * @param newBlockCallback A function that is called for every newly created block.
+     * @return True iff at least one block was split.
+     */
+    bool refineAllBlocksBasedOnSignatures(std::function<void(storm::storage::sparse::state_type)> const& computeSignature,
+                                          std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> const& signatureLess,
+                                          std::function<void(bisimulation::Block<BlockDataType>&)> const& newBlockCallback);
+
     /*!
      * Builds the quotient model based on the previously computed equivalence classes (stored in the blocks
      * of the decomposition.
@@ -282,6 +329,9 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
     // A comparator used for comparing the distances of constants.
     storm::utility::ConstantsComparator<ValueType> comparator;
 
+    // A flag indicating whether the signature-based refinement is allowed to process blocks in parallel.
+    bool parallelize;
+
     // The quotient, if it was build. Otherwhise a null pointer.
     std::shared_ptr<ModelType> quotient;
 };
@@ -592,6 +592,37 @@ void DeterministicModelBisimulationDecomposition<ModelType>::refinePartitionBase
     }
 }
 
+template<typename ModelType>
+bool DeterministicModelBisimulationDecomposition<ModelType>::refinePartitionBasedOnSignatures() {
+    STORM_LOG_ASSERT(this->options.getType() == BisimulationType::Strong, "Signature-based refinement requires strong bisimulation.");
+    if (signatures.empty()) {
+        signatures.resize(this->model.getNumberOfStates());
+    }
+
+    // The signature of a state is its probability (or rate, in the case of CTMCs) of moving to each block of the
+    // current partition.
+    bool split = this->refineAllBlocksBasedOnSignatures(
+        [this](storm::storage::sparse::state_type state) {
+            storm::storage::Distribution<ValueType>& signature = signatures[state];
+            signature = storm::storage::Distribution<ValueType>();
+            for (auto const& entry : this->model.getTransitionMatrix().getRow(state)) {
+                if (!this->comparator.isZero(entry.getValue())) {
+                    signature.addProbability(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                }
+            }
+        },
+        [this](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+            return signatures[state1].less(signatures[state2], this->comparator);
+        },
+        [](Block<BlockDataType>&) {});
+
+    // Once the partition is stable, the signatures are not needed anymore.
+    if (!split) {
+        std::vector<storm::storage::Distribution<ValueType>>().swap(signatures);
+    }
+    return split;
+}
+
 template<typename ModelType>
 void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
     // In order to create the quotient model, we need to construct
@@ -1,6 +1,7 @@
 #ifndef STORM_STORAGE_BISIMULATION_DETERMINISTICMODELBISIMULATIONDECOMPOSITION_H_
 #define STORM_STORAGE_BISIMULATION_DETERMINISTICMODELBISIMULATIONDECOMPOSITION_H_
 
+#include "storm/storage/Distribution.h"
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
@@ -39,6 +40,8 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
     virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter,
                                                 std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) override;
 
+    virtual bool refinePartitionBasedOnSignatures() override;
+
    private:
     // Post-processes the initial partition to properly initialize it.
     void postProcessInitialPartition();
@@ -133,6 +136,10 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
 
     // A vector mapping each state to its silent probability.
     std::vector<ValueType> silentProbabilities;
+
+    // A vector that holds for each state the distribution over the blocks of the current partition. This is only
+    // used by the signature-based refinement.
+    std::vector<storm::storage::Distribution<ValueType>> signatures;
 };
 }  // namespace storage
 }  // namespace storm
@@ -59,7 +59,7 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::createChoiceToSt
 
 template<typename ModelType>
 void NondeterministicModelBisimulationDecomposition<ModelType>::initializeQuotientDistributions() {
-    std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
 
     for (auto const& block : this->partition.getBlocks()) {
         if (block->data().absorbing()) {
@@ -73,32 +73,36 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::initializeQuotie
         } else {
             // Otherwise, we compute the probabilities from the transition matrix.
             for (auto stateIt = this->partition.begin(*block), stateIte = this->partition.end(*block); stateIt != stateIte; ++stateIt) {
-                for (uint_fast64_t choice = nondeterministicChoiceIndices[*stateIt]; choice < nondeterministicChoiceIndices[*stateIt + 1]; ++choice) {
-                    if (this->options.getKeepRewards() && this->model.hasRewardModel()) {
-                        auto const& rewardModel = this->model.getUniqueRewardModel();
-                        if (rewardModel.hasStateActionRewards()) {
-                            this->quotientDistributions[choice].setReward(rewardModel.getStateActionReward(choice));
-                        }
-                    }
-                    for (auto entry : this->model.getTransitionMatrix().getRow(choice)) {
-                        if (!this->comparator.isZero(entry.getValue())) {
-                            this->quotientDistributions[choice].addProbability(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
-                        }
-                    }
-                    orderedQuotientDistributions[choice] = &this->quotientDistributions[choice];
-                }
+                computeQuotientDistributions(*stateIt);
             }
         }
     }
+}
 
-    for (decltype(this->model.getNumberOfStates()) state = 0; state < this->model.getNumberOfStates(); ++state) {
-        updateOrderedQuotientDistributions(state);
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::computeQuotientDistributions(storm::storage::sparse::state_type state) {
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+        this->quotientDistributions[choice] = storm::storage::DistributionWithReward<ValueType>();
+        if (this->options.getKeepRewards() && this->model.hasRewardModel()) {
+            auto const& rewardModel = this->model.getUniqueRewardModel();
+            if (rewardModel.hasStateActionRewards()) {
+                this->quotientDistributions[choice].setReward(rewardModel.getStateActionReward(choice));
+            }
+        }
+        for (auto entry : this->model.getTransitionMatrix().getRow(choice)) {
+            if (!this->comparator.isZero(entry.getValue())) {
+                this->quotientDistributions[choice].addProbability(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+            }
+        }
+        orderedQuotientDistributions[choice] = &this->quotientDistributions[choice];
     }
+    updateOrderedQuotientDistributions(state);
 }
 
 template<typename ModelType>
 void NondeterministicModelBisimulationDecomposition<ModelType>::updateOrderedQuotientDistributions(storm::storage::sparse::state_type state) {
-    std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
     std::sort(this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state],
               this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state + 1],
               [this](storm::storage::Distribution<ValueType> const* dist1, storm::storage::Distribution<ValueType> const* dist2) {
@@ -400,7 +404,7 @@ template<typename ModelType>
 bool NondeterministicModelBisimulationDecomposition<ModelType>::quotientDistributionsLess(storm::storage::sparse::state_type state1,
                                                                                           storm::storage::sparse::state_type state2) const {
     STORM_LOG_TRACE("Comparing the quotient distributions of state " << state1 << " and " << state2 << ".");
-    std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
 
     auto firstIt = orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state1];
     auto firstIte = orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state1 + 1];
@@ -443,6 +447,26 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::refinePartitionB
     splitBlockAccordingToCurrentQuotientDistributions(splitter, splitterQueue);
 }
 
+template<typename ModelType>
+bool NondeterministicModelBisimulationDecomposition<ModelType>::refinePartitionBasedOnSignatures() {
+    // The signature of a state is the set of its quotient distributions wrt. the current partition.
+    bool split = this->refineAllBlocksBasedOnSignatures(
+        [this](storm::storage::sparse::state_type state) { computeQuotientDistributions(state); },
+        [this](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) { return quotientDistributionsLess(state1, state2); },
+        [](Block<BlockDataType>&) {});
+
+    // The quotient distributions of states in singleton blocks are not recomputed during the refinement, so once
+    // the partition is stable, we need to bring them up-to-date for building the quotient.
+    if (!split) {
+        for (auto const& block : this->partition.getBlocks()) {
+            if (block->getNumberOfStates() == 1 && !block->data().absorbing()) {
+                computeQuotientDistributions(*this->partition.begin(*block));
+            }
+        }
+    }
+    return split;
+}
+
 template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>>;
 
 #ifdef STORM_HAVE_CARL
@@ -40,6 +40,8 @@ class NondeterministicModelBisimulationDecomposition : public BisimulationDecomp
 
     virtual void initialize() override;
 
+    virtual bool refinePartitionBasedOnSignatures() override;
+
    private:
     // Creates the mapping from the choice indices to the states.
     void createChoiceToStateMapping();
@@ -47,6 +49,9 @@ class NondeterministicModelBisimulationDecomposition : public BisimulationDecomp
     // Initializes the quotient distributions wrt. to the current partition.
     void initializeQuotientDistributions();
 
+    // Recomputes the quotient distributions of all choices of the given state wrt. to the current partition.
+    void computeQuotientDistributions(storm::storage::sparse::state_type state);
+
     // Retrieves whether the given block possibly needs refinement.
     bool possiblyNeedsRefinement(bisimulation::Block<BlockDataType> const& block) const;
 
@@ -407,6 +407,34 @@ Add<LibraryType, ValueType> Add<LibraryType, ValueType>::multiplyMatrix(Bdd<Libr
                                        containedMetaVariables);
 }
 
+template<DdType LibraryType, typename ValueType>
+Add<LibraryType, ValueType> Add<LibraryType, ValueType>::multiplyMatrixAndMinMaxAbstract(
+    Add<LibraryType, ValueType> const& vector, std::set<storm::expressions::Variable> const& summationMetaVariables, Add<LibraryType, ValueType> const& offset,
+    std::set<storm::expressions::Variable> const& abstractedMetaVariables, bool minimize) const {
+    // Create the summation variables.
+    std::vector<InternalBdd<LibraryType>> summationDdVariables;
+    for (auto const& metaVariable : summationMetaVariables) {
+        for (auto const& ddVariable : this->getDdManager().getMetaVariable(metaVariable).getDdVariables()) {
+            summationDdVariables.push_back(ddVariable.getInternalBdd());
+        }
+    }
+    Bdd<LibraryType> cube = Bdd<LibraryType>::getCube(this->getDdManager(), abstractedMetaVariables);
+
+    std::set<storm::expressions::Variable> unionOfMetaVariables = Dd<LibraryType>::joinMetaVariables(*this, vector);
+    unionOfMetaVariables.insert(offset.getContainedMetaVariables().begin(), offset.getContainedMetaVariables().end());
+    std::set<storm::expressions::Variable> removedMetaVariables;
+    std::set_union(summationMetaVariables.begin(), summationMetaVariables.end(), abstractedMetaVariables.begin(), abstractedMetaVariables.end(),
+                   std::inserter(removedMetaVariables, removedMetaVariables.begin()));
+    std::set<storm::expressions::Variable> containedMetaVariables;
+    std::set_difference(unionOfMetaVariables.begin(), unionOfMetaVariables.end(), removedMetaVariables.begin(), removedMetaVariables.end(),
+                        std::inserter(containedMetaVariables, containedMetaVariables.begin()));
+
+    return Add<LibraryType, ValueType>(
+        this->getDdManager(),
+        internalAdd.multiplyMatrixAndMinMaxAbstract(vector.internalAdd, summationDdVariables, offset.internalAdd, cube.getInternalBdd(), minimize),
+        containedMetaVariables);
+}
+
 template<DdType LibraryType, typename ValueType>
 Bdd<LibraryType> Add<LibraryType, ValueType>::greater(ValueType const& value) const {
     return Bdd<LibraryType>(this->getDdManager(), internalAdd.greater(value), this->getContainedMetaVariables());
@@ -685,22 +713,13 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
     }
     std::sort(ddColumnVariableIndices.begin(), ddColumnVariableIndices.end());
 
-    // Prepare the vectors that represent the matrix.
+    // Count the number of elements in the rows. We write the counts directly into a vector of the final size to
+    // avoid reallocating it when appending the last row indication.
     std::vector<uint_fast64_t> rowIndications(rowOdd.getTotalOffset() + 1);
+    this->notZero().template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).internalAdd.composeWithExplicitVector(
+        rowOdd, ddRowVariableIndices, rowIndications, std::plus<uint_fast64_t>());
     std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(this->getNonZeroCount());
 
-    // Create a trivial row grouping.
-    std::vector<uint_fast64_t> trivialRowGroupIndices(rowIndications.size());
-    uint_fast64_t i = 0;
-    for (auto& entry : trivialRowGroupIndices) {
-        entry = i;
-        ++i;
-    }
-
-    // Count the number of elements in the rows.
-    rowIndications = this->notZero().template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).toVector(rowOdd);
-    rowIndications.emplace_back();
-
     // Now that we computed the number of entries in each row, compute the corresponding offsets in the entry vector.
     uint_fast64_t tmp = 0;
     uint_fast64_t tmp2 = 0;
@@ -711,8 +730,8 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
     }
     rowIndications[0] = 0;
 
-    // Now actually fill the entry vector.
-    internalAdd.toMatrixComponents(trivialRowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
+    // Now actually fill the entry vector. Passing no row group indices makes every row its own group.
+    internalAdd.toMatrixComponents({}, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
                                    true);
 
     // Since the last call to toMatrixRec modified the rowIndications, we need to restore the correct values.
@@ -810,8 +829,8 @@ typename Add<LibraryType, ValueType>::MatrixAndLabeling Add<LibraryType, ValueTy
     // Start by computing the offsets (in terms of rows) for each row group.
     Add<LibraryType, uint_fast64_t> stateToNumberOfChoices =
         this->notZero().existsAbstract(columnMetaVariables).template toAdd<uint_fast64_t>().sumAbstract(groupMetaVariables);
-    std::vector<uint_fast64_t> rowGroupIndices = stateToNumberOfChoices.toVector(rowOdd);
-    rowGroupIndices.resize(rowGroupIndices.size() + 1);
+    std::vector<uint_fast64_t> rowGroupIndices(rowOdd.getTotalOffset() + 1);
+    stateToNumberOfChoices.internalAdd.composeWithExplicitVector(rowOdd, ddRowVariableIndices, rowGroupIndices, std::plus<uint_fast64_t>());
     uint_fast64_t tmp = 0;
     uint_fast64_t tmp2 = 0;
     for (uint_fast64_t i = 1; i < rowGroupIndices.size(); ++i) {
@@ -856,10 +875,9 @@ typename Add<LibraryType, ValueType>::MatrixAndLabeling Add<LibraryType, ValueTy
         auto const& group = groups[i];
         auto groupNotZero = group.notZero();
 
-        std::vector<uint64_t> tmpRowIndications = groupNotZero.template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).toVector(rowOdd);
-        for (uint64_t offset = 0; offset < tmpRowIndications.size(); ++offset) {
-            rowIndications[rowGroupIndices[offset]] += tmpRowIndications[offset];
-        }
+        // Add the entry counts of the group's rows without materializing an intermediate vector over all states.
+        groupNotZero.template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).internalAdd.composeWithExplicitVector(
+            rowOdd, ddRowVariableIndices, rowGroupIndices, rowIndications, std::plus<uint_fast64_t>());
 
         statesWithGroupEnabled[i] = groupNotZero.existsAbstract(columnMetaVariables).template toAdd<uint_fast64_t>();
         if (buildLabeling) {
@@ -1082,10 +1100,9 @@ std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<Value
         std::vector<Add<LibraryType, ValueType>> const& group = groups[i];
         Bdd<LibraryType> matrixDdNotZero = group.back().notZero();
 
-        std::vector<uint64_t> tmpRowIndications = matrixDdNotZero.template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).toVector(rowOdd);
-        for (uint64_t offset = 0; offset < tmpRowIndications.size(); ++offset) {
-            rowIndications[rowGroupIndices[offset]] += tmpRowIndications[offset];
-        }
+        // Add the entry counts of the group's rows without materializing an intermediate vector over all states.
+        matrixDdNotZero.template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).internalAdd.composeWithExplicitVector(
+            rowOdd, ddRowVariableIndices, rowGroupIndices, rowIndications, std::plus<uint_fast64_t>());
 
         Bdd<LibraryType> vectorDdNotZero = this->getDdManager().getBddZero();
         for (uint64_t vectorIndex = 0; vectorIndex < vectors.size(); ++vectorIndex) {
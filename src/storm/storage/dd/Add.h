@@ -388,6 +388,24 @@ class Add : public Dd<LibraryType> {
      */
     Add<LibraryType, ValueType> multiplyMatrix(Bdd<LibraryType> const& otherMatrix, std::set<storm::expressions::Variable> const& summationMetaVariables) const;
 
+    /*!
+     * Computes the minimum or maximum over the given abstracted meta variables of the product of the current ADD
+     * (representing a matrix) and the given vector plus the given offset. The result equals
+     * (multiplyMatrix(vector, summationMetaVariables) + offset).minAbstract(abstractedMetaVariables) (or maxAbstract,
+     * respectively), but the operations are fused if the library supports it.
+     *
+     * @param vector The vector with which to multiply.
+     * @param summationMetaVariables The meta variables over which to sum during the multiplication.
+     * @param offset The ADD that is added to the product.
+     * @param abstractedMetaVariables The meta variables to abstract by taking the minimum or maximum.
+     * @param minimize If set, the minimum is taken, otherwise the maximum.
+     * @return The resulting ADD.
+     */
+    Add<LibraryType, ValueType> multiplyMatrixAndMinMaxAbstract(Add<LibraryType, ValueType> const& vector,
+                                                                std::set<storm::expressions::Variable> const& summationMetaVariables,
+                                                                Add<LibraryType, ValueType> const& offset,
+                                                                std::set<storm::expressions::Variable> const& abstractedMetaVariables, bool minimize) const;
+
     /*!
      * Computes a BDD that represents the function in which all assignments with a function value strictly
      * larger than the given value are mapped to one and all others to zero.
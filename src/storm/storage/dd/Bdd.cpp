@@ -298,6 +298,38 @@ Bdd<LibraryType> Bdd<LibraryType>::inverseRelationalProductWithExtendedRelation(
                             newMetaVariables);
 }
 
+template<DdType LibraryType>
+Bdd<LibraryType> Bdd<LibraryType>::inverseRelationalProductStep(Bdd<LibraryType> const& relation,
+                                                                std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                std::set<storm::expressions::Variable> const& columnMetaVariables,
+                                                                Bdd<LibraryType> const& constraint) const {
+    std::set<storm::expressions::Variable> newMetaVariables;
+    std::set_difference(relation.getContainedMetaVariables().begin(), relation.getContainedMetaVariables().end(), columnMetaVariables.begin(),
+                        columnMetaVariables.end(), std::inserter(newMetaVariables, newMetaVariables.begin()));
+    newMetaVariables.insert(this->getContainedMetaVariables().begin(), this->getContainedMetaVariables().end());
+    newMetaVariables.insert(constraint.getContainedMetaVariables().begin(), constraint.getContainedMetaVariables().end());
+
+    std::vector<InternalBdd<LibraryType>> rowVariables;
+    for (auto const& metaVariable : rowMetaVariables) {
+        DdMetaVariable<LibraryType> const& variable = this->getDdManager().getMetaVariable(metaVariable);
+        for (auto const& ddVariable : variable.getDdVariables()) {
+            rowVariables.push_back(ddVariable.getInternalBdd());
+        }
+    }
+
+    std::vector<InternalBdd<LibraryType>> columnVariables;
+    for (auto const& metaVariable : columnMetaVariables) {
+        DdMetaVariable<LibraryType> const& variable = this->getDdManager().getMetaVariable(metaVariable);
+        for (auto const& ddVariable : variable.getDdVariables()) {
+            columnVariables.push_back(ddVariable.getInternalBdd());
+        }
+    }
+
+    return Bdd<LibraryType>(this->getDdManager(),
+                            internalBdd.inverseRelationalProductStep(relation.getInternalBdd(), rowVariables, columnVariables, constraint.getInternalBdd()),
+                            newMetaVariables);
+}
+
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::swapVariables(
     std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& metaVariablePairs) const {
@@ -284,6 +284,21 @@ class Bdd : public Dd<LibraryType> {
                                                                   std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                   std::set<storm::expressions::Variable> const& columnMetaVariables) const;
 
+    /*!
+     * Extends the current BDD by all states that satisfy the given constraint and have a successor in the current BDD
+     * with respect to the given relation. The result equals *this || (constraint && inverseRelationalProduct(...)),
+     * but the operations are fused if the library supports it. Note that this operation makes the same assumptions
+     * as the inverse relational product.
+     *
+     * @param relation The relation to use.
+     * @param rowMetaVariables The row meta variables used in the relation.
+     * @param columnMetaVariables The column meta variables used in the relation.
+     * @param constraint The states that may be added.
+     * @return The extended BDD.
+     */
+    Bdd<LibraryType> inverseRelationalProductStep(Bdd<LibraryType> const& relation, std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                  std::set<storm::expressions::Variable> const& columnMetaVariables, Bdd<LibraryType> const& constraint) const;
+
     /*!
      * Swaps the given pairs of meta variables in the BDD. The pairs of meta variables must be guaranteed to have
      * the same number of underlying BDD variables.
@@ -254,6 +254,15 @@ InternalAdd<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::multi
     return this->multiplyMatrix(otherMatrix.template toAdd<ValueType>(), summationDdVariables);
 }
 
+template<typename ValueType>
+InternalAdd<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::multiplyMatrixAndMinMaxAbstract(
+    InternalAdd<DdType::CUDD, ValueType> const& vector, std::vector<InternalBdd<DdType::CUDD>> const& summationDdVariables,
+    InternalAdd<DdType::CUDD, ValueType> const& offset, InternalBdd<DdType::CUDD> const& cube, bool minimize) const {
+    // CUDD does not offer a fused operation, so we fall back to the individual operations.
+    InternalAdd<DdType::CUDD, ValueType> result = this->multiplyMatrix(vector, summationDdVariables) + offset;
+    return minimize ? result.minAbstract(cube) : result.maxAbstract(cube);
+}
+
 template<typename ValueType>
 InternalBdd<DdType::CUDD> InternalAdd<DdType::CUDD, ValueType>::greater(ValueType const& value) const {
     return InternalBdd<DdType::CUDD>(ddManager, this->getCuddAdd().BddStrictThreshold(value));
@@ -749,11 +758,12 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
 
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentRowLevel + currentColumnLevel == maxLevel) {
+        uint_fast64_t row = rowGroupOffsets.empty() ? currentRowOffset : rowGroupOffsets[currentRowOffset];
         if (generateValues) {
-            columnsAndValues[rowIndications[rowGroupOffsets[currentRowOffset]]] =
+            columnsAndValues[rowIndications[row]] =
                 storm::storage::MatrixEntry<uint_fast64_t, ValueType>(currentColumnOffset, storm::utility::convertNumber<ValueType>(Cudd_V(dd)));
         }
-        ++rowIndications[rowGroupOffsets[currentRowOffset]];
+        ++rowIndications[row];
     } else {
         DdNode const* elseElse;
         DdNode const* elseThen;
@@ -363,6 +363,22 @@ class InternalAdd<DdType::CUDD, ValueType> {
     InternalAdd<DdType::CUDD, ValueType> multiplyMatrix(InternalBdd<DdType::CUDD> const& otherMatrix,
                                                         std::vector<InternalBdd<DdType::CUDD>> const& summationDdVariables) const;
 
+    /*!
+     * Multiplies the current ADD (representing a matrix) with the given vector by summing over the given
+     * variables, adds the given offset and then abstracts the given cube by taking the minimum or maximum.
+     *
+     * @param vector The vector with which to multiply.
+     * @param summationDdVariables The DD variables (represented as ADDs) over which to sum.
+     * @param offset The ADD that is added to the result of the multiplication.
+     * @param cube The cube of variables to abstract by taking the minimum or maximum.
+     * @param minimize If set, the minimum is taken, otherwise the maximum.
+     * @return The resulting ADD.
+     */
+    InternalAdd<DdType::CUDD, ValueType> multiplyMatrixAndMinMaxAbstract(InternalAdd<DdType::CUDD, ValueType> const& vector,
+                                                                         std::vector<InternalBdd<DdType::CUDD>> const& summationDdVariables,
+                                                                         InternalAdd<DdType::CUDD, ValueType> const& offset,
+                                                                         InternalBdd<DdType::CUDD> const& cube, bool minimize) const;
+
     /*!
      * Computes a BDD that represents the function in which all assignments with a function value strictly
      * larger than the given value are mapped to one and all others to zero.
@@ -635,7 +651,7 @@ class InternalAdd<DdType::CUDD, ValueType> {
     /*!
      * Translates the ADD into the components needed for constructing a matrix.
      *
-     * @param rowGroupIndices The row group indices.
+     * @param rowGroupIndices The row group indices. If empty, every row forms its own group.
      * @param rowIndications The vector that is to be filled with the row indications.
      * @param columnsAndValues The vector that is to be filled with the non-zero entries of the matrix.
      * @param rowOdd The ODD used for translating the rows.
@@ -65,6 +65,13 @@ InternalBdd<DdType::CUDD> InternalBdd<DdType::CUDD>::inverseRelationalProductWit
     return this->inverseRelationalProduct(relation, rowVariables, columnVariables);
 }
 
+InternalBdd<DdType::CUDD> InternalBdd<DdType::CUDD>::inverseRelationalProductStep(InternalBdd<DdType::CUDD> const& relation,
+                                                                                  std::vector<InternalBdd<DdType::CUDD>> const& rowVariables,
+                                                                                  std::vector<InternalBdd<DdType::CUDD>> const& columnVariables,
+                                                                                  InternalBdd<DdType::CUDD> const& constraint) const {
+    return *this || (constraint && this->inverseRelationalProduct(relation, rowVariables, columnVariables));
+}
+
 InternalBdd<DdType::CUDD> InternalBdd<DdType::CUDD>::ite(InternalBdd<DdType::CUDD> const& thenDd, InternalBdd<DdType::CUDD> const& elseDd) const {
     return InternalBdd<DdType::CUDD>(ddManager, this->getCuddBdd().Ite(thenDd.getCuddBdd(), elseDd.getCuddBdd()));
 }
@@ -116,6 +116,22 @@ class InternalBdd<DdType::CUDD> {
                                                                            std::vector<InternalBdd<DdType::CUDD>> const& rowVariables,
                                                                            std::vector<InternalBdd<DdType::CUDD>> const& columnVariables) const;
 
+    /*!
+     * Extends the current BDD by all states that satisfy the given constraint and have a successor in the current
+     * BDD with respect to the given relation, i.e. computes this | (constraint & pre(this)). This is a single step
+     * of a backward reachability fixpoint.
+     *
+     * @param relation The relation to use.
+     * @param rowVariables The row variables of the relation represented as individual BDDs.
+     * @param columnVariables The column variables of the relation represented as individual BDDs.
+     * @param constraint The states that may be added.
+     * @return The extended BDD.
+     */
+    InternalBdd<DdType::CUDD> inverseRelationalProductStep(InternalBdd<DdType::CUDD> const& relation,
+                                                           std::vector<InternalBdd<DdType::CUDD>> const& rowVariables,
+                                                           std::vector<InternalBdd<DdType::CUDD>> const& columnVariables,
+                                                           InternalBdd<DdType::CUDD> const& constraint) const;
+
     /*!
      * Performs an if-then-else with the given operands, i.e. maps all valuations that are mapped to a non-zero
      * function value to the function values specified by the first DD and all others to the function values
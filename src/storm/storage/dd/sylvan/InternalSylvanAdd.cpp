@@ -1,5 +1,8 @@
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 
+#include <cmath>
+#include <exception>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/dd/DdManager.h"
@@ -19,6 +22,25 @@
 
 namespace storm {
 namespace dd {
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+
+VOID_TASK_2(execute_to_matrix_components, std::function<void()> const*, f, std::exception_ptr*, e) {
+    try {
+        (*f)();
+    } catch (std::exception& exception) {
+        *e = std::current_exception();
+    }
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
 template<typename ValueType>
 InternalAdd<DdType::Sylvan, ValueType>::InternalAdd() : ddManager(nullptr), sylvanMtbdd() {
     // Intentionally left empty.
@@ -708,6 +730,40 @@ InternalAdd<DdType::Sylvan, storm::RationalNumber> InternalAdd<DdType::Sylvan, s
         ddManager, this->sylvanMtbdd.AndExistsRN(sylvan::Bdd(otherMatrix.getSylvanBdd().GetBDD()), summationVariables.getSylvanBdd()));
 }
 
+template<typename ValueType>
+InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::multiplyMatrixAndMinMaxAbstract(
+    InternalAdd<DdType::Sylvan, ValueType> const& vector, std::vector<InternalBdd<DdType::Sylvan>> const& summationDdVariables,
+    InternalAdd<DdType::Sylvan, ValueType> const& offset, InternalBdd<DdType::Sylvan> const& cube, bool minimize) const {
+    InternalBdd<DdType::Sylvan> summationVariables = ddManager->getBddOne();
+    for (auto const& ddVariable : summationDdVariables) {
+        summationVariables &= ddVariable;
+    }
+
+    return InternalAdd<DdType::Sylvan, ValueType>(
+        ddManager, this->sylvanMtbdd.AndExistsPlusAbstractMinMax(vector.sylvanMtbdd, summationVariables.getSylvanBdd(), offset.sylvanMtbdd, cube.getSylvanBdd(),
+                                                                 minimize));
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+InternalAdd<DdType::Sylvan, storm::RationalFunction> InternalAdd<DdType::Sylvan, storm::RationalFunction>::multiplyMatrixAndMinMaxAbstract(
+    InternalAdd<DdType::Sylvan, storm::RationalFunction> const& vector, std::vector<InternalBdd<DdType::Sylvan>> const& summationDdVariables,
+    InternalAdd<DdType::Sylvan, storm::RationalFunction> const& offset, InternalBdd<DdType::Sylvan> const& cube, bool minimize) const {
+    // The fused operation only supports the built-in leaf types, so we fall back to the individual operations.
+    InternalAdd<DdType::Sylvan, storm::RationalFunction> result = this->multiplyMatrix(vector, summationDdVariables) + offset;
+    return minimize ? result.minAbstract(cube) : result.maxAbstract(cube);
+}
+#endif
+
+template<>
+InternalAdd<DdType::Sylvan, storm::RationalNumber> InternalAdd<DdType::Sylvan, storm::RationalNumber>::multiplyMatrixAndMinMaxAbstract(
+    InternalAdd<DdType::Sylvan, storm::RationalNumber> const& vector, std::vector<InternalBdd<DdType::Sylvan>> const& summationDdVariables,
+    InternalAdd<DdType::Sylvan, storm::RationalNumber> const& offset, InternalBdd<DdType::Sylvan> const& cube, bool minimize) const {
+    // The fused operation only supports the built-in leaf types, so we fall back to the individual operations.
+    InternalAdd<DdType::Sylvan, storm::RationalNumber> result = this->multiplyMatrix(vector, summationDdVariables) + offset;
+    return minimize ? result.minAbstract(cube) : result.maxAbstract(cube);
+}
+
 template<typename ValueType>
 InternalBdd<DdType::Sylvan> InternalAdd<DdType::Sylvan, ValueType>::greater(ValueType const& value) const {
     return InternalBdd<DdType::Sylvan>(ddManager, this->sylvanMtbdd.BddStrictThreshold(value));
@@ -1233,9 +1289,27 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
-                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+    // The subtrees for different row successors touch disjoint rows, so we let the lace workers fill them in
+    // parallel. Only the topmost row levels are split to keep the task overhead low.
+    uint_fast64_t parallelRowLevels = 0;
+    if (lace_workers() > 1) {
+        parallelRowLevels = std::min<uint_fast64_t>(ddRowVariableIndices.size(), static_cast<uint_fast64_t>(std::ceil(std::log2(lace_workers()))) + 3);
+    }
+
+    std::function<void()> fill = [&]() {
+        toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
+                              rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
+                              ddRowVariableIndices, ddColumnVariableIndices, writeValues, parallelRowLevels);
+    };
+    if (parallelRowLevels > 0) {
+        std::exception_ptr e = nullptr;  // propagate exception
+        RUN(execute_to_matrix_components, &fill, &e);
+        if (e) {
+            std::rethrow_exception(e);
+        }
+    } else {
+        fill();
+    }
 }
 
 template<typename ValueType>
@@ -1245,7 +1319,8 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
                                                                    Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel,
                                                                    uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                                                    uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues,
+                                                                   uint_fast64_t parallelRowLevels) const {
     // For the empty DD, we do not need to add any entries.
     if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
         return;
@@ -1253,11 +1328,12 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
 
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentRowLevel + currentColumnLevel == maxLevel) {
+        uint_fast64_t row = rowGroupOffsets.empty() ? currentRowOffset : rowGroupOffsets[currentRowOffset];
         if (generateValues) {
-            columnsAndValues[rowIndications[rowGroupOffsets[currentRowOffset]]] =
+            columnsAndValues[rowIndications[row]] =
                 storm::storage::MatrixEntry<uint_fast64_t, ValueType>(currentColumnOffset, negated ? -getValue(dd) : getValue(dd));
         }
-        ++rowIndications[rowGroupOffsets[currentRowOffset]];
+        ++rowIndications[row];
     } else {
         MTBDD elseElse;
         MTBDD elseThen;
@@ -1287,23 +1363,55 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
             }
         }
 
-        // Visit else-else.
-        toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-        // Visit else-then.
-        toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-        // Visit then-else.
-        toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
-                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-        // Visit then-then.
-        toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
-                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
-                              ddColumnVariableIndices, generateValues);
+        auto visitElseRows = [&]() {
+            // Visit else-else.
+            toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
+                                  rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
+                                  currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues, parallelRowLevels);
+            // Visit else-then.
+            toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
+                                  rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
+                                  currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices,
+                                  generateValues, parallelRowLevels);
+        };
+        auto visitThenRows = [&]() {
+            // Visit then-else.
+            toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
+                                  rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
+                                  currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices,
+                                  generateValues, parallelRowLevels);
+            // Visit then-then.
+            toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
+                                  rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
+                                  currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
+                                  ddColumnVariableIndices, generateValues, parallelRowLevels);
+        };
+
+        if (currentRowLevel < parallelRowLevels) {
+            // The else and then rows are disjoint, so they can be filled concurrently. The order of the columns
+            // within each row is preserved, because the column successors are still visited in order.
+            // Exceptions must not leave a lace task, so they are passed on after the spawned task was synchronized.
+            std::function<void()> visitThenRowsTask = visitThenRows;
+            std::exception_ptr thenRowsException = nullptr;
+            std::exception_ptr elseRowsException = nullptr;
+            LACE_VARS;
+            SPAWN(execute_to_matrix_components, &visitThenRowsTask, &thenRowsException);
+            try {
+                visitElseRows();
+            } catch (std::exception& exception) {
+                elseRowsException = std::current_exception();
+            }
+            SYNC(execute_to_matrix_components);
+            if (elseRowsException) {
+                std::rethrow_exception(elseRowsException);
+            }
+            if (thenRowsException) {
+                std::rethrow_exception(thenRowsException);
+            }
+        } else {
+            visitElseRows();
+            visitThenRows();
+        }
     }
 }
 
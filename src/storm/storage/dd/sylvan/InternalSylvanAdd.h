@@ -354,6 +354,22 @@ class InternalAdd<DdType::Sylvan, ValueType> {
     InternalAdd<DdType::Sylvan, ValueType> multiplyMatrix(InternalBdd<DdType::Sylvan> const& otherMatrix,
                                                           std::vector<InternalBdd<DdType::Sylvan>> const& summationDdVariables) const;
 
+    /*!
+     * Multiplies the current ADD (representing a matrix) with the given vector by summing over the given
+     * variables, adds the given offset and then abstracts the given cube by taking the minimum or maximum.
+     *
+     * @param vector The vector with which to multiply.
+     * @param summationDdVariables The DD variables (represented as ADDs) over which to sum.
+     * @param offset The ADD that is added to the result of the multiplication.
+     * @param cube The cube of variables to abstract by taking the minimum or maximum.
+     * @param minimize If set, the minimum is taken, otherwise the maximum.
+     * @return The resulting ADD.
+     */
+    InternalAdd<DdType::Sylvan, ValueType> multiplyMatrixAndMinMaxAbstract(InternalAdd<DdType::Sylvan, ValueType> const& vector,
+                                                                           std::vector<InternalBdd<DdType::Sylvan>> const& summationDdVariables,
+                                                                           InternalAdd<DdType::Sylvan, ValueType> const& offset,
+                                                                           InternalBdd<DdType::Sylvan> const& cube, bool minimize) const;
+
     /*!
      * Computes a BDD that represents the function in which all assignments with a function value strictly
      * larger than the given value are mapped to one and all others to zero.
@@ -627,7 +643,7 @@ class InternalAdd<DdType::Sylvan, ValueType> {
     /*!
      * Translates the ADD into the components needed for constructing a matrix.
      *
-     * @param rowGroupIndices The row group indices.
+     * @param rowGroupIndices The row group indices. If empty, every row forms its own group.
      * @param rowIndications The vector that is to be filled with the row indications.
      * @param columnsAndValues The vector that is to be filled with the non-zero entries of the matrix.
      * @param rowOdd The ODD used for translating the rows.
@@ -806,12 +822,14 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param generateValues If set to true, the vector columnsAndValues is filled with the actual entries, which
      * only works if the offsets given in rowIndications are already correct. If they need to be computed first,
      * this flag needs to be false.
+     * @param parallelRowLevels The number of topmost row levels at which the subtrees for the two row successors are
+     * processed in parallel.
      */
     void toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications,
                                std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
                                uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
+                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues, uint_fast64_t parallelRowLevels) const;
 
     /*!
      * Retrieves the sylvan representation of the given double value.
@@ -119,6 +119,14 @@ InternalBdd<DdType::Sylvan> InternalBdd<DdType::Sylvan>::inverseRelationalProduc
     return this->swapVariables(rowVariables, columnVariables).andExists(relation, columnCube);
 }
 
+InternalBdd<DdType::Sylvan> InternalBdd<DdType::Sylvan>::inverseRelationalProductStep(InternalBdd<DdType::Sylvan> const& relation,
+                                                                                      std::vector<InternalBdd<DdType::Sylvan>> const&,
+                                                                                      std::vector<InternalBdd<DdType::Sylvan>> const&,
+                                                                                      InternalBdd<DdType::Sylvan> const& constraint) const {
+    sylvan::Bdd predecessors = this->sylvanBdd.RelPrev(relation.sylvanBdd, sylvan::Bdd(sylvan_false));
+    return InternalBdd<DdType::Sylvan>(ddManager, this->sylvanBdd.OrAnd(constraint.sylvanBdd, predecessors));
+}
+
 InternalBdd<DdType::Sylvan> InternalBdd<DdType::Sylvan>::ite(InternalBdd<DdType::Sylvan> const& thenDd, InternalBdd<DdType::Sylvan> const& elseDd) const {
     return InternalBdd<DdType::Sylvan>(ddManager, this->sylvanBdd.Ite(thenDd.sylvanBdd, elseDd.sylvanBdd));
 }
@@ -106,6 +106,22 @@ class InternalBdd<DdType::Sylvan> {
                                                                              std::vector<InternalBdd<DdType::Sylvan>> const& rowVariables,
                                                                              std::vector<InternalBdd<DdType::Sylvan>> const& columnVariables) const;
 
+    /*!
+     * Extends the current BDD by all states that satisfy the given constraint and have a successor in the current
+     * BDD with respect to the given relation, i.e. computes this | (constraint & pre(this)). This is a single step
+     * of a backward reachability fixpoint.
+     *
+     * @param relation The relation to use.
+     * @param rowVariables The row variables of the relation represented as individual BDDs.
+     * @param columnVariables The column variables of the relation represented as individual BDDs.
+     * @param constraint The states that may be added.
+     * @return The extended BDD.
+     */
+    InternalBdd<DdType::Sylvan> inverseRelationalProductStep(InternalBdd<DdType::Sylvan> const& relation,
+                                                             std::vector<InternalBdd<DdType::Sylvan>> const& rowVariables,
+                                                             std::vector<InternalBdd<DdType::Sylvan>> const& columnVariables,
+                                                             InternalBdd<DdType::Sylvan> const& constraint) const;
+
     /*!
      * Performs an if-then-else with the given operands, i.e. maps all valuations that are mapped to a non-zero
      * function value to the function values specified by the first DD and all others to the function values
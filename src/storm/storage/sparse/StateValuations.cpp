@@ -312,6 +312,15 @@ std::size_t StateValuations::hash() const {
     return 0;
 }
 
+std::size_t StateValuations::getSizeInBytes() const {
+    std::size_t result = sizeof(*this) + sizeof(StateValuation) * valuations.capacity();
+    for (auto const& valuation : valuations) {
+        result += valuation.booleanValues.capacity() / 8 + sizeof(int64_t) * valuation.integerValues.capacity() +
+                  sizeof(storm::RationalNumber) * valuation.rationalValues.capacity() + sizeof(int64_t) * valuation.observationLabelValues.capacity();
+    }
+    return result;
+}
+
 StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
     return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
 }
@@ -137,6 +137,11 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
 
     virtual std::size_t hash() const;
 
+    /*!
+     * Returns (an approximation of) the size of the state valuations measured in bytes.
+     */
+    std::size_t getSizeInBytes() const;
+
    private:
     StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
     bool assertValuation(StateValuation const& valuation) const;
@@ -76,7 +76,7 @@ std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmc
             labelling.addLabel(expressionLabel.first, symbolicDtmc.getStates(expressionLabel.second).toVector(this->odd));
         }
     }
-    return std::make_shared<storm::models::sparse::Dtmc<ValueType>>(transitionMatrix, labelling, rewardModels);
+    return std::make_shared<storm::models::sparse::Dtmc<ValueType>>(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels));
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -146,7 +146,7 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
         }
     }
 
-    return std::make_shared<storm::models::sparse::Mdp<ValueType>>(transitionMatrix, labelling, rewardModels);
+    return std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels));
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -189,7 +189,7 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmc
         }
     }
 
-    return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(transitionMatrix, labelling, rewardModels);
+    return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels));
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -0,0 +1,226 @@
+#include "storm/utility/MemoryAccounting.h"
+
+#include <sys/resource.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+#ifdef MACOS
+#include <mach/mach.h>
+#endif
+
+namespace storm {
+namespace utility {
+namespace memory {
+
+namespace detail {
+std::atomic<bool> enabled{false};
+std::atomic<uint64_t> numberOfAllocations{0};
+std::atomic<uint64_t> softLimit{0};
+std::atomic<std::thread::id> accountingThread;
+
+namespace {
+struct Stage {
+    Stage(std::string const& name, uint64_t depth) : name(name), depth(depth) {
+        // Intentionally left empty.
+    }
+
+    std::string name;
+    uint64_t depth;
+    uint64_t calls{0};
+    int64_t residentDelta{0};
+    uint64_t peakResident{0};
+    uint64_t allocations{0};
+    std::map<std::string, uint64_t> structureSizes;
+    // The indices of the sub-stages (in the order in which they were entered first) and a mapping from their names to their index.
+    std::vector<uint64_t> children;
+    std::map<std::string, uint64_t> childIndices;
+};
+
+struct ActiveStage {
+    uint64_t index;
+    uint64_t residentAtStart;
+    uint64_t allocationsAtStart;
+};
+
+// Guards the stages, which may be printed from any thread once the soft limit is exceeded.
+std::mutex mutex;
+// The first stage is an artificial root stage that is never entered.
+std::vector<Stage> stages = {Stage("", 0)};
+// Stages are only entered and left on the accounting thread, so the active stages are not guarded by the mutex.
+std::vector<ActiveStage> activeStages;
+
+std::atomic<int64_t> lastSoftLimitCheck{0};
+std::atomic<bool> softLimitExceeded{false};
+
+std::string formatBytes(int64_t bytes) {
+    std::stringstream stream;
+    uint64_t absoluteBytes = bytes < 0 ? -bytes : bytes;
+    if (absoluteBytes >= 1024 * 1024) {
+        stream << std::fixed << std::setprecision(1) << bytes / (1024.0 * 1024.0) << "MB";
+    } else if (absoluteBytes >= 1024) {
+        stream << std::fixed << std::setprecision(1) << bytes / 1024.0 << "KB";
+    } else {
+        stream << bytes << "B";
+    }
+    return stream.str();
+}
+
+void printStage(std::ostream& out, Stage const& stage) {
+    std::string indentation(2 * (stage.depth + 1), ' ');
+    out << indentation << "* " << stage.name << " (" << stage.calls << "x): ";
+    if (stage.depth == 0) {
+        out << "resident " << (stage.residentDelta >= 0 ? "+" : "") << formatBytes(stage.residentDelta) << ", ";
+    }
+    out << "peak " << formatBytes(stage.peakResident);
+    if (stage.allocations > 0) {
+        out << ", " << stage.allocations << " allocations";
+    }
+    out << '\n';
+    for (auto const& structure : stage.structureSizes) {
+        out << indentation << "    - " << structure.first << ": " << formatBytes(structure.second) << '\n';
+    }
+    for (auto const& child : stage.children) {
+        printStage(out, stages[child]);
+    }
+}
+}  // namespace
+
+void enterStage(std::string const& name) {
+    // Determining the resident size requires reading a file, so this is only done at the boundaries of top-level stages.
+    uint64_t residentAtStart = activeStages.empty() ? getResidentSize() : 0;
+    uint64_t index;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        uint64_t parent = activeStages.empty() ? 0 : activeStages.back().index;
+        auto childIt = stages[parent].childIndices.find(name);
+        if (childIt == stages[parent].childIndices.end()) {
+            index = stages.size();
+            stages.emplace_back(name, activeStages.size());
+            stages[parent].children.push_back(index);
+            stages[parent].childIndices.emplace(name, index);
+        } else {
+            index = childIt->second;
+        }
+    }
+    activeStages.push_back({index, residentAtStart, numberOfAllocations.load(std::memory_order_relaxed)});
+    isSoftLimitExceeded();
+}
+
+void leaveStage() {
+    STORM_LOG_ASSERT(!activeStages.empty(), "Left a memory stage that was never entered.");
+    ActiveStage active = activeStages.back();
+    activeStages.pop_back();
+    int64_t residentDelta = activeStages.empty() ? static_cast<int64_t>(getResidentSize()) - static_cast<int64_t>(active.residentAtStart) : 0;
+    uint64_t peakResident = getPeakResidentSize();
+    uint64_t allocations = numberOfAllocations.load(std::memory_order_relaxed) - active.allocationsAtStart;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Stage& stage = stages[active.index];
+        stage.calls += 1;
+        stage.residentDelta += residentDelta;
+        stage.peakResident = std::max(stage.peakResident, peakResident);
+        stage.allocations += allocations;
+    }
+    isSoftLimitExceeded();
+}
+
+bool checkSoftLimit() {
+    if (softLimitExceeded.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    // Only determine the resident size every few milliseconds.
+    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t lastCheck = lastSoftLimitCheck.load(std::memory_order_relaxed);
+    if (now - lastCheck < 10 || !lastSoftLimitCheck.compare_exchange_strong(lastCheck, now)) {
+        return false;
+    }
+    uint64_t resident = getResidentSize();
+    if (resident > softLimit.load(std::memory_order_relaxed) && !softLimitExceeded.exchange(true)) {
+        STORM_LOG_ERROR("The resident memory (" << formatBytes(resident) << ") exceeds the soft memory limit of "
+                                                << formatBytes(softLimit.load(std::memory_order_relaxed)) << ". Aborting the computation.");
+        printReport(std::cerr);
+        storm::utility::resources::SignalInformation::infos().setTerminate(true);
+    }
+    return softLimitExceeded.load(std::memory_order_relaxed);
+}
+}  // namespace detail
+
+uint64_t getResidentSize() {
+#if defined LINUX
+    // The second entry of statm is the number of resident pages.
+    std::ifstream statm("/proc/self/statm");
+    uint64_t totalPages = 0, residentPages = 0;
+    if (statm >> totalPages >> residentPages) {
+        return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+    return 0;
+#elif defined MACOS
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        return info.resident_size;
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+uint64_t getPeakResidentSize() {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    return ru.ru_maxrss;
+#else
+    // For Linux, this is returned in kilobytes.
+    return ru.ru_maxrss * 1024;
+#endif
+}
+
+void enable() {
+    detail::accountingThread = std::this_thread::get_id();
+    detail::enabled = true;
+}
+
+void setSoftLimit(uint64_t bytes) {
+    enable();
+    detail::softLimit = bytes;
+}
+
+void recordStructureSize(std::string const& name, uint64_t bytes) {
+    if (isEnabled() && detail::isAccountingThread()) {
+        std::lock_guard<std::mutex> lock(detail::mutex);
+        uint64_t index = detail::activeStages.empty() ? 0 : detail::activeStages.back().index;
+        detail::stages[index].structureSizes[name] = bytes;
+    }
+}
+
+void printReport(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(detail::mutex);
+    out << "\nMemory statistics per stage:\n";
+    for (auto const& child : detail::stages.front().children) {
+        detail::printStage(out, detail::stages[child]);
+    }
+    for (auto const& structure : detail::stages.front().structureSizes) {
+        out << "  - " << structure.first << ": " << detail::formatBytes(structure.second) << '\n';
+    }
+    out << "  current resident size: " << detail::formatBytes(getResidentSize()) << ", peak resident size: " << detail::formatBytes(getPeakResidentSize())
+        << '\n';
+}
+
+}  // namespace memory
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <thread>
+
+namespace storm {
+namespace utility {
+namespace memory {
+
+namespace detail {
+extern std::atomic<bool> enabled;
+extern std::atomic<uint64_t> numberOfAllocations;
+extern std::atomic<uint64_t> softLimit;
+extern std::atomic<std::thread::id> accountingThread;
+
+inline bool isAccountingThread() {
+    return std::this_thread::get_id() == accountingThread.load(std::memory_order_relaxed);
+}
+
+void enterStage(std::string const& name);
+void leaveStage();
+bool checkSoftLimit();
+}  // namespace detail
+
+/*!
+ * Retrieves the resident set size of this process, i.e., the amount of physical memory that is currently used.
+ *
+ * @return The resident set size in bytes (or zero if it can not be determined on this operating system).
+ */
+uint64_t getResidentSize();
+
+/*!
+ * Retrieves the maximal resident set size of this process so far.
+ *
+ * @return The peak resident set size in bytes.
+ */
+uint64_t getPeakResidentSize();
+
+/*!
+ * Enables the memory accounting of stages. Stages are only accounted on the calling thread.
+ */
+void enable();
+
+/*!
+ * Retrieves whether memory is accounted. If not, stages and recorded sizes do nothing except for this check.
+ */
+inline bool isEnabled() {
+    return detail::enabled.load(std::memory_order_relaxed);
+}
+
+/*!
+ * Counts a single allocation. Executables that want to report the number of allocations per stage call this from their (replaced) global allocation
+ * functions. As this is invoked for every allocation, it must not allocate itself.
+ */
+inline void countAllocation() {
+    if (isEnabled()) {
+        detail::numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/*!
+ * Sets a soft memory limit (which also enables the memory accounting). Once the resident set size exceeds this limit, the memory report is printed and
+ * the program is asked to terminate, i.e., running computations are aborted gracefully.
+ *
+ * @param bytes The limit in bytes.
+ */
+void setSoftLimit(uint64_t bytes);
+
+/*!
+ * Checks whether the soft memory limit (if any) is exceeded. As this is supposed to be called frequently (e.g. once per iteration of a solver), the
+ * resident set size is only determined every few milliseconds.
+ *
+ * @return True iff a soft limit is set and it has been exceeded.
+ */
+inline bool isSoftLimitExceeded() {
+    if (detail::softLimit.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    return detail::checkSoftLimit();
+}
+
+/*!
+ * Records the size of a data structure (e.g. the transition matrix) for the innermost stage that is currently active. Sizes that are recorded
+ * on other threads than the one that enabled the memory accounting are ignored.
+ *
+ * @param name A description of the data structure.
+ * @param bytes The size of the data structure in bytes.
+ */
+void recordStructureSize(std::string const& name, uint64_t bytes);
+
+/*!
+ * Prints the statistics of all stages that have been entered so far, i.e., the change of the resident set size (for top-level stages), the peak
+ * resident set size, the number of allocations and the recorded structure sizes.
+ */
+void printReport(std::ostream& out);
+
+/*!
+ * Accounts the memory that is acquired between construction and destruction as a (named) stage. Stages can be nested.
+ * Stages with the same name (and the same enclosing stages) are merged. As the resident set size is a property of the whole process, stages are only
+ * accounted on the thread that enabled the memory accounting (stages entered by e.g. parallel solvers are ignored) and the change of the resident set
+ * size is only determined for top-level stages.
+ */
+class MemoryStage {
+   public:
+    explicit MemoryStage(std::string const& name) : active(isEnabled() && detail::isAccountingThread()) {
+        if (active) {
+            detail::enterStage(name);
+        }
+    }
+
+    ~MemoryStage() {
+        if (active) {
+            detail::leaveStage();
+        }
+    }
+
+    MemoryStage(MemoryStage const&) = delete;
+    MemoryStage& operator=(MemoryStage const&) = delete;
+
+   private:
+    bool active;
+};
+
+}  // namespace memory
+}  // namespace utility
+}  // namespace storm
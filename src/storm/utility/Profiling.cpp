@@ -0,0 +1,213 @@
+#include "storm/utility/Profiling.h"
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/io/file.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+namespace profiling {
+
+namespace detail {
+std::atomic<bool> enabled{false};
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+struct ScopeNode {
+    ScopeNode(char const* name, ScopeNode* parent) : name(name), parent(parent) {
+        // Intentionally left empty.
+    }
+
+    char const* name;
+    ScopeNode* parent;
+    uint64_t calls{0};
+    std::chrono::nanoseconds time{0};
+    // Names are string literals, so we can use their address as key. Equal names with different addresses are merged upon export.
+    std::unordered_map<char const*, std::unique_ptr<ScopeNode>> children;
+};
+
+struct Event {
+    char const* name;
+    std::chrono::nanoseconds start;
+    std::chrono::nanoseconds duration;
+};
+
+/*!
+ * The data collected by a single thread. The mutex is only contended while the data is exported.
+ */
+struct ThreadData {
+    ThreadData(uint64_t index) : index(index), root(nullptr, nullptr), current(&root) {
+        // Intentionally left empty.
+    }
+
+    std::mutex mutex;
+    uint64_t index;
+    ScopeNode root;
+    ScopeNode* current;
+    std::vector<Clock::time_point> startTimes;
+    std::unordered_map<char const*, uint64_t> counters;
+    std::vector<Event> events;
+};
+
+std::mutex registryMutex;
+std::vector<std::shared_ptr<ThreadData>> registry;
+Clock::time_point epoch = Clock::now();
+std::atomic<bool> recordEvents{false};
+
+ThreadData& getThreadData() {
+    // The registry shares ownership so that the data of terminated threads is still exported.
+    thread_local std::shared_ptr<ThreadData> data = [] {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        registry.push_back(std::make_shared<ThreadData>(registry.size()));
+        return registry.back();
+    }();
+    return *data;
+}
+
+/*!
+ * The scopes of all threads merged by name.
+ */
+struct MergedNode {
+    uint64_t calls{0};
+    std::chrono::nanoseconds time{0};
+    std::map<std::string, MergedNode> children;
+};
+
+void merge(ScopeNode const& node, MergedNode& target) {
+    target.calls += node.calls;
+    target.time += node.time;
+    for (auto const& child : node.children) {
+        merge(*child.second, target.children[child.first]);
+    }
+}
+
+storm::json<double> toJson(std::map<std::string, MergedNode> const& nodes) {
+    storm::json<double> result = storm::json<double>::array();
+    for (auto const& [name, node] : nodes) {
+        storm::json<double> entry;
+        entry["name"] = name;
+        entry["calls"] = node.calls;
+        entry["time-ms"] = std::chrono::duration<double, std::milli>(node.time).count();
+        if (!node.children.empty()) {
+            entry["children"] = toJson(node.children);
+        }
+        result.push_back(std::move(entry));
+    }
+    return result;
+}
+}  // namespace
+
+void enterScope(char const* name) {
+    ThreadData& data = getThreadData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    auto& child = data.current->children[name];
+    if (!child) {
+        child = std::make_unique<ScopeNode>(name, data.current);
+    }
+    data.current = child.get();
+    data.startTimes.push_back(Clock::now());
+}
+
+void leaveScope() {
+    auto end = Clock::now();
+    ThreadData& data = getThreadData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    STORM_LOG_ASSERT(!data.startTimes.empty(), "Left a profiling scope that was never entered.");
+    auto duration = end - data.startTimes.back();
+    data.current->calls += 1;
+    data.current->time += duration;
+    if (recordEvents.load(std::memory_order_relaxed)) {
+        data.events.push_back({data.current->name, data.startTimes.back() - epoch, duration});
+    }
+    data.startTimes.pop_back();
+    data.current = data.current->parent;
+}
+
+void addToCounter(char const* name, uint64_t value) {
+    ThreadData& data = getThreadData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.counters[name] += value;
+}
+}  // namespace detail
+
+void enable(bool recordEvents) {
+    detail::recordEvents = recordEvents;
+    detail::enabled = true;
+}
+
+void disable() {
+    detail::enabled = false;
+}
+
+storm::json<double> toJson() {
+    detail::MergedNode root;
+    std::map<std::string, uint64_t> counters;
+    std::lock_guard<std::mutex> registryLock(detail::registryMutex);
+    for (auto const& data : detail::registry) {
+        std::lock_guard<std::mutex> lock(data->mutex);
+        detail::merge(data->root, root);
+        for (auto const& counter : data->counters) {
+            counters[counter.first] += counter.second;
+        }
+    }
+
+    storm::json<double> result;
+    result["scopes"] = detail::toJson(root.children);
+    result["counters"] = storm::json<double>::object();
+    for (auto const& counter : counters) {
+        result["counters"][counter.first] = counter.second;
+    }
+    result["threads"] = detail::registry.size();
+    return result;
+}
+
+storm::json<double> toChromeTrace() {
+    storm::json<double> events = storm::json<double>::array();
+    std::map<std::string, uint64_t> counters;
+    std::lock_guard<std::mutex> registryLock(detail::registryMutex);
+    for (auto const& data : detail::registry) {
+        std::lock_guard<std::mutex> lock(data->mutex);
+        for (auto const& event : data->events) {
+            storm::json<double> entry;
+            entry["name"] = event.name;
+            entry["ph"] = "X";
+            entry["ts"] = std::chrono::duration<double, std::micro>(event.start).count();
+            entry["dur"] = std::chrono::duration<double, std::micro>(event.duration).count();
+            entry["pid"] = 0;
+            entry["tid"] = data->index;
+            events.push_back(std::move(entry));
+        }
+        for (auto const& counter : data->counters) {
+            counters[counter.first] += counter.second;
+        }
+    }
+
+    storm::json<double> result;
+    result["traceEvents"] = std::move(events);
+    result["displayTimeUnit"] = "ms";
+    result["otherData"] = storm::json<double>::object();
+    for (auto const& counter : counters) {
+        result["otherData"][counter.first] = counter.second;
+    }
+    return result;
+}
+
+void exportToFile(std::string const& filename, bool chromeTrace) {
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream);
+    stream << storm::dumpJson(chromeTrace ? toChromeTrace() : toJson(), chromeTrace) << '\n';
+    storm::utility::closeFile(stream);
+}
+
+}  // namespace profiling
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "storm/adapters/JsonForward.h"
+
+namespace storm {
+namespace utility {
+namespace profiling {
+
+namespace detail {
+extern std::atomic<bool> enabled;
+
+void enterScope(char const* name);
+void leaveScope();
+void addToCounter(char const* name, uint64_t value);
+}  // namespace detail
+
+/*!
+ * Enables the collection of profiling data.
+ *
+ * @param recordEvents If true, each entered scope is additionally recorded as an individual event, which is required for the Chrome trace export.
+ */
+void enable(bool recordEvents = false);
+
+/*!
+ * Disables the collection of profiling data. Data that has been collected so far is kept.
+ */
+void disable();
+
+/*!
+ * Retrieves whether profiling data is collected. If not, scopes and counters do nothing except for this check.
+ */
+inline bool isEnabled() {
+    return detail::enabled.load(std::memory_order_relaxed);
+}
+
+/*!
+ * Increases the counter with the given name by the given value.
+ */
+inline void addToCounter(char const* name, uint64_t value = 1) {
+    if (isEnabled()) {
+        detail::addToCounter(name, value);
+    }
+}
+
+/*!
+ * Measures the time between its construction and destruction as a (named) scope.
+ * Scopes are nested hierarchically, i.e., a scope entered while another scope of the same thread is active is considered a sub-scope.
+ * Scopes entered on a worker thread appear at the top level of that thread.
+ */
+class ProfilingScope {
+   public:
+    /*!
+     * @param name The name of the scope. As the name is kept until the data is exported, it has to be a string literal.
+     */
+    explicit ProfilingScope(char const* name) : active(isEnabled()) {
+        if (active) {
+            detail::enterScope(name);
+        }
+    }
+
+    ~ProfilingScope() {
+        if (active) {
+            detail::leaveScope();
+        }
+    }
+
+    ProfilingScope(ProfilingScope const&) = delete;
+    ProfilingScope& operator=(ProfilingScope const&) = delete;
+
+   private:
+    bool active;
+};
+
+/*!
+ * Retrieves the collected data, i.e., the hierarchy of scopes (merged over all threads) with their number of calls and accumulated time as well as all
+ * counters.
+ */
+storm::json<double> toJson();
+
+/*!
+ * Retrieves the recorded events in the Chrome trace event format (which can be viewed with chrome://tracing or Perfetto).
+ * Only contains events if profiling was enabled with recordEvents set.
+ */
+storm::json<double> toChromeTrace();
+
+/*!
+ * Writes the collected data to the given file, either as hierarchical summary (see toJson()) or as Chrome trace (see toChromeTrace()).
+ */
+void exportToFile(std::string const& filename, bool chromeTrace = false);
+
+}  // namespace profiling
+}  // namespace utility
+}  // namespace storm
+
+#define STORM_PROFILE_CONCAT_INNER(a, b) a##b
+#define STORM_PROFILE_CONCAT(a, b) STORM_PROFILE_CONCAT_INNER(a, b)
+
+/*!
+ * Profiles the remainder of the current block as a scope with the given name (which must be a string literal).
+ */
+#define STORM_PROFILE_SCOPE(name) storm::utility::profiling::ProfilingScope STORM_PROFILE_CONCAT(stormProfilingScope, __LINE__)(name)
+
+/*!
+ * Increases the profiling counter with the given name (which must be a string literal) by the given value.
+ */
+#define STORM_PROFILE_COUNT(name, value) storm::utility::profiling::addToCounter(name, value)
@@ -959,6 +959,20 @@ template typename NumberTraits<double>::IntegerType trunc(double const& number);
 template double mod(double const& first, double const& second);
 template std::string to_string(double const& value);
 
+// float (only used for the low precision phase of mixed precision value iteration)
+template float one();
+template float zero();
+template float infinity();
+template bool isOne(float const& value);
+template bool isZero(float const& value);
+template bool isAlmostZero(float const& value);
+template bool isAlmostOne(float const& value);
+template float max(float const& first, float const& second);
+template float min(float const& first, float const& second);
+template float abs(float const& number);
+template float convertNumber(double const&);
+template double convertNumber(float const&);
+
 // int
 template int one();
 template int zero();
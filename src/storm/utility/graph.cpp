@@ -318,9 +318,20 @@ std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& t
     return distances;
 }
 
-template<typename T>
-storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                              storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+namespace {
+// The backward transitions are either given as a matrix or by their structure only. These functions retrieve the predecessor state of an entry.
+template<typename IndexType, typename ValueType>
+uint64_t getPredecessor(storm::storage::MatrixEntry<IndexType, ValueType> const& entry) {
+    return entry.getColumn();
+}
+
+uint64_t getPredecessor(storm::storage::SparseAdjacency::index_type predecessor) {
+    return predecessor;
+}
+
+template<typename BackwardTransitionsType>
+storm::storage::BitVector performProbGreater0Impl(BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                  storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
     // Prepare the resulting bit vector.
     uint_fast64_t numberOfStates = phiStates.size();
     storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
@@ -357,20 +368,19 @@ storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> co
             }
         }
 
-        for (typename storm::storage::SparseMatrix<T>::const_iterator entryIt = backwardTransitions.begin(currentState),
-                                                                      entryIte = backwardTransitions.end(currentState);
-             entryIt != entryIte; ++entryIt) {
-            if (phiStates[entryIt->getColumn()] &&
-                (!statesWithProbabilityGreater0.get(entryIt->getColumn()) || (useStepBound && remainingSteps[entryIt->getColumn()] < currentStepBound - 1))) {
-                statesWithProbabilityGreater0.set(entryIt->getColumn(), true);
+        for (auto const& predecessorEntry : backwardTransitions.getRow(currentState)) {
+            uint64_t predecessor = getPredecessor(predecessorEntry);
+            if (phiStates[predecessor] &&
+                (!statesWithProbabilityGreater0.get(predecessor) || (useStepBound && remainingSteps[predecessor] < currentStepBound - 1))) {
+                statesWithProbabilityGreater0.set(predecessor, true);
 
                 // If we don't have a bound on the number of steps to take, just add the state to the stack.
                 if (useStepBound) {
                     // As there is at least one more step to go, we need to push the state and the new number of steps.
-                    remainingSteps[entryIt->getColumn()] = currentStepBound - 1;
+                    remainingSteps[predecessor] = currentStepBound - 1;
                     stepStack.push_back(currentStepBound - 1);
                 }
-                stack.push_back(entryIt->getColumn());
+                stack.push_back(predecessor);
             }
         }
     }
@@ -378,6 +388,18 @@ storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> co
     // Return result.
     return statesWithProbabilityGreater0;
 }
+}  // namespace
+
+template<typename T>
+storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+    return performProbGreater0Impl(backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+}
+
+storm::storage::BitVector performProbGreater0(storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+    return performProbGreater0Impl(backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+}
 
 template<typename T>
 storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const&,
@@ -396,20 +418,39 @@ storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& ba
     return statesWithProbability1;
 }
 
+storm::storage::BitVector performProb1(storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const&,
+                                       storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0) {
+    storm::storage::BitVector statesWithProbability1 = performProbGreater0(backwardTransitions, ~psiStates, ~statesWithProbabilityGreater0);
+    statesWithProbability1.complement();
+    return statesWithProbability1;
+}
+
+storm::storage::BitVector performProb1(storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                       storm::storage::BitVector const& psiStates) {
+    storm::storage::BitVector statesWithProbabilityGreater0 = performProbGreater0(backwardTransitions, phiStates, psiStates);
+    return performProb1(backwardTransitions, phiStates, psiStates, statesWithProbabilityGreater0);
+}
+
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::models::sparse::DeterministicModel<T> const& model,
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
+    // The structure of the backward transitions suffices and is possibly cached by the model.
+    return model.applyToBackwardTransitions([&](auto const& backwardTransitions) { return performProb01(backwardTransitions, phiStates, psiStates); });
+}
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-    storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
     result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
     result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
     result.first.complement();
     return result;
 }
 
-template<typename T>
-std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseAdjacency const& backwardTransitions,
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
@@ -436,9 +477,7 @@ storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, Va
 
         lastIterationStates = statesWithProbabilityGreater0;
         statesWithProbabilityGreater0 =
-            statesWithProbabilityGreater0.inverseRelationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
-        statesWithProbabilityGreater0 &= phiStates;
-        statesWithProbabilityGreater0 |= lastIterationStates;
+            statesWithProbabilityGreater0.inverseRelationalProductStep(transitionMatrix, model.getRowVariables(), model.getColumnVariables(), phiStates);
         ++iterations;
     }
 
@@ -538,10 +577,11 @@ void computeSchedulerWithOneSuccessorInStates(storm::storage::BitVector const& s
     }
 }
 
-template<typename T, typename SchedulerValueType>
-void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparseMatrix<T> const& backwardTransitions,
-                                   storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                   storm::storage::Scheduler<SchedulerValueType>& scheduler, boost::optional<storm::storage::BitVector> const& rowFilter) {
+namespace {
+template<typename T, typename BackwardTransitionsType, typename SchedulerValueType>
+void computeSchedulerProbGreater0EImpl(storm::storage::SparseMatrix<T> const& transitionMatrix, BackwardTransitionsType const& backwardTransitions,
+                                       storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                       storm::storage::Scheduler<SchedulerValueType>& scheduler, boost::optional<storm::storage::BitVector> const& rowFilter) {
     // Perform backwards DFS from psiStates and find a valid choice for each visited state.
 
     std::vector<uint_fast64_t> stack;
@@ -553,10 +593,8 @@ void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<T> const& transi
         currentState = stack.back();
         stack.pop_back();
 
-        for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState),
-                                                                      predecessorEntryIte = backwardTransitions.end(currentState);
-             predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-            uint_fast64_t const& predecessor = predecessorEntryIt->getColumn();
+        for (auto const& predecessorEntry : backwardTransitions.getRow(currentState)) {
+            uint64_t predecessor = getPredecessor(predecessorEntry);
             if (phiStates.get(predecessor) && !currentStates.get(predecessor)) {
                 // The predecessor is a probGreater0E state that has not been considered yet. Let's find the right choice that leads to a state in
                 // currentStates.
@@ -589,15 +627,9 @@ void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<T> const& transi
     }
 }
 
-template<typename T, typename SchedulerValueType>
-void computeSchedulerProb0E(storm::storage::BitVector const& prob0EStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
-                            storm::storage::Scheduler<SchedulerValueType>& scheduler) {
-    computeSchedulerStayingInStates(prob0EStates, transitionMatrix, scheduler);
-}
-
-template<typename T, typename SchedulerValueType>
-void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
-                            storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::Scheduler<SchedulerValueType>& scheduler) {
+template<typename T, typename BackwardTransitionsType, typename SchedulerValueType>
+void computeSchedulerRewInfImpl(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                BackwardTransitionsType const& backwardTransitions, storm::storage::Scheduler<SchedulerValueType>& scheduler) {
     // Get the states from which we can never exit the rewInfStates, i.e. the states satisfying  Pmax=1 [ G "rewInfStates"]
     // Also set a corresponding choice for all those states
     storm::storage::BitVector trapStates(rewInfStates.size(), false);
@@ -617,14 +649,14 @@ void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm
         }
     }
     // All remaining rewInfStates must reach a trapState with positive probability
-    computeSchedulerProbGreater0E(transitionMatrix, backwardTransitions, rewInfStates, trapStates, scheduler);
+    computeSchedulerProbGreater0EImpl(transitionMatrix, backwardTransitions, rewInfStates, trapStates, scheduler, boost::none);
 }
 
-template<typename T, typename SchedulerValueType>
-void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
-                            storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                            storm::storage::BitVector const& psiStates, storm::storage::Scheduler<SchedulerValueType>& scheduler,
-                            boost::optional<storm::storage::BitVector> const& rowFilter) {
+template<typename T, typename BackwardTransitionsType, typename SchedulerValueType>
+void computeSchedulerProb1EImpl(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                storm::storage::BitVector const& psiStates, storm::storage::Scheduler<SchedulerValueType>& scheduler,
+                                boost::optional<storm::storage::BitVector> const& rowFilter) {
     // set an arbitrary (valid) choice for the psi states.
     for (auto psiState : psiStates) {
         for (uint_fast64_t memState = 0; memState < scheduler.getNumberOfMemoryStates(); ++memState) {
@@ -645,14 +677,12 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
         currentState = stack.back();
         stack.pop_back();
 
-        for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState),
-                                                                      predecessorEntryIte = backwardTransitions.end(currentState);
-             predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-            if (phiStates.get(predecessorEntryIt->getColumn()) && !currentStates.get(predecessorEntryIt->getColumn())) {
+        for (auto const& predecessorEntry : backwardTransitions.getRow(currentState)) {
+            uint64_t predecessor = getPredecessor(predecessorEntry);
+            if (phiStates.get(predecessor) && !currentStates.get(predecessor)) {
                 // Check whether the predecessor has only successors in the prob1E state set for one of the
                 // nondeterminstic choices.
-                for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                     row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
+                for (uint_fast64_t row = nondeterministicChoiceIndices[predecessor]; row < nondeterministicChoiceIndices[predecessor + 1]; ++row) {
                     if (!rowFilter || rowFilter.get().get(row)) {
                         bool allSuccessorsInProb1EStates = true;
                         bool hasSuccessorInCurrentStates = false;
@@ -671,11 +701,10 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
                         // perform a backward search from that state.
                         if (allSuccessorsInProb1EStates && hasSuccessorInCurrentStates) {
                             for (uint_fast64_t memState = 0; memState < scheduler.getNumberOfMemoryStates(); ++memState) {
-                                scheduler.setChoice(row - nondeterministicChoiceIndices[predecessorEntryIt->getColumn()], predecessorEntryIt->getColumn(),
-                                                    memState);
+                                scheduler.setChoice(row - nondeterministicChoiceIndices[predecessor], predecessor, memState);
                             }
-                            currentStates.set(predecessorEntryIt->getColumn(), true);
-                            stack.push_back(predecessorEntryIt->getColumn());
+                            currentStates.set(predecessor, true);
+                            stack.push_back(predecessor);
                             break;
                         }
                     }
@@ -684,6 +713,55 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
         }
     }
 }
+}  // namespace
+
+template<typename T, typename SchedulerValueType>
+void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                   storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                   storm::storage::Scheduler<SchedulerValueType>& scheduler, boost::optional<storm::storage::BitVector> const& rowFilter) {
+    computeSchedulerProbGreater0EImpl(transitionMatrix, backwardTransitions, phiStates, psiStates, scheduler, rowFilter);
+}
+
+template<typename T, typename SchedulerValueType>
+void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparseAdjacency const& backwardTransitions,
+                                   storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                   storm::storage::Scheduler<SchedulerValueType>& scheduler, boost::optional<storm::storage::BitVector> const& rowFilter) {
+    computeSchedulerProbGreater0EImpl(transitionMatrix, backwardTransitions, phiStates, psiStates, scheduler, rowFilter);
+}
+
+template<typename T, typename SchedulerValueType>
+void computeSchedulerProb0E(storm::storage::BitVector const& prob0EStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                            storm::storage::Scheduler<SchedulerValueType>& scheduler) {
+    computeSchedulerStayingInStates(prob0EStates, transitionMatrix, scheduler);
+}
+
+template<typename T, typename SchedulerValueType>
+void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                            storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::Scheduler<SchedulerValueType>& scheduler) {
+    computeSchedulerRewInfImpl(rewInfStates, transitionMatrix, backwardTransitions, scheduler);
+}
+
+template<typename T, typename SchedulerValueType>
+void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                            storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::Scheduler<SchedulerValueType>& scheduler) {
+    computeSchedulerRewInfImpl(rewInfStates, transitionMatrix, backwardTransitions, scheduler);
+}
+
+template<typename T, typename SchedulerValueType>
+void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                            storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                            storm::storage::BitVector const& psiStates, storm::storage::Scheduler<SchedulerValueType>& scheduler,
+                            boost::optional<storm::storage::BitVector> const& rowFilter) {
+    computeSchedulerProb1EImpl(prob1EStates, transitionMatrix, backwardTransitions, phiStates, psiStates, scheduler, rowFilter);
+}
+
+template<typename T, typename SchedulerValueType>
+void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                            storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                            storm::storage::BitVector const& psiStates, storm::storage::Scheduler<SchedulerValueType>& scheduler,
+                            boost::optional<storm::storage::BitVector> const& rowFilter) {
+    computeSchedulerProb1EImpl(prob1EStates, transitionMatrix, backwardTransitions, phiStates, psiStates, scheduler, rowFilter);
+}
 
 template<typename T>
 storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
@@ -753,11 +831,25 @@ storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& b
     return statesWithProbability0;
 }
 
-template<typename T>
-storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix,
-                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
-                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                        storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+storm::storage::BitVector performProbGreater0E(storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+    // Without the forward transitions, the choices of the states are not distinguished, so this coincides with the deterministic case.
+    return performProbGreater0(backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+}
+
+storm::storage::BitVector performProb0A(storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+    storm::storage::BitVector statesWithProbability0 = performProbGreater0E(backwardTransitions, phiStates, psiStates);
+    statesWithProbability0.complement();
+    return statesWithProbability0;
+}
+
+namespace {
+template<typename T, typename BackwardTransitionsType>
+storm::storage::BitVector performProb1EImpl(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, BackwardTransitionsType const& backwardTransitions,
+                                            storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                            boost::optional<storm::storage::BitVector> const& choiceConstraint) {
     size_t numberOfStates = phiStates.size();
 
     // Initialize the environment for the iterative algorithm.
@@ -777,14 +869,12 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
             currentState = stack.back();
             stack.pop_back();
 
-            for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState),
-                                                                          predecessorEntryIte = backwardTransitions.end(currentState);
-                 predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
+            for (auto const& predecessorEntry : backwardTransitions.getRow(currentState)) {
+                uint64_t predecessor = getPredecessor(predecessorEntry);
+                if (phiStates.get(predecessor) && !nextStates.get(predecessor)) {
                     // Check whether the predecessor has only successors in the current state set for one of the
                     // nondeterminstic choices.
-                    for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                         row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
+                    for (uint_fast64_t row = nondeterministicChoiceIndices[predecessor]; row < nondeterministicChoiceIndices[predecessor + 1]; ++row) {
                         if (!choiceConstraint || choiceConstraint.get().get(row)) {
                             bool allSuccessorsInCurrentStates = true;
                             bool hasNextStateSuccessor = false;
@@ -803,8 +893,8 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
                             // add it to the set of states for the next iteration and perform a backward search from
                             // that state.
                             if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
-                                nextStates.set(predecessorEntryIt->getColumn(), true);
-                                stack.push_back(predecessorEntryIt->getColumn());
+                                nextStates.set(predecessor, true);
+                                stack.push_back(predecessor);
                                 break;
                             }
                         }
@@ -823,6 +913,23 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
 
     return currentStates;
 }
+}  // namespace
+
+template<typename T>
+storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    return performProb1EImpl(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, choiceConstraint);
+}
+
+template<typename T>
+storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    return performProb1EImpl(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, choiceConstraint);
+}
 
 template<typename T, typename RM>
 storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<T, RM> const& model,
@@ -845,20 +952,35 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
     return result;
 }
 
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates) {
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = performProb0A(backwardTransitions, phiStates, psiStates);
+    result.second = performProb1E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    return result;
+}
+
 template<typename T, typename RM>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::models::sparse::NondeterministicModel<T, RM> const& model,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
-    return performProb01Max(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates,
-                            psiStates);
+    // The structure of the backward transitions suffices and is possibly cached by the model.
+    return model.applyToBackwardTransitions([&](auto const& backwardTransitions) {
+        return performProb01Max(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    });
 }
 
-template<typename T>
-storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix,
-                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
-                                               storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
-                                               boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+namespace {
+template<typename T, typename BackwardTransitionsType>
+storm::storage::BitVector performProbGreater0AImpl(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                   std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                   BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                   storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                                   boost::optional<storm::storage::BitVector> const& choiceConstraint) {
     size_t numberOfStates = phiStates.size();
 
     // Prepare resulting bit vector.
@@ -896,18 +1018,17 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
             }
         }
 
-        for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState),
-                                                                      predecessorEntryIte = backwardTransitions.end(currentState);
-             predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-            if (phiStates.get(predecessorEntryIt->getColumn())) {
-                if (!statesWithProbabilityGreater0.get(predecessorEntryIt->getColumn())) {
+        for (auto const& predecessorEntry : backwardTransitions.getRow(currentState)) {
+            uint64_t predecessor = getPredecessor(predecessorEntry);
+            if (phiStates.get(predecessor)) {
+                if (!statesWithProbabilityGreater0.get(predecessor)) {
                     // Check whether the predecessor has at least one successor in the current state set for every
                     // nondeterministic choice within the possibly given choiceConstraint.
 
                     // Note: The backwards edge might be induced by a choice that violates the choiceConstraint.
                     // However this is not problematic as long as there is at least one enabled choice for the predecessor.
-                    uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                    uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1];
+                    uint_fast64_t row = nondeterministicChoiceIndices[predecessor];
+                    uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[predecessor + 1];
                     if (!choiceConstraint || choiceConstraint->getNextSetIndex(row) < endOfGroup) {
                         bool addToStatesWithProbabilityGreater0 = true;
                         for (; row < endOfGroup; ++row) {
@@ -934,22 +1055,22 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
                             // If we don't have a bound on the number of steps to take, just add the state to the stack.
                             if (useStepBound) {
                                 // If there is at least one more step to go, we need to push the state and the new number of steps.
-                                remainingSteps[predecessorEntryIt->getColumn()] = currentStepBound - 1;
+                                remainingSteps[predecessor] = currentStepBound - 1;
                                 stepStack.push_back(currentStepBound - 1);
                             }
-                            statesWithProbabilityGreater0.set(predecessorEntryIt->getColumn(), true);
-                            stack.push_back(predecessorEntryIt->getColumn());
+                            statesWithProbabilityGreater0.set(predecessor, true);
+                            stack.push_back(predecessor);
                         }
                     }
 
-                } else if (useStepBound && remainingSteps[predecessorEntryIt->getColumn()] < currentStepBound - 1) {
+                } else if (useStepBound && remainingSteps[predecessor] < currentStepBound - 1) {
                     // We have found a shorter path to the predecessor. Hence, we need to explore it again.
                     // If there is a choiceConstraint, we still need to check whether the backwards edge was induced by a valid action
                     bool predecessorIsValid = true;
                     if (choiceConstraint) {
                         predecessorIsValid = false;
-                        uint_fast64_t row = choiceConstraint->getNextSetIndex(nondeterministicChoiceIndices[predecessorEntryIt->getColumn()]);
-                        uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1];
+                        uint_fast64_t row = choiceConstraint->getNextSetIndex(nondeterministicChoiceIndices[predecessor]);
+                        uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[predecessor + 1];
                         for (; row < endOfGroup && !predecessorIsValid; row = choiceConstraint->getNextSetIndex(row + 1)) {
                             for (auto const& entry : transitionMatrix.getRow(row)) {
                                 if (entry.getColumn() == currentState) {
@@ -960,9 +1081,9 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
                         }
                     }
                     if (predecessorIsValid) {
-                        remainingSteps[predecessorEntryIt->getColumn()] = currentStepBound - 1;
+                        remainingSteps[predecessor] = currentStepBound - 1;
                         stepStack.push_back(currentStepBound - 1);
-                        stack.push_back(predecessorEntryIt->getColumn());
+                        stack.push_back(predecessor);
                     }
                 }
             }
@@ -971,6 +1092,27 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
 
     return statesWithProbabilityGreater0;
 }
+}  // namespace
+
+template<typename T>
+storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    return performProbGreater0AImpl(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps,
+                                    choiceConstraint);
+}
+
+template<typename T>
+storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    return performProbGreater0AImpl(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps,
+                                    choiceConstraint);
+}
 
 template<typename T, typename RM>
 storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<T, RM> const& model,
@@ -993,6 +1135,17 @@ storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& t
     return statesWithProbability0;
 }
 
+template<typename T>
+storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+    storm::storage::BitVector statesWithProbability0 =
+        performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    statesWithProbability0.complement();
+    return statesWithProbability0;
+}
+
 template<typename T, typename RM>
 storm::storage::BitVector performProb1A(storm::models::sparse::NondeterministicModel<T, RM> const& model,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
@@ -1000,11 +1153,11 @@ storm::storage::BitVector performProb1A(storm::models::sparse::NondeterministicM
     return performProb1A(model.getTransitionMatrix(), model.getNondeterministicChoiceIndices(), backwardTransitions, phiStates, psiStates);
 }
 
-template<typename T>
-storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix,
-                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
-                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                        storm::storage::BitVector const& psiStates) {
+namespace {
+template<typename T, typename BackwardTransitionsType>
+storm::storage::BitVector performProb1AImpl(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, BackwardTransitionsType const& backwardTransitions,
+                                            storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
     size_t numberOfStates = phiStates.size();
 
     // Initialize the environment for the iterative algorithm.
@@ -1024,16 +1177,14 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
             currentState = stack.back();
             stack.pop_back();
 
-            for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState),
-                                                                          predecessorEntryIte = backwardTransitions.end(currentState);
-                 predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
+            for (auto const& predecessorEntry : backwardTransitions.getRow(currentState)) {
+                uint64_t predecessor = getPredecessor(predecessorEntry);
+                if (phiStates.get(predecessor) && !nextStates.get(predecessor)) {
                     // Check whether the predecessor has only successors in the current state set for all of the
                     // nondeterminstic choices and that for each choice there exists a successor that is already
                     // in the next states.
                     bool addToStatesWithProbability1 = true;
-                    for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                         row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
+                    for (uint_fast64_t row = nondeterministicChoiceIndices[predecessor]; row < nondeterministicChoiceIndices[predecessor + 1]; ++row) {
                         bool hasAtLeastOneSuccessorWithProbability1 = false;
                         for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row),
                                                                                       successorEntryIte = transitionMatrix.end(row);
@@ -1058,8 +1209,8 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
                     // add it to the set of states for the next iteration and perform a backward search from
                     // that state.
                     if (addToStatesWithProbability1) {
-                        nextStates.set(predecessorEntryIt->getColumn(), true);
-                        stack.push_back(predecessorEntryIt->getColumn());
+                        nextStates.set(predecessor, true);
+                        stack.push_back(predecessor);
                     }
                 }
             }
@@ -1074,6 +1225,23 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
     }
     return currentStates;
 }
+}  // namespace
+
+template<typename T>
+storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+    return performProb1AImpl(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+}
+
+template<typename T>
+storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+    return performProb1AImpl(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+}
 
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix,
@@ -1090,12 +1258,27 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
     return result;
 }
 
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates) {
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    // As above, the prob1 states are exactly the states that cannot reach a prob0 state.
+    result.second = performProb0A(backwardTransitions, ~psiStates, result.first);
+    return result;
+}
+
 template<typename T, typename RM>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::models::sparse::NondeterministicModel<T, RM> const& model,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
-    return performProb01Min(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates,
-                            psiStates);
+    // The structure of the backward transitions suffices and is possibly cached by the model.
+    return model.applyToBackwardTransitions([&](auto const& backwardTransitions) {
+        return performProb01Min(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    });
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -1131,10 +1314,8 @@ storm::dd::Bdd<Type> performProbGreater0E(storm::models::symbolic::Nondeterminis
     storm::dd::Bdd<Type> abstractedTransitionMatrix = transitionMatrix.existsAbstract(model.getNondeterminismVariables());
     while (lastIterationStates != statesWithProbabilityGreater0E) {
         lastIterationStates = statesWithProbabilityGreater0E;
-        statesWithProbabilityGreater0E =
-            statesWithProbabilityGreater0E.inverseRelationalProduct(abstractedTransitionMatrix, model.getRowVariables(), model.getColumnVariables());
-        statesWithProbabilityGreater0E &= phiStates;
-        statesWithProbabilityGreater0E |= lastIterationStates;
+        statesWithProbabilityGreater0E = statesWithProbabilityGreater0E.inverseRelationalProductStep(abstractedTransitionMatrix, model.getRowVariables(),
+                                                                                                     model.getColumnVariables(), phiStates);
     }
 
     return statesWithProbabilityGreater0E;
@@ -1926,17 +2107,27 @@ template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<double>
                                             storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                             storm::storage::BitVector const& psiStates, storm::storage::Scheduler<double>& scheduler,
                                             boost::optional<storm::storage::BitVector> const& rowFilter);
+template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                            storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                            storm::storage::BitVector const& psiStates, storm::storage::Scheduler<double>& scheduler,
+                                            boost::optional<storm::storage::BitVector> const& rowFilter);
 
 template void computeSchedulerProb0E(storm::storage::BitVector const& prob0EStates, storm::storage::SparseMatrix<double> const& transitionMatrix,
                                      storm::storage::Scheduler<double>& scheduler);
 
 template void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<double> const& transitionMatrix,
                                      storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::Scheduler<double>& scheduler);
+template void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                     storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::Scheduler<double>& scheduler);
 
 template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<double> const& transitionMatrix,
                                      storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                      storm::storage::BitVector const& psiStates, storm::storage::Scheduler<double>& scheduler,
                                      boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
+template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                     storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                     storm::storage::BitVector const& psiStates, storm::storage::Scheduler<double>& scheduler,
+                                     boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -1951,6 +2142,12 @@ template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<do
                                                  storm::storage::BitVector const& psiStates,
                                                  boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+
 template storm::storage::BitVector performProb1E(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -1961,6 +2158,12 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
                                                                                           storm::storage::BitVector const& phiStates,
                                                                                           storm::storage::BitVector const& psiStates);
 
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                          std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                          storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                                          storm::storage::BitVector const& phiStates,
+                                                                                          storm::storage::BitVector const& psiStates);
+
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
     storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -1972,6 +2175,13 @@ template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMa
                                                         bool useStepBound = false, uint_fast64_t maximalSteps = 0,
                                                         boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparseAdjacency const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps,
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint);
+
 template storm::storage::BitVector performProb0E(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -1985,6 +2195,11 @@ template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<do
                                                  storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                  storm::storage::BitVector const& psiStates);
 
+template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates);
+
 template storm::storage::BitVector performProb1A(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -1997,6 +2212,10 @@ template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<do
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                  storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                                                                           std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
@@ -2004,6 +2223,12 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
                                                                                           storm::storage::BitVector const& phiStates,
                                                                                           storm::storage::BitVector const& psiStates);
 
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                          std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                          storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                                          storm::storage::BitVector const& phiStates,
+                                                                                          storm::storage::BitVector const& psiStates);
+
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
     storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -2071,6 +2296,11 @@ template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<storm::
                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                             storm::storage::Scheduler<storm::RationalNumber>& scheduler,
                                             boost::optional<storm::storage::BitVector> const& rowFilter);
+template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                            storm::storage::SparseAdjacency const& backwardTransitions,
+                                            storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                            storm::storage::Scheduler<storm::RationalNumber>& scheduler,
+                                            boost::optional<storm::storage::BitVector> const& rowFilter);
 
 template void computeSchedulerProb0E(storm::storage::BitVector const& prob0EStates, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                      storm::storage::Scheduler<storm::RationalNumber>& scheduler);
@@ -2078,11 +2308,18 @@ template void computeSchedulerProb0E(storm::storage::BitVector const& prob0EStat
 template void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                      storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                      storm::storage::Scheduler<storm::RationalNumber>& scheduler);
+template void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                     storm::storage::SparseAdjacency const& backwardTransitions,
+                                     storm::storage::Scheduler<storm::RationalNumber>& scheduler);
 
 template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                      storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                      storm::storage::BitVector const& psiStates, storm::storage::Scheduler<storm::RationalNumber>& scheduler,
                                      boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
+template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                     storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                     storm::storage::BitVector const& psiStates, storm::storage::Scheduler<storm::RationalNumber>& scheduler,
+                                     boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -2097,6 +2334,12 @@ template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<st
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                  boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+
 template storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -2106,6 +2349,11 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
 
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates);
+
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
@@ -2117,6 +2365,13 @@ template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMa
                                                         bool useStepBound = false, uint_fast64_t maximalSteps = 0,
                                                         boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparseAdjacency const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps,
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint);
+
 template storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -2126,16 +2381,30 @@ template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<st
                                                  storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 
+template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
 template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
 
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates);
+
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
@@ -2202,17 +2471,27 @@ template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<storm::
                                             storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                             storm::storage::Scheduler<double>& scheduler, boost::optional<storm::storage::BitVector> const& rowFilter);
+template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                            storm::storage::SparseAdjacency const& backwardTransitions,
+                                            storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                            storm::storage::Scheduler<double>& scheduler, boost::optional<storm::storage::BitVector> const& rowFilter);
 
 template void computeSchedulerProb0E(storm::storage::BitVector const& prob0EStates, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
                                      storm::storage::Scheduler<double>& scheduler);
 
 template void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
                                      storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions, storm::storage::Scheduler<double>& scheduler);
+template void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                     storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::Scheduler<double>& scheduler);
 
 template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
                                      storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                      storm::storage::BitVector const& psiStates, storm::storage::Scheduler<double>& scheduler,
                                      boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
+template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                     storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                     storm::storage::BitVector const& psiStates, storm::storage::Scheduler<double>& scheduler,
+                                     boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -2227,6 +2506,12 @@ template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<st
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                  boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+
 template storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<storm::Interval> const& model,
                                                  storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -2236,6 +2521,11 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
     storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
 
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
+    storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates);
+
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<storm::Interval> const& model, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
@@ -2247,6 +2537,13 @@ template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMa
                                                         bool useStepBound = false, uint_fast64_t maximalSteps = 0,
                                                         boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparseAdjacency const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps,
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint);
+
 template storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<storm::Interval> const& model,
                                                  storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -2256,16 +2553,30 @@ template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<st
                                                  storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 
+template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
 template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
 
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
+    storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates);
+
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<storm::Interval> const& model, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
@@ -2330,6 +2641,12 @@ template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStat
                                      storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                      storm::storage::Scheduler<storm::RationalFunction>& scheduler,
                                      boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
+template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates,
+                                     storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                     storm::storage::SparseAdjacency const& backwardTransitions,
+                                     storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                     storm::storage::Scheduler<storm::RationalFunction>& scheduler,
+                                     boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -2344,6 +2661,12 @@ template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<st
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                  boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+
 template storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -2353,6 +2676,11 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
 
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates);
+
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
@@ -2364,6 +2692,13 @@ template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMa
                                                         bool useStepBound = false, uint_fast64_t maximalSteps = 0,
                                                         boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparseAdjacency const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps,
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint);
+
 template storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -2372,6 +2707,11 @@ template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<st
                                                  storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 
+template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
 template storm::storage::BitVector performProb1A(storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
@@ -2379,12 +2719,21 @@ template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<st
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
 
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+    storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates);
+
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
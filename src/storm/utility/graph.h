@@ -10,6 +10,7 @@
 #include "storm/models/sparse/DeterministicModel.h"
 #include "storm/models/sparse/NondeterministicModel.h"
 #include "storm/storage/Scheduler.h"
+#include "storm/storage/SparseAdjacency.h"
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/storage/dd/Bdd.h"
@@ -145,6 +146,12 @@ template<typename T>
 storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                               storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
 
+/*!
+ * As above, but the backward transitions are only given by their structure, which suffices for this and the other graph searches that accept it.
+ */
+storm::storage::BitVector performProbGreater0(storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+
 /*!
  * Computes the set of states of the given model for which all paths lead to
  * the given set of target states and only visit states from the filter set
@@ -163,6 +170,9 @@ template<typename T>
 storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                        storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
 
+storm::storage::BitVector performProb1(storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                       storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
+
 /*!
  * Computes the set of states of the given model for which all paths lead to
  * the given set of target states and only visit states from the filter set
@@ -179,6 +189,9 @@ template<typename T>
 storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                        storm::storage::BitVector const& psiStates);
 
+storm::storage::BitVector performProb1(storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                       storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi until psi in a
  * deterministic model.
@@ -209,6 +222,10 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates);
 
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the set of states that has a positive probability of reaching psi states after only passing
  * through phi states before.
@@ -329,6 +346,12 @@ void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<T> const& transi
                                    storm::storage::Scheduler<SchedulerValueType>& scheduler,
                                    boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
 
+template<typename T, typename SchedulerValueType>
+void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparseAdjacency const& backwardTransitions,
+                                   storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                   storm::storage::Scheduler<SchedulerValueType>& scheduler,
+                                   boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
+
 /*!
  * Computes a scheduler for the given states that have a scheduler that has a reward infinity.
  *
@@ -341,6 +364,10 @@ template<typename T, typename SchedulerValueType>
 void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
                             storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::Scheduler<SchedulerValueType>& scheduler);
 
+template<typename T, typename SchedulerValueType>
+void computeSchedulerRewInf(storm::storage::BitVector const& rewInfStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                            storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::Scheduler<SchedulerValueType>& scheduler);
+
 /*!
  * Computes a scheduler for the given states that have a scheduler that has a probability 0.
  *
@@ -369,6 +396,12 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
                             storm::storage::BitVector const& psiStates, storm::storage::Scheduler<SchedulerValueType>& scheduler,
                             boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
 
+template<typename T, typename SchedulerValueType>
+void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                            storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                            storm::storage::BitVector const& psiStates, storm::storage::Scheduler<SchedulerValueType>& scheduler,
+                            boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
+
 /*!
  * Computes the sets of states that have probability greater 0 of satisfying phi until psi under at least
  * one possible resolution of non-determinism in a non-deterministic model. Stated differently,
@@ -386,10 +419,16 @@ template<typename T>
 storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
 
+storm::storage::BitVector performProbGreater0E(storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+
 template<typename T>
 storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates);
 
+storm::storage::BitVector performProb0A(storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
  * one possible resolution of non-determinism in a non-deterministic model. Stated differently,
@@ -410,6 +449,13 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::BitVector const& psiStates,
                                         boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+template<typename T>
+storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates,
+                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
  * one possible resolution of non-determinism in a non-deterministic model. Stated differently,
@@ -434,6 +480,13 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates);
 
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
  * until psi in a non-deterministic model in which all non-deterministic choices are resolved
@@ -471,6 +524,13 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
                                                storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0,
                                                boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+template<typename T>
+storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0,
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+
 /*!
  * Computes the sets of states that have probability 0 of satisfying phi until psi under at least
  * one possible resolution of non-determinism in a non-deterministic model. Stated differently,
@@ -492,6 +552,11 @@ storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& t
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates);
+template<typename T>
+storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates);
 
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under all
@@ -516,6 +581,12 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates);
 
+template<typename T>
+storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseAdjacency const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates);
+
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix,
                                                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
@@ -523,6 +594,13 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates);
 
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseAdjacency const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
  * until psi in a non-deterministic model in which all non-deterministic choices are resolved
@@ -518,6 +518,18 @@ T dotProduct(std::vector<T> const& firstOperand, std::vector<T> const& secondOpe
     return std::inner_product(firstOperand.begin(), firstOperand.end(), secondOperand.begin(), storm::utility::zero<T>());
 }
 
+#ifdef STORM_HAVE_INTELTBB
+template<class T>
+T dotProductParallel(std::vector<T> const& firstOperand, std::vector<T> const& secondOperand) {
+    return tbb::parallel_reduce(
+        tbb::blocked_range<uint_fast64_t>(0, firstOperand.size()), storm::utility::zero<T>(),
+        [&](tbb::blocked_range<uint_fast64_t> const& range, T const& init) {
+            return std::inner_product(firstOperand.begin() + range.begin(), firstOperand.begin() + range.end(), secondOperand.begin() + range.begin(), init);
+        },
+        std::plus<T>());
+}
+#endif
+
 /*!
  * Retrieves a bit vector containing all the indices for which the value at this position makes the given
  * function evaluate to true.
@@ -289,6 +289,20 @@ TEST(DdJaniModelBuilderTest_Cudd, Mdp) {
     EXPECT_EQ(12ul, mdp->getNumberOfChoices());
 }
 
+TEST(DdJaniModelBuilderTest_Sylvan, StaticVariableOrder) {
+    auto janiModel = getJaniModelFromPrism("/mdp/leader3.nm");
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options options;
+    options.staticVariableOrder = true;
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double> builder;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = builder.build(janiModel, options);
+    EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>();
+
+    EXPECT_EQ(364ul, mdp->getNumberOfStates());
+    EXPECT_EQ(654ul, mdp->getNumberOfTransitions());
+    EXPECT_EQ(573ul, mdp->getNumberOfChoices());
+}
+
 TEST(DdJaniModelBuilderTest_Cudd, SynchronizationVectors) {
     auto janiModel = getJaniModelFromPrism("/mdp/SmallPrismTest.nm");
 
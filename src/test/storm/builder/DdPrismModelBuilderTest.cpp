@@ -346,6 +346,48 @@ TEST(DdPrismModelBuilderTest_Cudd, Composition) {
     EXPECT_EQ(21ul, mdp->getNumberOfChoices());
 }
 
+TEST(DdPrismModelBuilderTest_Sylvan, StaticVariableOrder) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+    options.staticVariableOrder = true;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>();
+
+    EXPECT_EQ(364ul, mdp->getNumberOfStates());
+    EXPECT_EQ(654ul, mdp->getNumberOfTransitions());
+    EXPECT_EQ(573ul, mdp->getNumberOfChoices());
+
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, StaticVariableOrder) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>::Options options;
+    options.staticVariableOrder = true;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program, options);
+    EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>();
+
+    EXPECT_EQ(364ul, mdp->getNumberOfStates());
+    EXPECT_EQ(654ul, mdp->getNumberOfTransitions());
+    EXPECT_EQ(573ul, mdp->getNumberOfChoices());
+
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program, options);
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+}
+
 TEST(UnboundedTest_Sylvan, Mdp) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/unbounded.nm");
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
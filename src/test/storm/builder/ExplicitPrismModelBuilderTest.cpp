@@ -2,8 +2,15 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
 #include "storm/exceptions/WrongFormatException.h"
+#include "storm/generator/CommandGuardIndex.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "test/storm_gtest.h"
@@ -182,6 +189,116 @@ TEST(ExplicitPrismModelBuilderTest, ExportExplicitLookup) {
     EXPECT_EQ(1ul, model->getLabelsOfState(lookup.lookup({{svar, manager.integer(7)}, {dvar, manager.integer(2)}})).count("two"));
 }
 
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+    generatorOptions.setSymmetryReduction();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    // The states of the two dice are only distinguished up to their order.
+    EXPECT_EQ(91ul, model->getNumberOfStates());
+    EXPECT_EQ(1ul, model->getInitialStates().getNumberOfSetBits());
+    EXPECT_EQ(1ul, model->getStates("two").getNumberOfSetBits());
+    EXPECT_EQ(3ul, model->getStates("seven").getNumberOfSetBits());
+
+    // A label that distinguishes the dice prevents the reduction.
+    auto s1 = program.getModules()[0].getIntegerVariable("s1").getExpressionVariable();
+    generatorOptions.addLabel(s1.getExpression() == program.getManager().integer(7));
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(169ul, model->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    auto d1 = program.getModules()[0].getIntegerVariable("d1").getExpressionVariable();
+    auto d2 = program.getModules()[1].getIntegerVariable("d2").getExpressionVariable();
+    storm::expressions::Expression visible = d1.getExpression() + d2.getExpression() == program.getManager().integer(7);
+    generatorOptions.addLabel(visible);
+
+    // The reduction has to preserve the minimal and maximal probabilities to reach the visible label.
+    auto eventuallyVisible = std::make_shared<storm::logic::EventuallyFormula>(std::make_shared<storm::logic::AtomicExpressionFormula>(visible));
+    auto checkVisible = [&eventuallyVisible](storm::models::sparse::Model<double> const& model, storm::OptimizationDirection dir) {
+        storm::logic::ProbabilityOperatorFormula formula(eventuallyVisible, storm::logic::OperatorInformation(dir));
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*model.as<storm::models::sparse::Mdp<double>>());
+        storm::Environment env;
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(formula, true));
+        return result->asExplicitQuantitativeCheckResult<double>()[*model.getInitialStates().begin()];
+    };
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(169ul, model->getNumberOfStates());
+    double const fullMin = checkVisible(*model, storm::OptimizationDirection::Minimize);
+    double const fullMax = checkVisible(*model, storm::OptimizationDirection::Maximize);
+
+    // The coin flips that do not determine the value of a die are independent of the other die.
+    generatorOptions.setPartialOrderReduction();
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(151ul, model->getNumberOfStates());
+    EXPECT_NEAR(fullMin, checkVisible(*model, storm::OptimizationDirection::Minimize), 1e-6);
+    EXPECT_NEAR(fullMax, checkVisible(*model, storm::OptimizationDirection::Maximize), 1e-6);
+
+    // Reward models are not preserved by the reduction.
+    generatorOptions.setBuildAllRewardModels();
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(169ul, model->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, CommandGuardIndex) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm").substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32, false);
+    storm::generator::CommandGuardIndex index(program, variableInformation);
+    EXPECT_EQ(1ul, index.getNumberOfIndexedModules());
+
+    // Only the command guarded by s=3 is potentially enabled if s=3.
+    auto const& s = program.getModule(0).getIntegerVariable("s").getExpressionVariable();
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        if (integerVariable.variable == s) {
+            state.setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, 3 - integerVariable.lowerBound);
+        }
+    }
+    storm::storage::BitVector const& commands = index.getPotentiallyEnabledCommands(0, state);
+    EXPECT_EQ(1ul, commands.getNumberOfSetBits());
+    EXPECT_TRUE(commands.get(3));
+}
+
+TEST(ExplicitPrismModelBuilderTest, CommandGuardIndexRationalValues) {
+    // Guards that compare an integer variable with a rational value can not be indexed.
+    std::string input = R"(dtmc
+const int N = 4;
+module main
+    s : [0..3] init 0;
+    [] s=0 -> (s'=1);
+    [] s=1.0 -> (s'=2);
+    [] s=N/2 -> (s'=3);
+    [] s=3 -> true;
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(input, "rational_guards.pm").substituteConstantsFormulas();
+    storm::generator::VariableInformation variableInformation(program, 32, false);
+    storm::generator::CommandGuardIndex index(program, variableInformation);
+    EXPECT_EQ(1ul, index.getNumberOfIndexedModules());
+
+    // The commands with rational guards are potentially enabled in every state.
+    auto const& s = program.getModule(0).getIntegerVariable("s").getExpressionVariable();
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        if (integerVariable.variable == s) {
+            state.setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, 2 - integerVariable.lowerBound);
+        }
+    }
+    storm::storage::BitVector const& commands = index.getPotentiallyEnabledCommands(0, state);
+    EXPECT_EQ(2ul, commands.getNumberOfSetBits());
+    EXPECT_TRUE(commands.get(1));
+    EXPECT_TRUE(commands.get(2));
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    EXPECT_EQ(4ul, model->getNumberOfTransitions());
+}
+
 bool trivial_true_mask(storm::expressions::SimpleValuation const&, uint64_t) {
     return true;
 }
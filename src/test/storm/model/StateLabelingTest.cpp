@@ -1,6 +1,8 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <map>
+
 #include "storm/models/sparse/StateLabeling.h"
 
 TEST(StateLabelingTest, RemoveLabel) {
@@ -31,3 +33,74 @@ TEST(StateLabelingTest, RemoveLabel) {
     EXPECT_EQ(1ul, labeling.getNumberOfLabels());
     EXPECT_TRUE(labeling.getStateHasLabel("test2", 5));
 }
+
+TEST(StateLabelingTest, CompressedAndUncompressedViews) {
+    // The labelings span several chunks of the compressed representation.
+    uint64_t const numberOfStates = 200000;
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    std::map<std::string, storm::storage::BitVector> expectedStates;
+    auto checkLabeling = [&]() {
+        EXPECT_EQ(expectedStates.size(), labeling.getNumberOfLabels());
+        for (auto const& labelStatesPair : expectedStates) {
+            EXPECT_EQ(labelStatesPair.second, labeling.getStates(labelStatesPair.first)) << "for label " << labelStatesPair.first;
+            EXPECT_EQ(storm::storage::CompressedBitVector(labelStatesPair.second), labeling.getCompressedStates(labelStatesPair.first))
+                << "for label " << labelStatesPair.first;
+            for (uint64_t state = 0; state < numberOfStates; state += 997) {
+                EXPECT_EQ(labelStatesPair.second.get(state), labeling.getStateHasLabel(labelStatesPair.first, state))
+                    << "for label " << labelStatesPair.first << " and state " << state;
+            }
+        }
+    };
+
+    expectedStates.emplace("sparse", storm::storage::BitVector(numberOfStates, {3, 70000, 199999}));
+    expectedStates.emplace("interval", storm::storage::BitVector(numberOfStates));
+    expectedStates.at("interval").setMultiple(50000, 100000);
+    expectedStates.emplace("dense", storm::storage::BitVector(numberOfStates));
+    for (uint64_t state = 0; state < numberOfStates; state += 3) {
+        expectedStates.at("dense").set(state);
+    }
+    for (auto const& labelStatesPair : expectedStates) {
+        labeling.addLabel(labelStatesPair.first, labelStatesPair.second);
+    }
+    checkLabeling();
+
+    // Modifying a copy of the retrieved set of states does not affect the labeling.
+    storm::storage::BitVector retrievedStates = labeling.getStates("sparse");
+    retrievedStates.set(42);
+    checkLabeling();
+
+    // A retrieved set of states is kept up to date.
+    storm::storage::BitVector const& intervalStates = labeling.getStates("interval");
+    labeling.addLabelToState("interval", 42);
+    expectedStates.at("interval").set(42);
+    EXPECT_TRUE(intervalStates.get(42));
+
+    for (uint64_t state : {0ull, 70000ull, 75000ull, 150000ull}) {
+        labeling.addLabelToState("sparse", state);
+        expectedStates.at("sparse").set(state);
+        labeling.addLabelToState("interval", state);
+        expectedStates.at("interval").set(state);
+    }
+    labeling.removeLabelFromState("interval", 75000);
+    expectedStates.at("interval").set(75000, false);
+    labeling.removeLabelFromState("dense", 3);
+    expectedStates.at("dense").set(3, false);
+    checkLabeling();
+
+    storm::storage::BitVector newStates(numberOfStates, {1, 2, 100000, 100001});
+    labeling.setStates("dense", newStates);
+    expectedStates.at("dense") = newStates;
+    labeling.setStates("interval", storm::storage::BitVector(expectedStates.at("sparse")));
+    expectedStates.at("interval") = expectedStates.at("sparse");
+    checkLabeling();
+
+    // Removing a label moves the last label to the position of the removed one.
+    labeling.removeLabel("sparse");
+    expectedStates.erase("sparse");
+    checkLabeling();
+    labeling.addLabelToState("dense", 5);
+    expectedStates.at("dense").set(5);
+    labeling.addLabel("sparse", storm::storage::BitVector(numberOfStates, {17, 170000}));
+    expectedStates.emplace("sparse", storm::storage::BitVector(numberOfStates, {17, 170000}));
+    checkLabeling();
+}
@@ -10,7 +10,9 @@
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/utility/constants.h"
@@ -100,6 +102,41 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_large
     EXPECT_EQ(expectedResult, result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
 
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_wavefronts) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm";
+    std::string constantsDef = "N=10";
+    std::string formulasAsString = "Pmax=? [ multi( F{\"r\"}<=5 x=N, F{\"l\"}<=10 x=0 )]";
+    formulasAsString += "; \n Pmin=? [ multi( F{\"r\"}<=7 x=N, F{\"l\"}<=8 x=0 )]";
+    formulasAsString += "; \n Pmax=? [ multi( F{\"r\"}<=9 x=N, F{\"l\"}<=4 x=0 )]";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+
+    // With Intel TBB, the epochs are analyzed wavefront by wavefront. The results have to coincide with the ones obtained by analyzing one epoch at a time.
+    for (auto const& formula : formulas) {
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult, wavefrontResult;
+        {
+            std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+            sequentialResult = storm::api::verifyWithSparseEngine(mdp, storm::api::createTask<double>(formula, true));
+        }
+        {
+            std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+            wavefrontResult = storm::api::verifyWithSparseEngine(mdp, storm::api::createTask<double>(formula, true));
+        }
+        ASSERT_TRUE(sequentialResult->isExplicitQuantitativeCheckResult());
+        ASSERT_TRUE(wavefrontResult->isExplicitQuantitativeCheckResult());
+        double sequentialValue = sequentialResult->asExplicitQuantitativeCheckResult<double>()[initState];
+        double wavefrontValue = wavefrontResult->asExplicitQuantitativeCheckResult<double>()[initState];
+        EXPECT_NEAR(sequentialValue, wavefrontValue, storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision())
+            << "for formula " << *formula;
+    }
+}
+
 TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_tiny_ec) {
     storm::Environment env;
 
@@ -24,6 +24,7 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/ExplicitSubmatrixCache.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/EigenLinearEquationSolver.h"
@@ -695,6 +696,54 @@ TEST(DtmcPrctlModelCheckerTest, AllUntilProbabilities) {
     EXPECT_NEAR(0, result[12], 1e-6);
 }
 
+TEST(DtmcPrctlModelCheckerTest, HybridExplicitSubmatrixCaching) {
+    std::string formulasString = "P=? [F \"one\"]";
+    formulasString += "; P=? [F \"two\"]";
+    formulasString += "; P=? [F<=5 \"done\"]";
+    formulasString += "; R=? [F \"done\"]";
+    formulasString += "; P=? [F \"one\"]";
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSymbolicModel<storm::dd::DdType::CUDD, double>(program, formulas)
+                     ->template as<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>>();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    model->setExplicitSubmatrixCaching(true);
+    ASSERT_NE(nullptr, model->getExplicitSubmatrixCache());
+
+    // Check the properties both with a solver that requires an equation system and one that does not.
+    std::vector<storm::Environment> environments(2);
+    environments[0].solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Gmmxx);
+    environments[1].solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    environments[1].solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+    environments[1].solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    std::vector<double> expectedResults = {1.0 / 6, 1.0 / 6, 15.0 / 16, 11.0 / 3, 1.0 / 6};
+    storm::modelchecker::HybridDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>> checker(*model);
+    storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD> initialStatesFilter(model->getReachableStates(), model->getInitialStates());
+    for (auto const& env : environments) {
+        for (uint64_t index = 0; index < formulas.size(); ++index) {
+            auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[index]));
+            result->filter(initialStatesFilter);
+            EXPECT_NEAR(expectedResults[index], result->asQuantitativeCheckResult<double>().getMin(), 1e-6);
+        }
+    }
+
+    EXPECT_GT(model->getExplicitSubmatrixCache()->getSizeInBytes(), 0ull);
+    model->setExplicitSubmatrixCaching(false);
+    EXPECT_EQ(nullptr, model->getExplicitSubmatrixCache());
+
+    // A cache that exceeds its maximal size only keeps the most recently used entry.
+    storm::models::symbolic::ExplicitSubmatrixCache<storm::dd::DdType::CUDD, double> boundedCache(model->getReachableStates(), 1);
+    boundedCache.getOdd(model->getReachableStates());
+    uint64_t sizeOfReachableStatesOdd = boundedCache.getSizeInBytes();
+    EXPECT_GT(sizeOfReachableStatesOdd, 0ull);
+    storm::dd::Odd initialStatesOdd = boundedCache.getOdd(model->getInitialStates());
+    EXPECT_EQ(initialStatesOdd.getNodeCount() * sizeof(storm::dd::Odd), boundedCache.getSizeInBytes());
+    EXPECT_EQ(model->getNumberOfStates(), boundedCache.getOdd(model->getReachableStates()).getTotalOffset());
+    EXPECT_EQ(sizeOfReachableStatesOdd, boundedCache.getSizeInBytes());
+}
+
 TYPED_TEST(DtmcPrctlModelCheckerTest, LtlProbabilitiesDie) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=? [(X s>0) U (s=7 & d=2)]";
@@ -8,6 +8,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/solver/NativeLinearEquationSolver.h"
 
@@ -263,6 +264,54 @@ TYPED_TEST(LraDtmcPrctlModelCheckerTest, LRASingleBscc) {
     }
 }
 
+TYPED_TEST(LraDtmcPrctlModelCheckerTest, LRAManyBsccs) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    // The initial state moves to one of several BSCCs of different sizes with equal probability.
+    uint64_t const numberOfBsccs = 8;
+    uint64_t numberOfStates = 1;
+    for (uint64_t bscc = 0; bscc < numberOfBsccs; ++bscc) {
+        numberOfStates += bscc + 2;
+    }
+    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(numberOfStates, numberOfStates);
+    storm::models::sparse::StateLabeling ap(numberOfStates);
+    ap.addLabel("a");
+    for (uint64_t bscc = 0, offset = 1; bscc < numberOfBsccs; offset += bscc + 2, ++bscc) {
+        matrixBuilder.addNextValue(0, offset, this->parseNumber("1/8"));
+    }
+    for (uint64_t bscc = 0, offset = 1; bscc < numberOfBsccs; offset += bscc + 2, ++bscc) {
+        for (uint64_t state = offset; state < offset + bscc + 2; ++state) {
+            uint64_t successor = state + 1 < offset + bscc + 2 ? state + 1 : offset;
+            if ((state + bscc) % 3 == 0) {
+                ap.addLabelToState("a", state);
+            }
+            // Either stay or move on to the next state with probability one half.
+            matrixBuilder.addNextValue(state, std::min(state, successor), this->parseNumber("1/2"));
+            matrixBuilder.addNextValue(state, std::max(state, successor), this->parseNumber("1/2"));
+        }
+    }
+    storm::models::sparse::Dtmc<ValueType> dtmc(matrixBuilder.build(), ap);
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(dtmc);
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("LRA=? [\"a\"]");
+    std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult, parallelResult;
+    {
+        std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        sequentialResult = checker.check(this->env(), *formula);
+    }
+    {
+        // The values of the BSCCs are computed in parallel (if Intel TBB is available).
+        std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        parallelResult = checker.check(this->env(), *formula);
+    }
+    auto const& sequentialValues = sequentialResult->asExplicitQuantitativeCheckResult<ValueType>();
+    auto const& parallelValues = parallelResult->asExplicitQuantitativeCheckResult<ValueType>();
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        EXPECT_NEAR(sequentialValues[state], parallelValues[state], this->precision()) << "for state " << state;
+    }
+}
+
 TYPED_TEST(LraDtmcPrctlModelCheckerTest, LRA) {
     typedef typename TestFixture::ValueType ValueType;
 
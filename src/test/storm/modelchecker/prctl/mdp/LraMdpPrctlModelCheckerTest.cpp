@@ -15,7 +15,9 @@
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
 #include "storm/settings/modules/GeneralSettings.h"
@@ -462,6 +464,64 @@ TYPED_TEST(LraMdpPrctlModelCheckerTest, LRA) {
     }
 }
 
+TYPED_TEST(LraMdpPrctlModelCheckerTest, LRA_ManyMecs) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    // The initial state can choose to enter one of several MECs of different sizes.
+    uint64_t const numberOfMecs = 8;
+    uint64_t numberOfStates = 1;
+    for (uint64_t mec = 0; mec < numberOfMecs; ++mec) {
+        numberOfStates += mec + 2;
+    }
+    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(0, 0, 0, false, true);
+    storm::models::sparse::StateLabeling ap(numberOfStates);
+    ap.addLabel("a");
+    uint64_t row = 0;
+    matrixBuilder.newRowGroup(row);
+    for (uint64_t mec = 0, offset = 1; mec < numberOfMecs; offset += mec + 2, ++mec) {
+        matrixBuilder.addNextValue(row++, offset, this->parseNumber("1"));
+    }
+    for (uint64_t mec = 0, offset = 1; mec < numberOfMecs; offset += mec + 2, ++mec) {
+        for (uint64_t state = 0; state < mec + 2; ++state) {
+            uint64_t successor = offset + (state + 1) % (mec + 2);
+            if ((state + mec) % 3 == 0) {
+                ap.addLabelToState("a", offset + state);
+            }
+            matrixBuilder.newRowGroup(row);
+            // Either move on to the next state or return to the first state of the MEC with probability one half.
+            matrixBuilder.addNextValue(row++, successor, this->parseNumber("1"));
+            if (successor == offset) {
+                matrixBuilder.addNextValue(row++, offset, this->parseNumber("1"));
+            } else {
+                matrixBuilder.addNextValue(row, offset, this->parseNumber("1/2"));
+                matrixBuilder.addNextValue(row++, successor, this->parseNumber("1/2"));
+            }
+        }
+    }
+    storm::models::sparse::Mdp<ValueType> mdp(matrixBuilder.build(), ap);
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> checker(mdp);
+
+    storm::parser::FormulaParser formulaParser;
+    for (std::string const& formulaString : {"LRAmax=? [\"a\"]", "LRAmin=? [\"a\"]"}) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult, parallelResult;
+        {
+            std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+            sequentialResult = checker.check(this->env(), *formula);
+        }
+        {
+            // The values of the MECs are computed in parallel (if Intel TBB is available).
+            std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+            parallelResult = checker.check(this->env(), *formula);
+        }
+        auto const& sequentialValues = sequentialResult->asExplicitQuantitativeCheckResult<ValueType>();
+        auto const& parallelValues = parallelResult->asExplicitQuantitativeCheckResult<ValueType>();
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            EXPECT_NEAR(sequentialValues[state], parallelValues[state], this->precision()) << "for state " << state << " and formula " << formulaString;
+        }
+    }
+}
+
 TYPED_TEST(LraMdpPrctlModelCheckerTest, cs_nfail) {
     typedef typename TestFixture::ValueType ValueType;
 
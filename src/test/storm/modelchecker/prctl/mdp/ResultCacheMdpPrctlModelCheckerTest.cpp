@@ -0,0 +1,114 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/hints/ModelCheckerResultCache.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(ResultCacheMdpPrctlModelCheckerTest, WarmStart) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::string formulasString = "Pmin=? [F \"two\"]; Pmin>=0.03 [F \"two\"]; Rmax=? [F \"done\"]; Rmax<=8 [F \"done\"]; Pmax=? [F \"two\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint64_t initialState = *mdp->getInitialStates().begin();
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    // Reference results without cache.
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> referenceChecker(*mdp);
+    auto referenceResult = referenceChecker.check(env, storm::modelchecker::CheckTask<>(*formulas[0], false));
+    std::vector<double> referenceProbabilities = referenceResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    referenceResult = referenceChecker.check(env, storm::modelchecker::CheckTask<>(*formulas[2], false));
+    std::vector<double> referenceRewards = referenceResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    referenceResult = referenceChecker.check(env, storm::modelchecker::CheckTask<>(*formulas[3], false));
+    storm::storage::BitVector referenceRewardBound = referenceResult->asExplicitQualitativeCheckResult().getTruthValuesVector();
+
+    auto cache = std::make_shared<storm::modelchecker::ModelCheckerResultCache<double>>(mdp->getNumberOfStates());
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    checker.setResultCache(cache);
+
+    auto result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[0], false));
+    auto const& probabilities = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    EXPECT_NEAR(1.0 / 36.0, probabilities[initialState], 1e-6);
+    ASSERT_EQ(referenceProbabilities.size(), probabilities.size());
+    for (uint64_t state = 0; state < probabilities.size(); ++state) {
+        EXPECT_NEAR(referenceProbabilities[state], probabilities[state], 1e-6) << "for state " << state;
+    }
+    EXPECT_EQ(1ull, cache->size());
+    EXPECT_EQ(0ull, cache->getNumberOfHits());
+
+    // The bounded query has the same path formula and optimization direction and is seeded with the cached result.
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[1], false));
+    auto const& probabilityBound = result->asExplicitQualitativeCheckResult().getTruthValuesVector();
+    EXPECT_FALSE(probabilityBound.get(initialState));
+    for (uint64_t state = 0; state < probabilityBound.size(); ++state) {
+        EXPECT_EQ(referenceProbabilities[state] >= 0.03, probabilityBound.get(state)) << "for state " << state;
+    }
+    EXPECT_EQ(1ull, cache->size());
+    EXPECT_EQ(1ull, cache->getNumberOfHits());
+
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[2], false));
+    auto const& rewards = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    EXPECT_NEAR(22.0 / 3.0, rewards[initialState], 1e-6);
+    ASSERT_EQ(referenceRewards.size(), rewards.size());
+    for (uint64_t state = 0; state < rewards.size(); ++state) {
+        EXPECT_NEAR(referenceRewards[state], rewards[state], 1e-6) << "for state " << state;
+    }
+    EXPECT_EQ(2ull, cache->size());
+    EXPECT_EQ(1ull, cache->getNumberOfHits());
+
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[3], false));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[initialState]);
+    EXPECT_EQ(referenceRewardBound, result->asExplicitQualitativeCheckResult().getTruthValuesVector());
+    EXPECT_EQ(2ull, cache->size());
+    EXPECT_EQ(2ull, cache->getNumberOfHits());
+
+    // Tasks for which only the initial states are relevant (as issued by the command line interface) are still recorded for all states.
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[4], true));
+    EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    EXPECT_EQ(3ull, cache->size());
+    EXPECT_EQ(2ull, cache->getNumberOfHits());
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[4], true));
+    EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    EXPECT_EQ(3ull, cache->size());
+    EXPECT_EQ(3ull, cache->getNumberOfHits());
+}
+
+TEST(ResultCacheMdpPrctlModelCheckerTest, WarmStartInitialStatesOnly) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::string formulasString = "Rmax=? [F \"done\"]; Rmax<=8 [F \"done\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint64_t initialState = *mdp->getInitialStates().begin();
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    auto cache = std::make_shared<storm::modelchecker::ModelCheckerResultCache<double>>(mdp->getNumberOfStates());
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    checker.setResultCache(cache);
+
+    auto result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[0], true));
+    EXPECT_NEAR(22.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    EXPECT_EQ(1ull, cache->size());
+    EXPECT_EQ(0ull, cache->getNumberOfHits());
+
+    // The second query is seeded with the values of the first one.
+    result = checker.check(env, storm::modelchecker::CheckTask<>(*formulas[1], true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[initialState]);
+    EXPECT_EQ(1ull, cache->size());
+    EXPECT_EQ(1ull, cache->getNumberOfHits());
+}
@@ -1,11 +1,19 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/io/DirectEncodingExporter.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 TEST(DirectEncodingParserTest, DtmcParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
@@ -97,3 +105,72 @@ TEST(DirectEncodingParserTest, IntervalDtmcTest) {
     ASSERT_EQ(613ul, dtmc->getNumberOfStates());
     EXPECT_TRUE(modelPtr->hasUncertainty());
 }
+
+TEST(DirectEncodingParserTest, DtmcExport) {
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+
+    std::stringstream stream;
+    storm::exporter::explicitExportSparseModel(stream, modelPtr, {});
+    std::string exported = stream.str();
+
+    // Values are written in their shortest representation (if supported by the standard library) and states are written in order.
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    EXPECT_NE(std::string::npos, exported.find("state 1\n\taction 0\n\t\t2 : 0.833\n\t\t3 : 0.167\nstate 2\n"));
+#endif
+    uint64_t numberOfStates = 0;
+    for (auto position = exported.find("\nstate "); position != std::string::npos; position = exported.find("\nstate ", position + 1)) {
+        EXPECT_EQ(numberOfStates, std::stoull(exported.substr(position + 7, 10)));
+        ++numberOfStates;
+    }
+    EXPECT_EQ(8607ul, numberOfStates);
+}
+
+TEST(DirectEncodingParserTest, IntervalDtmcExport) {
+    std::shared_ptr<storm::models::sparse::Model<storm::Interval>> modelPtr =
+        storm::parser::DirectEncodingParser<storm::Interval>::parseModel(STORM_TEST_RESOURCES_DIR "/idtmc/brp-16-2.drn");
+
+    std::stringstream stream;
+    storm::exporter::explicitExportSparseModel(stream, modelPtr, {});
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    EXPECT_NE(std::string::npos, stream.str().find("\t\t2 : [0.97, 0.99]\n"));
+#endif
+
+    // The bounds of the intervals are restored exactly.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm-test-interval-export.drn").string();
+    {
+        std::ofstream file(filename);
+        file << stream.str();
+    }
+    std::shared_ptr<storm::models::sparse::Model<storm::Interval>> reparsedModelPtr =
+        storm::parser::DirectEncodingParser<storm::Interval>::parseModel(filename);
+    std::filesystem::remove(filename);
+    EXPECT_EQ(modelPtr->getTransitionMatrix(), reparsedModelPtr->getTransitionMatrix());
+}
+
+TEST(DirectEncodingParserTest, ParallelExport) {
+#ifndef STORM_HAVE_INTELTBB
+    GTEST_SKIP() << "Storm was built without support for Intel TBB.";
+#endif
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> exactModelPtr =
+        storm::parser::DirectEncodingParser<storm::RationalNumber>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+
+    // The chunks are formatted with the flags of the output stream.
+    std::stringstream sequentialStream, sequentialExactStream;
+    sequentialStream << std::showpos;
+    storm::exporter::explicitExportSparseModel(sequentialStream, modelPtr, {});
+    storm::exporter::explicitExportSparseModel(sequentialExactStream, exactModelPtr, {});
+
+    // The model has more than one chunk of states, so it is exported in parallel.
+    std::stringstream parallelStream, parallelExactStream;
+    parallelStream << std::showpos;
+    {
+        std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        storm::exporter::explicitExportSparseModel(parallelStream, modelPtr, {});
+        storm::exporter::explicitExportSparseModel(parallelExactStream, exactModelPtr, {});
+    }
+    EXPECT_EQ(sequentialStream.str(), parallelStream.str());
+    EXPECT_EQ(sequentialExactStream.str(), parallelExactStream.str());
+}
@@ -135,6 +135,34 @@ class NativeDoubleWalkerChaeEnvironment {
     }
 };
 
+class NativeDoubleGmresIluEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Ilu);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-8"));
+        return env;
+    }
+};
+
+class NativeDoubleBicgstabDiagonalEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Bicgstab);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-8"));
+        return env;
+    }
+};
+
 class NativeRationalRationalSearchEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -158,6 +186,17 @@ class EliminationRationalEnvironment {
     }
 };
 
+class PAdicRationalEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::PAdic);
+        return env;
+    }
+};
+
 class GmmGmresIluEnvironment {
    public:
     typedef double ValueType;
@@ -328,11 +367,11 @@ class LinearEquationSolverTest : public ::testing::Test {
 
 typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoublePowerRegMultEnvironment, NativeDoubleSoundValueIterationEnvironment,
                          NativeDoubleOptimisticValueIterationEnvironment, NativeDoubleIntervalIterationEnvironment, NativeDoubleJacobiEnvironment,
-                         NativeDoubleGaussSeidelEnvironment, NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment,
-                         NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment, GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment,
-                         GmmGmresNoneEnvironment, GmmBicgstabIluEnvironment, GmmQmrDiagonalEnvironment, EigenDGmresDiagonalEnvironment,
-                         EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment, EigenDoubleLUEnvironment, EigenRationalLUEnvironment,
-                         TopologicalEigenRationalLUEnvironment>
+                         NativeDoubleGaussSeidelEnvironment, NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment, NativeDoubleGmresIluEnvironment,
+                         NativeDoubleBicgstabDiagonalEnvironment, NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment,
+                         PAdicRationalEnvironment, GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment, GmmGmresNoneEnvironment, GmmBicgstabIluEnvironment,
+                         GmmQmrDiagonalEnvironment, EigenDGmresDiagonalEnvironment, EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment,
+                         EigenDoubleLUEnvironment, EigenRationalLUEnvironment, TopologicalEigenRationalLUEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(LinearEquationSolverTest, TestingTypes, );
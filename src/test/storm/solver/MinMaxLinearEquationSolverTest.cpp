@@ -1,14 +1,18 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <random>
+
 #include "test/storm_gtest.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/vector.h"
 
 namespace {
 
@@ -37,6 +41,31 @@ class DoubleViRegMultEnvironment {
     }
 };
 
+class DoubleMixedPrecisionViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setMixedPrecision(true);
+        return env;
+    }
+};
+
+class DoublePrioritizedViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PrioritizedValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
 class DoubleSoundViEnvironment {
    public:
     typedef double ValueType;
@@ -143,9 +172,9 @@ class MinMaxLinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment,
-                         DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment, DoublePIEnvironment, RationalPIEnvironment,
-                         RationalRationalSearchEnvironment>
+typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleMixedPrecisionViEnvironment, DoublePrioritizedViEnvironment,
+                         DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment, DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment,
+                         DoublePIEnvironment, RationalPIEnvironment, RationalRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MinMaxLinearEquationSolverTest, TestingTypes, );
@@ -177,4 +206,65 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+TEST(MinMaxLinearEquationSolverPolicyIterationTest, IncrementalEvaluation) {
+    // After the first round, policy iteration only re-solves the states that are affected by the changed choices. The result has to coincide with the
+    // solution of the full equation system induced by the final scheduler.
+    typedef storm::RationalNumber ValueType;
+    uint64_t const numberOfStates = 40;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint64_t> stateDistribution(0, numberOfStates - 1);
+    std::uniform_int_distribution<uint64_t> choiceDistribution(1, 3);
+    std::uniform_int_distribution<uint64_t> rewardDistribution(0, 8);
+
+    // Each choice moves to two (random) successors with probability 1/4 each and collects a reward of k/8 for some k in {0, ..., 8}.
+    ValueType const quarter = storm::utility::convertNumber<ValueType>(std::string("1/4"));
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    std::vector<ValueType> b;
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = choiceDistribution(generator); choice > 0; --choice) {
+            uint64_t first = stateDistribution(generator);
+            uint64_t second = stateDistribution(generator);
+            if (first == second) {
+                builder.addNextValue(row, first, quarter + quarter);
+            } else {
+                builder.addNextValue(row, std::min(first, second), quarter);
+                builder.addNextValue(row, std::max(first, second), quarter);
+            }
+            b.push_back(storm::utility::convertNumber<ValueType>(rewardDistribution(generator)) / storm::utility::convertNumber<ValueType>(8.0));
+            ++row;
+        }
+    }
+    storm::storage::SparseMatrix<ValueType> A = builder.build(row, numberOfStates);
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::convertNumber<ValueType>(2.0));
+        solver->setTrackScheduler(true);
+        std::vector<ValueType> x(numberOfStates, storm::utility::zero<ValueType>());
+        ASSERT_TRUE(solver->solveEquations(env, dir, x, b));
+
+        // Solve the equation system induced by the final scheduler from scratch.
+        storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+        bool convertToEquationSystem =
+            linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+        storm::storage::SparseMatrix<ValueType> inducedMatrix = A.selectRowsFromRowGroups(solver->getSchedulerChoices(), convertToEquationSystem);
+        if (convertToEquationSystem) {
+            inducedMatrix.convertToEquationSystem();
+        }
+        std::vector<ValueType> inducedB(numberOfStates);
+        storm::utility::vector::selectVectorValues(inducedB, solver->getSchedulerChoices(), A.getRowGroupIndices(), b);
+        auto linearEquationSolver = linearEquationSolverFactory.create(env, std::move(inducedMatrix));
+        linearEquationSolver->setBounds(storm::utility::zero<ValueType>(), storm::utility::convertNumber<ValueType>(2.0));
+        std::vector<ValueType> expected(numberOfStates, storm::utility::zero<ValueType>());
+        ASSERT_TRUE(linearEquationSolver->solveEquations(env, expected, inducedB));
+        EXPECT_EQ(expected, x);
+    }
+}
 }  // namespace
@@ -0,0 +1,98 @@
+#include "storm/storage/BitVector.h"
+#include "storm/storage/CompressedBitVector.h"
+#include "test/storm_gtest.h"
+
+namespace {
+// Creates a bit vector spanning several chunks with a sparse chunk, a chunk of intervals and a dense chunk.
+storm::storage::BitVector createMixedBitVector() {
+    storm::storage::BitVector result(300000);
+    for (uint64_t index = 3; index < 65536; index += 997) {
+        result.set(index);
+    }
+    for (uint64_t index = 70000; index < 130000; ++index) {
+        result.set(index);
+    }
+    for (uint64_t index = 140000; index < 200000; index += 3) {
+        result.set(index);
+    }
+    result.set(299999);
+    return result;
+}
+}  // namespace
+
+TEST(CompressedBitVectorTest, Conversion) {
+    storm::storage::BitVector vector = createMixedBitVector();
+    storm::storage::CompressedBitVector compressed(vector);
+
+    EXPECT_EQ(vector.size(), compressed.size());
+    EXPECT_EQ(vector.getNumberOfSetBits(), compressed.getNumberOfSetBits());
+    EXPECT_EQ(vector, compressed.toBitVector());
+    EXPECT_LT(compressed.getSizeInBytes(), vector.getSizeInBytes());
+
+    storm::storage::CompressedBitVector empty(300000);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(storm::storage::BitVector(300000), empty.toBitVector());
+    EXPECT_TRUE((~empty).full());
+}
+
+TEST(CompressedBitVectorTest, GetSetIterate) {
+    storm::storage::BitVector vector = createMixedBitVector();
+    storm::storage::CompressedBitVector compressed(vector);
+
+    for (uint64_t index = 0; index < vector.size(); index += 7) {
+        EXPECT_EQ(vector.get(index), compressed.get(index));
+        EXPECT_EQ(vector.getNextSetIndex(index), compressed.getNextSetIndex(index));
+    }
+    EXPECT_EQ(std::vector<uint64_t>(vector.begin(), vector.end()), std::vector<uint64_t>(compressed.begin(), compressed.end()));
+
+    // Modify bits in all kinds of chunks, including splitting an interval and filling a sparse chunk densely.
+    for (uint64_t index : {4ull, 100000ull, 100001ull, 140000ull, 140001ull, 250000ull, 299999ull}) {
+        vector.set(index, !vector.get(index));
+        compressed.set(index, !compressed.get(index));
+    }
+    for (uint64_t index = 0; index < 10000; ++index) {
+        vector.set(index);
+        compressed.set(index);
+    }
+    EXPECT_EQ(vector, compressed.toBitVector());
+    EXPECT_EQ(storm::storage::CompressedBitVector(vector), compressed);
+    EXPECT_EQ(vector.getNumberOfSetBits(), compressed.getNumberOfSetBits());
+}
+
+TEST(CompressedBitVectorTest, SetOnIntervals) {
+    storm::storage::BitVector vector(150000);
+    for (uint64_t index = 0; index < vector.size(); ++index) {
+        vector.set(index, (index / 1000) % 2 == 0);
+    }
+    storm::storage::CompressedBitVector compressed(vector);
+
+    // Extend, shrink, merge and split intervals as well as create and remove intervals of a single bit.
+    std::vector<uint64_t> indices = {1000, 1999, 1001, 1998, 2000, 3999, 1500, 1500, 5000, 4999, 7000, 7000, 9999, 9998, 65535, 65536, 149999};
+    for (uint64_t index : indices) {
+        vector.set(index, !vector.get(index));
+        compressed.set(index, !compressed.get(index));
+        EXPECT_EQ(vector, compressed.toBitVector()) << "after modifying bit " << index;
+    }
+    EXPECT_EQ(storm::storage::CompressedBitVector(vector), compressed);
+    EXPECT_EQ(vector.getNumberOfSetBits(), compressed.getNumberOfSetBits());
+    EXPECT_LT(compressed.getSizeInBytes(), vector.getSizeInBytes() / 10);
+}
+
+TEST(CompressedBitVectorTest, SetAlgebra) {
+    storm::storage::BitVector vector1 = createMixedBitVector();
+    storm::storage::BitVector vector2(300000);
+    for (uint64_t index = 0; index < vector2.size(); index += 5) {
+        vector2.set(index);
+    }
+    storm::storage::CompressedBitVector compressed1(vector1);
+    storm::storage::CompressedBitVector compressed2(vector2);
+
+    EXPECT_EQ(vector1 & vector2, (compressed1 & compressed2).toBitVector());
+    EXPECT_EQ(vector1 | vector2, (compressed1 | compressed2).toBitVector());
+    EXPECT_EQ(~vector1, (~compressed1).toBitVector());
+
+    EXPECT_TRUE((compressed1 & compressed2).isSubsetOf(compressed1));
+    EXPECT_FALSE(compressed1.isSubsetOf(compressed2));
+    EXPECT_TRUE(compressed1.isDisjointFrom(~compressed1));
+    EXPECT_FALSE(compressed1.isDisjointFrom(compressed2));
+}
@@ -594,6 +594,58 @@ TEST(CuddDd, MultiplyMatrixTest2) {
     ASSERT_EQ(3ull, r.getNonZeroCount());
 }
 
+TEST(CuddDd, MultiplyMatrixAndMinMaxAbstractTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    // The choices are encoded once above and once below the summation variables.
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a", 0, 3);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> c = manager->addMetaVariable("c", 0, 3);
+
+    for (auto const& choice : {a.first, c.first}) {
+        storm::dd::Add<storm::dd::DdType::CUDD, double> choiceIdentity = manager->template getIdentity<double>(choice);
+        storm::dd::Add<storm::dd::DdType::CUDD, double> matrix =
+            manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>() *
+            (choiceIdentity + manager->template getConstant<double>(1));
+        storm::dd::Add<storm::dd::DdType::CUDD, double> vector = manager->template getIdentity<double>(x.second);
+
+        std::map<storm::expressions::Variable, int_fast64_t> metaVariableToValueMap;
+        metaVariableToValueMap.emplace(x.first, 4);
+
+        storm::dd::Add<storm::dd::DdType::CUDD, double> result;
+        ASSERT_NO_THROW(result = matrix.multiplyMatrixAndMinMaxAbstract(vector, {x.second}, choiceIdentity, {choice}, true));
+        EXPECT_TRUE(result == (matrix.multiplyMatrix(vector, {x.second}) + choiceIdentity).minAbstract({choice}));
+        EXPECT_EQ(4, result.getValue(metaVariableToValueMap));
+
+        ASSERT_NO_THROW(result = matrix.multiplyMatrixAndMinMaxAbstract(vector, {x.second}, choiceIdentity, {choice}, false));
+        EXPECT_TRUE(result == (matrix.multiplyMatrix(vector, {x.second}) + choiceIdentity).maxAbstract({choice}));
+        EXPECT_EQ(19, result.getValue(metaVariableToValueMap));
+    }
+}
+
+TEST(CuddDd, InverseRelationalProductStepTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 5);
+
+    // Each state x has the successor x + 1.
+    storm::dd::Bdd<storm::dd::DdType::CUDD> relation =
+        (manager->template getIdentity<double>(x.first) + manager->template getConstant<double>(1)).equals(manager->template getIdentity<double>(x.second));
+    storm::dd::Bdd<storm::dd::DdType::CUDD> constraint =
+        manager->template getIdentity<double>(x.first).greaterOrEqual(manager->template getConstant<double>(2)) && manager->getRange(x.first);
+    storm::dd::Bdd<storm::dd::DdType::CUDD> states = manager->getEncoding(x.first, 5);
+
+    storm::dd::Bdd<storm::dd::DdType::CUDD> result;
+    ASSERT_NO_THROW(result = states.inverseRelationalProductStep(relation, {x.first}, {x.second}, constraint));
+    EXPECT_TRUE(result == (states || (constraint && states.inverseRelationalProduct(relation, {x.first}, {x.second}))));
+    EXPECT_EQ(2ul, result.getNonZeroCount());
+
+    storm::dd::Bdd<storm::dd::DdType::CUDD> lastStates = manager->getBddZero();
+    while (lastStates != result) {
+        lastStates = result;
+        result = result.inverseRelationalProductStep(relation, {x.first}, {x.second}, constraint);
+    }
+    EXPECT_EQ(4ul, result.getNonZeroCount());
+}
+
 TEST(CuddDd, GetSetValueTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -1,6 +1,11 @@
+#include <map>
+
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/OutOfRangeException.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/permutation.h"
@@ -831,6 +836,95 @@ TEST(SparseMatrix, PermuteRows) {
     EXPECT_EQ(matrix.getRowSum(2), matrixperm.getRowSum(4));
 }
 
+TEST(SparseMatrix, LargeMatrixTransformations) {
+    // The matrices have enough entries such that the transformations are performed in parallel if Intel TBB is enabled.
+    uint64_t const size = 40000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(size, size, 2 * size);
+    for (uint64_t row = 0; row < size; ++row) {
+        uint64_t otherColumn = (7 * row + 3) % size;
+        matrixBuilder.addNextValue(row, std::min(row, otherColumn), 0.25);
+        matrixBuilder.addNextValue(row, std::max(row, otherColumn), 0.75);
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    // Every odd row group has a second row.
+    storm::storage::SparseMatrixBuilder<double> groupedMatrixBuilder(0, size, 0, false, true, size);
+    uint64_t groupedRow = 0;
+    for (uint64_t group = 0; group < size; ++group) {
+        groupedMatrixBuilder.newRowGroup(groupedRow);
+        uint64_t otherColumn = (11 * group + 5) % size;
+        groupedMatrixBuilder.addNextValue(groupedRow, std::min(group, otherColumn), 0.5);
+        groupedMatrixBuilder.addNextValue(groupedRow, std::max(group, otherColumn), 0.5);
+        ++groupedRow;
+        if (group % 2 == 1) {
+            groupedMatrixBuilder.addNextValue(groupedRow, (group + 1) % size, 1.0);
+            ++groupedRow;
+        }
+    }
+    storm::storage::SparseMatrix<double> groupedMatrix = groupedMatrixBuilder.build();
+
+    std::vector<uint64_t> inversePermutation(size);
+    for (uint64_t row = 0; row < size; ++row) {
+        inversePermutation[row] = size - 1 - row;
+    }
+    storm::storage::BitVector evenStates(size);
+    for (uint64_t row = 0; row < size; row += 2) {
+        evenStates.set(row);
+    }
+
+    auto transform = [&]() {
+        std::vector<storm::storage::SparseMatrix<double>> result;
+        result.push_back(matrix.transpose());
+        result.push_back(groupedMatrix.transpose(true));
+        result.push_back(matrix.permuteRows(inversePermutation));
+        result.push_back(matrix.getSubmatrix(false, evenStates, evenStates, true));
+        result.push_back(groupedMatrix.getSubmatrix(true, evenStates, evenStates));
+        return result;
+    };
+    std::vector<storm::storage::SparseMatrix<double>> sequentialResults, parallelResults;
+    {
+        std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        sequentialResults = transform();
+    }
+    {
+        std::unique_ptr<storm::settings::SettingMemento> useTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        parallelResults = transform();
+    }
+    ASSERT_EQ(sequentialResults.size(), parallelResults.size());
+    for (uint64_t index = 0; index < sequentialResults.size(); ++index) {
+        EXPECT_EQ(sequentialResults[index].getRowGroupIndices(), parallelResults[index].getRowGroupIndices()) << "for transformation " << index;
+        EXPECT_EQ(sequentialResults[index], parallelResults[index]) << "for transformation " << index;
+    }
+
+    EXPECT_EQ(matrix, parallelResults[0].transpose());
+
+    storm::storage::SparseMatrix<double> const& permutedMatrix = parallelResults[2];
+    EXPECT_EQ(matrix.getRowSum(size - 1), permutedMatrix.getRowSum(0));
+    EXPECT_EQ(matrix, permutedMatrix.permuteRows(inversePermutation));
+
+    // Keep the even rows and columns and insert the missing diagonal entries.
+    storm::storage::SparseMatrixBuilder<double> submatrixBuilder(size / 2, size / 2);
+    for (uint64_t row = 0; row < size; row += 2) {
+        std::map<uint64_t, double> entries = {{row / 2, 0.0}};
+        for (auto const& entry : matrix.getRow(row)) {
+            if (entry.getColumn() % 2 == 0) {
+                entries[entry.getColumn() / 2] = entry.getValue();
+            }
+        }
+        for (auto const& columnValuePair : entries) {
+            submatrixBuilder.addNextValue(row / 2, columnValuePair.first, columnValuePair.second);
+        }
+    }
+    storm::storage::SparseMatrix<double> const& submatrix = parallelResults[3];
+    storm::storage::SparseMatrix<double> expectedSubmatrix = submatrixBuilder.build();
+    EXPECT_EQ(expectedSubmatrix.getEntryCount(), submatrix.getEntryCount());
+    EXPECT_EQ(expectedSubmatrix, submatrix);
+
+    // Only the even row groups (which have a single row) remain.
+    EXPECT_EQ(size / 2, parallelResults[4].getRowCount());
+    EXPECT_EQ(size / 2, parallelResults[4].getRowGroupCount());
+}
+
 TEST(SparseMatrix, PermuteRowGroupsAndColumns) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9, true, true, 4);
     ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
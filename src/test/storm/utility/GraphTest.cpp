@@ -10,6 +10,7 @@
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/SparseAdjacency.h"
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -329,3 +330,59 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitBackwardTransitionStructure) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    auto const& mdp = *model->as<storm::models::sparse::Mdp<double>>();
+
+    // The structure has to coincide with the transposed transition matrix.
+    storm::storage::SparseMatrix<double> backwardTransitions = mdp.getBackwardTransitions();
+    storm::storage::SparseAdjacency backwardStructure = storm::storage::SparseAdjacency::createBackwardAdjacency(mdp.getTransitionMatrix());
+    ASSERT_EQ(backwardTransitions.getRowCount(), backwardStructure.getRowCount());
+    ASSERT_EQ(backwardTransitions.getEntryCount(), backwardStructure.getEntryCount());
+    for (uint64_t state = 0; state < mdp.getNumberOfStates(); ++state) {
+        auto structureIt = backwardStructure.getRow(state).begin();
+        for (auto const& entry : backwardTransitions.getRow(state)) {
+            EXPECT_EQ(entry.getColumn(), *structureIt);
+            ++structureIt;
+        }
+        EXPECT_EQ(backwardStructure.getRow(state).end(), structureIt);
+    }
+
+    storm::storage::BitVector phiStates(mdp.getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = mdp.getStates("all_coins_equal_1");
+    auto const& choiceIndices = mdp.getNondeterministicChoiceIndices();
+    EXPECT_EQ(storm::utility::graph::performProb01Min(mdp.getTransitionMatrix(), choiceIndices, backwardTransitions, phiStates, psiStates),
+              storm::utility::graph::performProb01Min(mdp.getTransitionMatrix(), choiceIndices, backwardStructure, phiStates, psiStates));
+    EXPECT_EQ(storm::utility::graph::performProb01Max(mdp.getTransitionMatrix(), choiceIndices, backwardTransitions, phiStates, psiStates),
+              storm::utility::graph::performProb01Max(mdp.getTransitionMatrix(), choiceIndices, backwardStructure, phiStates, psiStates));
+    EXPECT_EQ(storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, 3),
+              storm::utility::graph::performProbGreater0(backwardStructure, phiStates, psiStates, true, 3));
+
+    // If caching is enabled, the structure is shared and graph analyses only use the structure.
+    auto passesStructure = [&model]() {
+        return model->applyToBackwardTransitions(
+            [](auto const& transitions) { return std::is_same_v<std::decay_t<decltype(transitions)>, storm::storage::SparseAdjacency>; });
+    };
+    model->setBackwardTransitionsCaching(true);
+    auto cachedStructure = model->getBackwardTransitionStructure();
+    EXPECT_EQ(cachedStructure.get(), model->getBackwardTransitionStructure().get());
+    EXPECT_TRUE(*cachedStructure == backwardStructure);
+    EXPECT_TRUE(passesStructure());
+
+    // Once the backward transitions are cached, they replace the structure.
+    auto cachedTransitions = model->getSharedBackwardTransitions();
+    EXPECT_EQ(cachedTransitions.get(), model->getSharedBackwardTransitions().get());
+    EXPECT_EQ(*cachedTransitions, model->getBackwardTransitions());
+    EXPECT_FALSE(passesStructure());
+    EXPECT_NE(model->getBackwardTransitionStructure().get(), cachedStructure.get());
+
+    // Retrieving the transition matrix for modification invalidates the cache.
+    model->getTransitionMatrix();
+    EXPECT_NE(cachedStructure.get(), model->getBackwardTransitionStructure().get());
+    EXPECT_NE(cachedTransitions.get(), model->getSharedBackwardTransitions().get());
+    model->setBackwardTransitionsCaching(false);
+}
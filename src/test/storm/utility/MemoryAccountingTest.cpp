@@ -0,0 +1,60 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+#include <thread>
+
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/MemoryAccounting.h"
+#include "storm/utility/OsDetection.h"
+
+TEST(MemoryAccountingTest, StagesAndStructureSizes) {
+#ifdef LINUX
+    EXPECT_GT(storm::utility::memory::getResidentSize(), 0ull);
+#endif
+    EXPECT_GT(storm::utility::memory::getPeakResidentSize(), 0ull);
+
+    storm::utility::memory::enable();
+    {
+        storm::utility::memory::MemoryStage outerStage("memory-test-outer");
+        storm::storage::SparseMatrixBuilder<double> builder(1000, 1000, 1000);
+        for (uint64_t row = 0; row < 1000; ++row) {
+            builder.addNextValue(row, row, 1.0);
+        }
+        auto matrix = builder.build();
+        EXPECT_GE(matrix.getSizeInBytes(), 1000 * sizeof(storm::storage::MatrixEntry<uint64_t, double>));
+        storm::utility::memory::recordStructureSize("memory-test-matrix", matrix.getSizeInBytes());
+
+        storm::utility::memory::MemoryStage innerStage("memory-test-inner");
+        storm::storage::BitVectorHashMap<uint64_t> map(64);
+        uint64_t sizeOfEmptyMap = map.getSizeInBytes();
+        for (uint64_t i = 0; i < 10000; ++i) {
+            storm::storage::BitVector key(64);
+            key.setFromInt(0, 64, i);
+            map.findOrAdd(key, i);
+        }
+        EXPECT_GT(map.getSizeInBytes(), sizeOfEmptyMap);
+
+        // Stages on other threads are not accounted.
+        std::thread worker([]() { storm::utility::memory::MemoryStage workerStage("memory-test-worker"); });
+        worker.join();
+    }
+
+    std::stringstream report;
+    storm::utility::memory::printReport(report);
+    std::string reportString = report.str();
+    auto outerPosition = reportString.find("* memory-test-outer (1x)");
+    auto innerPosition = reportString.find("* memory-test-inner (1x)");
+    ASSERT_NE(std::string::npos, outerPosition);
+    ASSERT_NE(std::string::npos, innerPosition);
+    EXPECT_LT(outerPosition, innerPosition);
+    EXPECT_EQ(std::string::npos, reportString.find("memory-test-worker"));
+    // The change of the resident size is only determined for top-level stages.
+    EXPECT_NE(std::string::npos, reportString.find("* memory-test-outer (1x): resident "));
+    EXPECT_NE(std::string::npos, reportString.find("* memory-test-inner (1x): peak "));
+    EXPECT_NE(std::string::npos, reportString.find("- memory-test-matrix: "));
+
+    // Without a soft limit, the limit is never exceeded.
+    EXPECT_FALSE(storm::utility::memory::isSoftLimitExceeded());
+}
@@ -0,0 +1,58 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/Profiling.h"
+
+namespace {
+storm::json<double> const* findScope(storm::json<double> const& scopes, std::string const& name) {
+    for (auto const& scope : scopes) {
+        if (scope["name"] == name) {
+            return &scope;
+        }
+    }
+    return nullptr;
+}
+}  // namespace
+
+TEST(ProfilingTest, ScopesAndCounters) {
+    // Nothing is collected while profiling is disabled.
+    {
+        STORM_PROFILE_SCOPE("profiling-test-disabled");
+        STORM_PROFILE_COUNT("profiling-test-disabled-counter", 1);
+    }
+    EXPECT_EQ(nullptr, findScope(storm::utility::profiling::toJson()["scopes"], "profiling-test-disabled"));
+
+    storm::utility::profiling::enable(true);
+    for (uint64_t i = 0; i < 3; ++i) {
+        STORM_PROFILE_SCOPE("profiling-test-outer");
+        {
+            STORM_PROFILE_SCOPE("profiling-test-inner");
+            STORM_PROFILE_COUNT("profiling-test-counter", 2);
+        }
+    }
+    storm::utility::profiling::disable();
+
+    storm::json<double> result = storm::utility::profiling::toJson();
+    auto outer = findScope(result["scopes"], "profiling-test-outer");
+    ASSERT_NE(nullptr, outer);
+    EXPECT_EQ(3u, (*outer)["calls"].get<uint64_t>());
+    ASSERT_TRUE(outer->contains("children"));
+    auto inner = findScope((*outer)["children"], "profiling-test-inner");
+    ASSERT_NE(nullptr, inner);
+    EXPECT_EQ(3u, (*inner)["calls"].get<uint64_t>());
+    EXPECT_LE((*inner)["time-ms"].get<double>(), (*outer)["time-ms"].get<double>());
+    EXPECT_EQ(6u, result["counters"]["profiling-test-counter"].get<uint64_t>());
+    EXPECT_FALSE(result["counters"].contains("profiling-test-disabled-counter"));
+
+    // Each call of a scope is recorded as an event.
+    storm::json<double> trace = storm::utility::profiling::toChromeTrace();
+    uint64_t numberOfOuterEvents = 0;
+    for (auto const& event : trace["traceEvents"]) {
+        if (event["name"] == "profiling-test-outer") {
+            ++numberOfOuterEvents;
+            EXPECT_EQ("X", event["ph"]);
+        }
+    }
+    EXPECT_EQ(3u, numberOfOuterEvents);
+}
@@ -0,0 +1,87 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/io/SparseModelCache.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+TEST(SparseModelCacheTest, StoreAndLoad) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::storage::SymbolicModelDescription modelDescription(program);
+    storm::builder::BuilderOptions options;
+    options.setBuildAllLabels().setBuildAllRewardModels().setBuildChoiceLabels().setBuildStateValuations();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    std::string directory = (std::filesystem::temp_directory_path() / "storm-test-model-cache").string();
+    storm::exporter::SparseModelCacheKey key = storm::exporter::computeSparseModelCacheKey(modelDescription, "", options);
+    std::filesystem::remove_all(directory);
+    EXPECT_EQ(nullptr, storm::exporter::loadSparseModelFromCache<double>(directory, key, program.getManager()));
+
+    storm::exporter::storeSparseModelInCache(directory, key, *model);
+    auto cachedModel = storm::exporter::loadSparseModelFromCache<double>(directory, key, program.getManager());
+    ASSERT_NE(nullptr, cachedModel);
+    EXPECT_EQ(storm::models::ModelType::Mdp, cachedModel->getType());
+    EXPECT_EQ(model->getTransitionMatrix(), cachedModel->getTransitionMatrix());
+    EXPECT_EQ(model->getStateLabeling(), cachedModel->getStateLabeling());
+    EXPECT_EQ(model->getRewardModels().size(), cachedModel->getRewardModels().size());
+    EXPECT_EQ(model->getChoiceLabeling(), cachedModel->getChoiceLabeling());
+    ASSERT_TRUE(cachedModel->hasStateValuations());
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        EXPECT_EQ(model->getStateValuations().toString(state), cachedModel->getStateValuations().toString(state));
+    }
+
+    // Different options must not hit the same entry.
+    options.setBuildStateValuations(false);
+    storm::exporter::SparseModelCacheKey otherKey = storm::exporter::computeSparseModelCacheKey(modelDescription, "", options);
+    EXPECT_NE(key.name, otherKey.name);
+    EXPECT_NE(key.description, otherKey.description);
+
+    // An entry whose name collides with the one of another input is a miss.
+    otherKey.name = key.name;
+    EXPECT_EQ(nullptr, storm::exporter::loadSparseModelFromCache<double>(directory, otherKey, program.getManager()));
+    EXPECT_NE(nullptr, storm::exporter::loadSparseModelFromCache<double>(directory, key, program.getManager()));
+    std::filesystem::remove_all(directory);
+}
+
+TEST(SparseModelCacheTest, InvalidEntries) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::storage::SymbolicModelDescription modelDescription(program);
+    storm::builder::BuilderOptions options;
+    options.setBuildAllLabels().setBuildAllRewardModels();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    std::string directory = (std::filesystem::temp_directory_path() / "storm-test-model-cache").string();
+    storm::exporter::SparseModelCacheKey key = storm::exporter::computeSparseModelCacheKey(modelDescription, "", options);
+    std::string filename = (std::filesystem::path(directory) / (key.name + ".smc")).string();
+    std::filesystem::remove_all(directory);
+    storm::exporter::storeSparseModelInCache(directory, key, *model);
+    ASSERT_TRUE(std::filesystem::exists(filename));
+    uint64_t const entrySize = std::filesystem::file_size(filename);
+
+    // The length of the row group indices (following the header and the column count of the matrix) exceeds the size of the entry.
+    {
+        std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+        uint64_t const invalidLength = 1ull << 60;
+        file.seekp(8 + 8 + 8 + 6 + 8 + key.description.size() + 8 + 8 + 8);
+        file.write(reinterpret_cast<char const*>(&invalidLength), sizeof(invalidLength));
+    }
+    EXPECT_EQ(nullptr, storm::exporter::loadSparseModelFromCache<double>(directory, key, program.getManager()));
+
+    // A truncated entry.
+    storm::exporter::storeSparseModelInCache(directory, key, *model);
+    std::filesystem::resize_file(filename, entrySize / 2);
+    EXPECT_EQ(nullptr, storm::exporter::loadSparseModelFromCache<double>(directory, key, program.getManager()));
+
+    // If the cache directory can not be created, the model is not cached.
+    std::filesystem::remove_all(directory);
+    std::ofstream(directory).put('x');
+    EXPECT_NO_THROW(storm::exporter::storeSparseModelInCache(directory + "/entries", key, *model));
+    EXPECT_EQ(nullptr, storm::exporter::loadSparseModelFromCache<double>(directory + "/entries", key, program.getManager()));
+    std::filesystem::remove_all(directory);
+}